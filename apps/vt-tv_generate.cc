@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              vt-tv_generate.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/dataset_generator.h>
+#include <vt-tv/utility/info_loader.h>
+#include <vt-tv/utility/log.h>
+
+#include <fmt-vt/format.h>
+#include <CLI/CLI11.hpp>
+
+#include <chrono>
+
+#if VT_TV_OPENMP_ENABLED
+#include <omp.h>
+#endif
+
+int main(int argc, char** argv) {
+  using namespace vt;
+  using namespace tv;
+  using utility::DatasetGenerator;
+
+  CLI::App app{"TV: Task Visualizer synthetic LB data generator"};
+
+  utility::DatasetSpec spec;
+  std::string output_dir = "output/synthetic";
+  app.add_option(
+    "-o,--output-dir", output_dir,
+    "Output directory, relative paths being relative to the source directory");
+  std::string stem = "data";
+  app.add_option("--stem", stem, "Stem of the data file names");
+  app.add_option("-r,--ranks", spec.num_ranks, "Number of ranks");
+  app.add_option("-n,--objects", spec.num_objects_per_rank,
+                 "Mean number of objects per rank");
+  app.add_option("--objects-spread", spec.objects_spread,
+                 "Relative spread of the object counts of the ranks");
+  app.add_option("-p,--phases", spec.num_phases, "Number of phases");
+  app.add_option("--lb-iterations", spec.num_lb_iterations,
+                 "Number of LB iterations per phase");
+  app.add_option("--subphases", spec.num_subphases,
+                 "Number of subphases per task");
+
+  std::string load_distribution = "uniform";
+  app.add_option("--load-distribution", load_distribution,
+                 "Object loads: constant, uniform, normal or lognormal");
+  app.add_option("--load-mean", spec.load_mean, "Mean object load");
+  app.add_option("--load-spread", spec.load_spread,
+                 "Relative half-width (uniform), relative deviation (normal) "
+                 "or log deviation (lognormal) of the object loads");
+  app.add_option("--phase-noise", spec.phase_noise,
+                 "Relative change of the object loads from frame to frame");
+  app.add_option("--hot-ranks", spec.hot_rank_fraction,
+                 "Fraction of ranks whose objects are overloaded");
+  app.add_option("--hot-factor", spec.hot_rank_factor,
+                 "Load factor of the objects of overloaded ranks");
+
+  std::string topology = "random";
+  app.add_option("-t,--topology", topology,
+                 "Communications: none, ring, stencil or random");
+  app.add_option("--degree", spec.comm_degree,
+                 "Messages sent per object (stencil and random)");
+  app.add_option("--remote-fraction", spec.remote_fraction,
+                 "Fraction of the random messages sent to other ranks");
+  app.add_option("--bytes", spec.comm_bytes, "Mean bytes per message");
+  app.add_option("--migration-fraction", spec.migration_fraction,
+                 "Fraction of the objects on a neighbor of their home rank "
+                 "in each phase and LB iteration");
+
+  std::vector<std::string> user_defined;
+  app.add_option("-u,--user-defined", user_defined,
+                 "User-defined task fields, as name[:double|int|string]");
+  app.add_option("-s,--seed", spec.seed, "Seed of all random draws");
+  app.add_flag("-z,--compress", spec.compress,
+               "Write brotli-compressed .json.br files");
+  app.add_option("-q,--quality", spec.quality, "Brotli quality");
+  int threads = VT_TV_N_THREADS;
+  app.add_option("-j,--threads", threads, "Number of ranks written at once");
+  std::string log_level = "info";
+  app.add_option(
+    "-l,--log", log_level,
+    "Log levels, such as \"warning\" or \"info,general=debug\"");
+
+  CLI11_PARSE(app, argc, argv);
+
+  try {
+    utility::Log::configure(log_level);
+    spec.load_distribution =
+      DatasetGenerator::getLoadDistribution(load_distribution);
+    spec.comm_topology = DatasetGenerator::getCommTopology(topology);
+    for (auto const& description : user_defined) {
+      spec.user_defined.push_back(
+        DatasetGenerator::getUserDefinedField(description));
+    }
+
+    DatasetGenerator generator(spec);
+    output_dir = utility::InfoLoader::resolveDirectory(output_dir);
+
+#if VT_TV_OPENMP_ENABLED
+    omp_set_num_threads(threads);
+    VT_TV_LOG(General, Info, "vt-tv: Using {} threads", threads);
+#endif
+
+    auto const start = std::chrono::steady_clock::now();
+    generator.write(output_dir, stem);
+    std::chrono::duration<double> const elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    VT_TV_LOG(
+      General, Info,
+      "== Wrote {} objects over {} ranks and {} phases to {}{}.*{} in {:.2f} s",
+      generator.getTotalObjects(), spec.num_ranks, spec.num_phases, output_dir,
+      stem, spec.compress ? ".json.br" : ".json", elapsed.count());
+  } catch (std::exception const& e) {
+    utility::Log::finish();
+    fmt::print(stderr, "Error generating the data: {}\n", e.what());
+    return 1;
+  }
+
+  utility::Log::finish();
+  return 0;
+}
@@ -43,6 +43,7 @@
 
 #include <vt-tv/api/info.h>
 #include <vt-tv/utility/json_reader.h>
+#include <vt-tv/utility/log.h>
 #include <vt-tv/render/render.h>
 #include <vt-tv/utility/parse_render.h>
 
@@ -69,7 +70,7 @@ int main(int argc, char** argv) {
   }
   yaml_file = config_file_path.string();
 
-  fmt::print("Input configuration file={}\n", yaml_file);
+  VT_TV_LOG(General, Info, "Input configuration file={}", yaml_file);
 
   utility::ParseRender pr{yaml_file};
   pr.parseAndRender();
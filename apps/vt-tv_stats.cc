@@ -0,0 +1,172 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                vt-tv_stats.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/analytics.h>
+#include <vt-tv/utility/info_loader.h>
+#include <vt-tv/utility/log.h>
+#include <vt-tv/utility/memory_report.h>
+#include <vt-tv/utility/trace.h>
+
+#include <fmt-vt/format.h>
+#include <yaml-cpp/yaml.h>
+#include <CLI/CLI11.hpp>
+
+#include <filesystem>
+#include <limits>
+
+int main(int argc, char** argv) {
+  using namespace vt;
+  using namespace tv;
+
+  CLI::App app{"TV: Task Visualizer statistics, without rendering"};
+
+  std::string yaml_file = "config/conf.yaml";
+  app.add_option("-c,--conf", yaml_file, "Input configuration file")
+    ->required();
+
+  std::string format;
+  app.add_option(
+    "-f,--format", format,
+    "Statistics format, \"csv\" or \"json\" (default: output.analytics of "
+    "the configuration, or \"csv\")");
+
+  std::string output_file;
+  app.add_option(
+    "-o,--output", output_file,
+    "Statistics file (default: named after the output directory and file "
+    "stem of the configuration)");
+
+  PhaseType selected_phase = std::numeric_limits<PhaseType>::max();
+  app.add_option(
+    "-p,--phase", selected_phase,
+    "The only phase to report, whose edges alone are normalized (default: "
+    "all phases)");
+
+  std::string trace_file;
+  app.add_option(
+    "-t,--trace", trace_file,
+    "Chrome trace file of the stages, whose summary is printed at the end");
+
+  bool memory_report = false;
+  app.add_flag(
+    "-m,--memory", memory_report,
+    "Print the estimated memory of the data model and the peak memory of each "
+    "stage");
+
+  std::string log_level;
+  app.add_option(
+    "-l,--log", log_level,
+    "Log levels, such as \"warning\" or \"info,loader=debug\" (default: "
+    "output.log_level of the configuration, or \"info\")");
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::filesystem::path config_file_path(yaml_file);
+
+  // If it's a relative path, prepend the SRC_DIR
+  if (config_file_path.is_relative()) {
+    config_file_path = std::filesystem::path(SRC_DIR) / config_file_path;
+  }
+  yaml_file = config_file_path.string();
+
+  try {
+    YAML::Node config = YAML::LoadFile(yaml_file);
+    if (log_level.empty()) {
+      log_level = config["output"]["log_level"].as<std::string>("info");
+    }
+    utility::Log::configure(log_level);
+
+    if (format.empty()) {
+      format = config["output"]["analytics"].as<std::string>("none");
+    }
+    auto analytics_format = utility::Analytics::getFormat(format);
+    if (analytics_format == utility::AnalyticsFormat::None) {
+      analytics_format = utility::AnalyticsFormat::CSV;
+    }
+
+    if (output_file.empty()) {
+      std::string output_dir = utility::InfoLoader::resolveDirectory(
+        config["output"]["directory"].as<std::string>("output"));
+      std::filesystem::create_directories(output_dir);
+      output_file = output_dir +
+        config["output"]["file_stem"].as<std::string>("vttv") + "_analytics" +
+        utility::Analytics::getExtension(analytics_format);
+    }
+
+    if (not trace_file.empty()) {
+      utility::Trace::get().enable(trace_file);
+    }
+    if (memory_report) {
+      utility::MemoryReport::get().enable();
+    }
+
+    VT_TV_LOG(General, Info, "Input configuration file={}", yaml_file);
+    std::unique_ptr<Info> info;
+    {
+      utility::TraceSpan span("load_info");
+      utility::MemoryStage stage("load_info");
+      info = utility::InfoLoader::loadFromConfig(config, selected_phase);
+    }
+    utility::MemoryReport::get().addModel(*info);
+
+    utility::TraceSpan span("analytics");
+    utility::MemoryStage stage("analytics");
+    utility::Analytics analytics(*info, selected_phase);
+    analytics.write(output_file, analytics_format);
+    VT_TV_LOG(
+      General, Info, "== Wrote statistics of {} frames to {}",
+      analytics.getFrames().size(), output_file);
+  } catch (std::exception const& e) {
+    utility::Trace::get().finish();
+    utility::MemoryReport::get().finish();
+    utility::Log::finish();
+    fmt::print(stderr, "Error computing the statistics: {}\n", e.what());
+    return 1;
+  }
+
+  utility::Trace::get().finish();
+  utility::MemoryReport::get().finish();
+  utility::Log::finish();
+  return 0;
+}
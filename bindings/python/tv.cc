@@ -3,20 +3,25 @@
 
 namespace vt::tv::bindings::python {
 
+namespace {
+
+/// The QOI catalog of the data of the last run
+std::shared_ptr<QOICatalog const> last_qoi_catalog;
+
+} /* end anonymous namespace */
+
 void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const std::string& input_yaml_params_str, uint64_t num_ranks) {
     std::string startup_logo = std::string("        __           __\n")
                              + std::string(" _   __/ /_         / /__   __\n")
                              + std::string("| | / / __/ _____  / __/ | / /\n")
                              + std::string("| |/ / /   /____/ / /_ | |/ /\n")
-                             + std::string("|___/\\__/         \\__/ |___/\n");
-    fmt::print("==============================\n");
-    fmt::print(startup_logo);
-    fmt::print("==============================\n");
+                             + std::string("|___/\\__/         \\__/ |___/");
 
     YAML::Node viz_config;
     try {
       // Load the configuration from serialized YAML
       viz_config = YAML::Load(input_yaml_params_str);
+      utility::Log::configure(viz_config["log_level"].as<std::string>("info"));
     } catch (std::exception const& e) {
         throw std::runtime_error(fmt::format(
             "vt-tv: Error reading the configuration file: {}",
@@ -24,6 +29,10 @@ void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const
         ));
     }
 
+    VT_TV_LOG(General, Info, "==============================");
+    VT_TV_LOG(General, Info, "{}", startup_logo);
+    VT_TV_LOG(General, Info, "==============================");
+
     // Config Validator
     ConfigValidator config_validator(viz_config);
 
@@ -45,7 +54,10 @@ void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const
     };
 
     bool save_meshes = viz_config["save_meshes"].as<bool>();
+    bool save_rank_communication = viz_config["save_rank_communication"].as<bool>(false);
+    bool save_migrations = viz_config["save_migration_mesh"].as<bool>(false);
     bool save_pngs = true; // lbaf always saves pngs
+    bool save_exodus = viz_config["save_exodus"].as<bool>(false);
     bool continuous_object_qoi = viz_config["force_continuous_object_qoi"].as<bool>();
 
     std::array<uint64_t, 3> grid_size = {
@@ -56,6 +68,11 @@ void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const
 
     double object_jitter = viz_config["object_jitter"].as<double>();
 
+    utility::EdgeSelection edge_selection;
+    edge_selection.top_k = viz_config["edge_top_k"].as<uint64_t>(0);
+    edge_selection.min_volume = viz_config["edge_min_bytes"].as<double>(0.0);
+    edge_selection.inter_rank_only = viz_config["edge_inter_rank_only"].as<bool>(false);
+
     std::string output_dir = viz_config["output_visualization_dir"].as<std::string>();
     std::filesystem::path output_path(output_dir);
 
@@ -92,21 +109,57 @@ void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const
       font_size = viz_config["font_size"].as<uint64_t>();
     }
 
+    std::string renderer = viz_config["renderer"].as<std::string>("vtk");
+    std::string png_encoder = viz_config["png_encoder"].as<std::string>("vtk");
+    int png_compression_level = viz_config["png_compression_level"].as<int>(2);
+    uint64_t writer_threads = viz_config["writer_threads"].as<uint64_t>(1);
+    uint64_t writer_queue_size = viz_config["writer_queue_size"].as<uint64_t>(4);
+    std::string vtp_encoding = viz_config["vtp_encoding"].as<std::string>("base64");
+    std::string vtp_compressor = viz_config["vtp_compressor"].as<std::string>("zlib");
+    int vtp_compression_level = viz_config["vtp_compression_level"].as<int>(5);
+    std::string mesh_collection = viz_config["mesh_collection"].as<std::string>("none");
+    std::string animation = viz_config["animation"].as<std::string>("none");
+    uint32_t animation_fps = viz_config["animation_fps"].as<uint32_t>(10);
+    uint64_t lod_tile_size = viz_config["lod_tile_size"].as<uint64_t>(1);
+    std::string analytics = viz_config["analytics"].as<std::string>("none");
+    std::string trace_file = viz_config["trace_file"].as<std::string>("");
+    bool memory_report = viz_config["memory_report"].as<bool>(false);
+
     // print all saved configuration parameters
-    fmt::print("Input Configuration Parameters:\n");
-    fmt::print("  x_ranks: {}\n", grid_size[0]);
-    fmt::print("  y_ranks: {}\n", grid_size[1]);
-    fmt::print("  z_ranks: {}\n", grid_size[2]);
-    fmt::print("  object_jitter: {}\n", object_jitter);
-    fmt::print("  rank_qoi: {}\n", qoi_request[0]);
-    fmt::print("  object_qoi: {}\n", qoi_request[2]);
-    fmt::print("  save_meshes: {}\n", save_meshes);
-    fmt::print("  save_pngs: {}\n", save_pngs);
-    fmt::print("  force_continuous_object_qoi: {}\n", continuous_object_qoi);
-    fmt::print("  output_visualization_dir: {}\n", output_dir);
-    fmt::print("  output_visualization_file_stem: {}\n", output_file_stem);
-    fmt::print("  window_size: {}\n", win_size);
-    fmt::print("  font_size: {}\n", font_size);
+    VT_TV_LOG(General, Info, "Input Configuration Parameters:");
+    VT_TV_LOG(General, Info, "  x_ranks: {}", grid_size[0]);
+    VT_TV_LOG(General, Info, "  y_ranks: {}", grid_size[1]);
+    VT_TV_LOG(General, Info, "  z_ranks: {}", grid_size[2]);
+    VT_TV_LOG(General, Info, "  object_jitter: {}", object_jitter);
+    VT_TV_LOG(General, Info, "  rank_qoi: {}", qoi_request[0]);
+    VT_TV_LOG(General, Info, "  object_qoi: {}", qoi_request[2]);
+    VT_TV_LOG(General, Info, "  save_meshes: {}", save_meshes);
+    VT_TV_LOG(General, Info, "  save_rank_communication: {}", save_rank_communication);
+    VT_TV_LOG(General, Info, "  save_migration_mesh: {}", save_migrations);
+    VT_TV_LOG(General, Info, "  save_pngs: {}", save_pngs);
+    VT_TV_LOG(General, Info, "  save_exodus: {}", save_exodus);
+    VT_TV_LOG(General, Info, "  force_continuous_object_qoi: {}", continuous_object_qoi);
+    VT_TV_LOG(General, Info, "  output_visualization_dir: {}", output_dir);
+    VT_TV_LOG(General, Info, "  output_visualization_file_stem: {}", output_file_stem);
+    VT_TV_LOG(General, Info, "  window_size: {}", win_size);
+    VT_TV_LOG(General, Info, "  font_size: {}", font_size);
+    VT_TV_LOG(General, Info, "  analytics: {}", analytics);
+    VT_TV_LOG(General, Info, "  trace_file: {}", trace_file);
+    VT_TV_LOG(General, Info, "  memory_report: {}", memory_report);
+    VT_TV_LOG(
+      General, Info, "  log_level: {}",
+      viz_config["log_level"].as<std::string>("info"));
+
+    // Stages are traced from reading on when a trace file is requested
+    if (!trace_file.empty()) {
+      if (std::filesystem::path(trace_file).is_relative()) {
+        trace_file = output_dir + trace_file;
+      }
+      utility::Trace::get().enable(trace_file);
+    }
+    if (memory_report) {
+      utility::MemoryReport::get().enable();
+    }
 
     using json = nlohmann::json;
 
@@ -114,6 +167,8 @@ void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const
 
     // Initialize the info object, that will hold data for all ranks for all phases
     std::unique_ptr<Info> info = std::make_unique<Info>();
+    std::optional<utility::TraceSpan> load_span(std::in_place, "load_info");
+    std::optional<utility::MemoryStage> load_stage(std::in_place, "load_info");
 
     #ifdef VT_TV_N_THREADS
       const int threads = VT_TV_N_THREADS;
@@ -124,13 +179,14 @@ void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const
     #if VT_TV_OPENMP_ENABLED
       omp_set_num_threads(threads);
       // print number of threads
-      fmt::print("vt-tv: Using {} threads\n", threads);
+      VT_TV_LOG(Loader, Info, "vt-tv: Using {} threads", threads);
       # pragma omp parallel for
     #endif
     #endif
     for (int64_t rank_id = 0; rank_id < num_ranks; rank_id++) {
-      fmt::print("Reading file for rank {}\n", rank_id);
+      VT_TV_LOG(Loader, Debug, "Reading file for rank {}", rank_id);
       std::string rank_json_str = input_json_per_rank_list[rank_id];
+      utility::TraceSpan span("parse_data_file", {{"rank", rank_id}});
       utility::JSONReader reader{static_cast<NodeType>(rank_id)};
       reader.readString(rank_json_str);
       auto tmpInfo = reader.parse();
@@ -143,14 +199,105 @@ void tvFromJson(const std::vector<std::string>& input_json_per_rank_list, const
         info->addInfo(tmpInfo->getObjectInfo(), tmpInfo->getRank(rank_id));
       }
     }
+    utility::InfoLoader::selectPhase(*info, std::numeric_limits<PhaseType>::max());
+    {
+      utility::TraceSpan span("qoi_catalog");
+      last_qoi_catalog = info->getQOICatalog();
+    }
+    load_span.reset();
+    load_stage.reset();
+    utility::MemoryReport::get().addModel(*info);
+
+    // Write the statistics of all frames, which do not depend on rendering
+    auto const analytics_format = utility::Analytics::getFormat(analytics);
+    if (analytics_format != utility::AnalyticsFormat::None) {
+      utility::TraceSpan span("analytics");
+      utility::MemoryStage stage("analytics");
+      utility::Analytics(*info).write(
+        output_dir + output_file_stem + "_analytics" +
+          utility::Analytics::getExtension(analytics_format),
+        analytics_format
+      );
+    }
+
     // Instantiate render
+    std::optional<utility::TraceSpan> setup_span(std::in_place, "render_setup");
+    std::optional<utility::MemoryStage> setup_stage(std::in_place, "render_setup");
     Render render(
-      qoi_request, continuous_object_qoi, *info, grid_size, object_jitter,
+      qoi_request, continuous_object_qoi, std::move(info), grid_size, object_jitter,
       output_dir, output_file_stem, 1.0, save_meshes, save_pngs, std::numeric_limits<PhaseType>::max()
     );
-    render.generate(font_size, win_size);
+    render.setEdgeSelection(edge_selection);
+    render.setRendererType(Render::getRendererType(renderer));
+    render.setPNGEncoder(Render::getPNGEncoderType(png_encoder), png_compression_level);
+    render.setAsyncWriters(writer_threads, writer_queue_size);
+    render.setVTPOutput(
+      Render::getVTPEncodingType(vtp_encoding),
+      Render::getVTPCompressorType(vtp_compressor),
+      vtp_compression_level
+    );
+    render.setMeshCollection(Render::getMeshCollectionType(mesh_collection));
+    render.setSaveRankCommunication(save_rank_communication);
+    render.setSaveMigrations(save_migrations);
+    render.setSaveExodus(save_exodus);
+    render.setLODTileSize(lod_tile_size);
+    render.setAnimation(Render::getAnimationFormat(animation), animation_fps);
+    setup_span.reset();
+    setup_stage.reset();
+    {
+      utility::MemoryStage stage("generate");
+      render.generate(font_size, win_size);
+    }
+    utility::Trace::get().finish();
+    utility::MemoryReport::get().finish();
+    utility::Log::finish();
 
-    fmt::print("vt-tv: Done.\n");
+    VT_TV_LOG(General, Info, "vt-tv: Done.");
+}
+
+std::map<std::string, std::vector<std::tuple<std::string, uint64_t, uint64_t>>>
+getMemoryReport() {
+    auto const& report = utility::MemoryReport::get();
+    std::map<std::string, std::vector<std::tuple<std::string, uint64_t, uint64_t>>> result;
+    for (auto const& c : report.getModel()) {
+      result["model"].emplace_back(c.name, c.count, c.bytes);
+    }
+    for (auto const& c : report.getBuffers()) {
+      result["buffers"].emplace_back(c.name, c.count, c.bytes);
+    }
+    for (auto const& s : report.getStages()) {
+      result["stages"].emplace_back(s.name, s.rss_bytes, s.peak_bytes);
+    }
+    return result;
+}
+
+std::map<
+  std::string,
+  std::map<std::string, std::tuple<std::string, std::vector<PhaseType>, uint64_t, double, double>>>
+getQOICatalog() {
+    std::map<
+      std::string,
+      std::map<std::string, std::tuple<std::string, std::vector<PhaseType>, uint64_t, double, double>>>
+      result;
+    if (last_qoi_catalog == nullptr) {
+      return result;
+    }
+    auto addKeys = [&](std::string const& kind, QOIKeyMap const& keys) {
+      auto& entries = result[kind];
+      for (auto const& [key, key_info] : keys) {
+        auto const phases = key_info.getPhases();
+        entries[key] = std::make_tuple(
+          QOIKeyInfo::getTypeName(key_info.type),
+          std::vector<PhaseType>(phases.begin(), phases.end()),
+          key_info.count, key_info.min, key_info.max
+        );
+      }
+    };
+    addKeys("rank_user_defined", last_qoi_catalog->rank_user_defined);
+    addKeys("rank_attributes", last_qoi_catalog->rank_attributes);
+    addKeys("object_user_defined", last_qoi_catalog->object_user_defined);
+    addKeys("object_attributes", last_qoi_catalog->object_attributes);
+    return result;
 }
 
 namespace nb = nanobind;
@@ -158,6 +305,8 @@ using namespace nb::literals;
 
 NB_MODULE(vttv, m) {
   m.def("tvFromJson", &tvFromJson);
+  m.def("getMemoryReport", &getMemoryReport);
+  m.def("getQOICatalog", &getQOICatalog);
 }
 
 } /* end namespace vt::tv::bindings::python */
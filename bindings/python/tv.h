@@ -54,16 +54,25 @@
 #include "vt-tv/utility/input_iterator.h"
 #include "vt-tv/utility/qoi_serializer.h"
 #include "vt-tv/utility/json_reader.h"
+#include "vt-tv/utility/info_loader.h"
+#include "vt-tv/utility/analytics.h"
+#include "vt-tv/utility/log.h"
+#include "vt-tv/utility/memory_report.h"
+#include "vt-tv/utility/trace.h"
 
 #include <nlohmann/json.hpp>
 #include <yaml-cpp/yaml.h>
 
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/map.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 
 #include <filesystem>
 #include <map>
+#include <optional>
+#include <tuple>
 
 #if VT_TV_OPENMP_ENABLED
 #include <omp.h>
@@ -73,6 +82,28 @@ namespace vt::tv::bindings::python {
 
 void tvFromJson(const std::vector<std::string>&, const std::string&, uint64_t);
 
+/**
+ * \brief Get the memory report of the last run with \c memory_report set
+ *
+ * \return the "model" categories and largest "buffers" as (name, count,
+ * bytes), and the "stages" as (name, RSS bytes, peak RSS bytes)
+ */
+std::map<std::string, std::vector<std::tuple<std::string, uint64_t, uint64_t>>>
+getMemoryReport();
+
+/**
+ * \brief Get the QOI catalog of the data of the last run
+ *
+ * \return for each kind of QOI ("rank_user_defined", "rank_attributes",
+ * "object_user_defined" and "object_attributes"), the keys with their type,
+ * phases, number of values and numerical range as (type, phases, count, min,
+ * max)
+ */
+std::map<
+  std::string,
+  std::map<std::string, std::tuple<std::string, std::vector<PhaseType>, uint64_t, double, double>>>
+getQOICatalog();
+
 } /* end namespace vt::tv::bindings::python */
 
 #endif /*INCLUDED_VT_TV_BINDINGS_PYTHON_JSON_INTERFACE_H*/
@@ -52,7 +52,10 @@ VT_TV_CMAKE_JOBS=${VT_TV_CMAKE_JOBS:-$(get_num_processors)}
 VT_TV_TESTS_ENABLED=$(on_off ${VT_TV_TESTS_ENABLED:-ON})
 VT_TV_TEST_REPORT=${VT_TV_TEST_REPORT:-"$VT_TV_OUTPUT_DIR/junit-report.xml"}
 VT_TV_COVERAGE_ENABLED=$(on_off ${VT_TV_COVERAGE_ENABLED:-OFF})
+VT_TV_BENCHMARKS_ENABLED=$(on_off ${VT_TV_BENCHMARKS_ENABLED:-OFF})
+VT_TV_PERF_TESTS_ENABLED=$(on_off ${VT_TV_PERF_TESTS_ENABLED:-OFF})
 VT_TV_CLEAN=$(on_off ${VT_TV_CLEAN:-ON})
+VT_TV_RENDER_ENABLED=$(on_off ${VT_TV_RENDER_ENABLED:-ON})
 VT_TV_PYTHON_BINDINGS_ENABLED=$(on_off ${VT_TV_PYTHON_BINDINGS_ENABLED:-OFF})
 VT_TV_WERROR_ENABLED=$(on_off ${VT_TV_WERROR_ENABLED:-OFF})
 # >> Run tests settings
@@ -78,6 +81,7 @@ help() {
       -d   --build-dir=[str]        Build directory (VT_TV_BUILD_DIR=$VT_TV_BUILD_DIR)
       -m   --build-type=[str]       Set the CMAKE_BUILD_TYPE value (Debug|Release|...) (VT_TV_BUILD_TYPE=$VT_TV_BUILD_TYPE)
       -y   --clean=[bool]           Clean the output directory and the CMake cache. (VT_TV_CLEAN=$VT_TV_CLEAN)
+      -n   --render=[bool]          Build the VTK rendering library and apps. Only the core library and vt-tv_stats are built without it. (VT_TV_RENDER_ENABLED=$VT_TV_RENDER_ENABLED)
       -p   --bindings               Build with Python bindings (VT_TV_PYTHON_BINDINGS_ENABLED=$VT_TV_PYTHON_BINDINGS_ENABLED)
 
       -g   --coverage               Build with coverage support or enable coverage output (VT_TV_COVERAGE_ENABLED=$VT_TV_COVERAGE_ENABLED)
@@ -87,6 +91,7 @@ help() {
       -o   --output-dir=[str]       Output directory. Used to host lcov .info files. Also default to host junit report (VT_TV_OUTPUT_DIR=$VT_TV_OUTPUT_DIR).
                                       Note: vt-tv viz output files is defined in VT-TV configuration files and might be different.
       -t   --tests=[bool]           Build vt-tv tests (VT_TV_TESTS_ENABLED=$VT_TV_TESTS_ENABLED)
+      -e   --benchmarks=[bool]      Build vt-tv benchmarks, requires tests (VT_TV_BENCHMARKS_ENABLED=$VT_TV_BENCHMARKS_ENABLED)
       -a   --tests-report[str]      Unit tests Junit report path (VT_TV_TEST_REPORT=$VT_TV_TEST_REPORT). Empty for no report.
       -r   --tests-run=[bool]       Run unit tests (and build coverage report if coverage is enabled) (VT_TV_RUN_TESTS=$VT_TV_RUN_TESTS)
       -f   --tests-run-filter=[str] Filter unit test to run. (VT_TV_RUN_TESTS_FILTER=$VT_TV_RUN_TESTS_FILTER)
@@ -125,6 +130,7 @@ while getopts btch-: OPT; do  # allow -b -t -c -h, and --long_attr=value"
     b | build )           VT_TV_BUILD=$(on_off $OPTARG) ;;
     d | build-dir )       VT_TV_BUILD_DIR=$(realpath "$OPTARG") ;;
     m | build-type)       VT_TV_BUILD_TYPE=$(on_off $OPTARG) ;;
+    n | render )          VT_TV_RENDER_ENABLED=$(on_off $OPTARG) ;;
     p | bindings )        VT_TV_PYTHON_BINDINGS_ENABLED=$(on_off $OPTARG) ;;
     c | cc)               CC="$OPTARG" ;;
     x | cxx)              CXX="$OPTARG" ;;
@@ -134,6 +140,7 @@ while getopts btch-: OPT; do  # allow -b -t -c -h, and --long_attr=value"
     j | jobs)             VT_TV_CMAKE_JOBS=$OPTARG ;;
     o | output-dir )      VT_TV_OUTPUT_DIR=$(realpath "$OPTARG") ;;
     t | tests)            VT_TV_TESTS_ENABLED=$(on_off $OPTARG) ;;
+    e | benchmarks)       VT_TV_BENCHMARKS_ENABLED=$(on_off $OPTARG) ;;
     a | tests-report)     VT_TV_TEST_REPORT=$(realpath -q "$OPTARG") ;;
     r | tests-run )       VT_TV_RUN_TESTS=$(on_off $OPTARG) ;;
     f | tests-run-filter) VT_TV_RUN_TESTS_FILTER="$OPTARG" ;;
@@ -153,12 +160,15 @@ echo VT_TV_CLEAN=$VT_TV_CLEAN
 echo VT_TV_OUTPUT_DIR=$VT_TV_OUTPUT_DIR
 echo VT_TV_BUILD_DIR=$VT_TV_BUILD_DIR
 echo VT_TV_BUILD_TYPE=$VT_TV_BUILD_TYPE
+echo VT_TV_RENDER_ENABLED=$VT_TV_RENDER_ENABLED
 echo VT_TV_PYTHON_BINDINGS_ENABLED=$VT_TV_PYTHON_BINDINGS_ENABLED
 echo VT_TV_RUN_TESTS=$VT_TV_RUN_TESTS
 echo VT_TV_TESTS_ENABLED=$VT_TV_TESTS_ENABLED
 echo VT_TV_TEST_REPORT=$VT_TV_TEST_REPORT
 echo VT_TV_RUN_TESTS_FILTER=$VT_TV_RUN_TESTS_FILTER
 echo VT_TV_COVERAGE_ENABLED=$VT_TV_COVERAGE_ENABLED
+echo VT_TV_BENCHMARKS_ENABLED=$VT_TV_BENCHMARKS_ENABLED
+echo VT_TV_PERF_TESTS_ENABLED=$VT_TV_PERF_TESTS_ENABLED
 echo VT_TV_COVERAGE_REPORT=$VT_TV_COVERAGE_REPORT
 echo CC=$CC
 echo CXX=$CXX
@@ -191,7 +201,10 @@ if [[ "${VT_TV_BUILD}" == "ON" ]]; then
     -DBUILD_TESTING=${VT_TV_TESTS_ENABLED} \
     -DVT_TV_TESTS_ENABLED=${VT_TV_TESTS_ENABLED} \
     -DVT_TV_COVERAGE_ENABLED=${VT_TV_COVERAGE_ENABLED} \
+    -DVT_TV_BENCHMARKS_ENABLED=${VT_TV_BENCHMARKS_ENABLED} \
+    -DVT_TV_PERF_TESTS_ENABLED=${VT_TV_PERF_TESTS_ENABLED} \
     \
+    -DVT_TV_RENDER_ENABLED=${VT_TV_RENDER_ENABLED} \
     -DVT_TV_PYTHON_BINDINGS_ENABLED=${VT_TV_PYTHON_BINDINGS_ENABLED} \
     \
     -DPython_EXECUTABLE="$(which python)" \
@@ -8,6 +8,6 @@ endif()
 
 function(link_openmp)
   if(VT_TV_OPENMP_ENABLED)
-    target_link_libraries(${VT_TV_LIBRARY} PUBLIC OpenMP::OpenMP_CXX)
+    target_link_libraries(${VT_TV_CORE_LIBRARY} PUBLIC OpenMP::OpenMP_CXX)
   endif()
 endfunction()
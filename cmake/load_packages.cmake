@@ -28,7 +28,13 @@ if(NOT TARGET ${YAML_LIBRARY})
   add_subdirectory(${CMAKE_CURRENT_SOURCE_DIR}/lib/yaml-cpp)
 endif()
 
-include(cmake/load_vtk_package.cmake)
+# output writers run on background threads
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+
+if (VT_TV_RENDER_ENABLED)
+  include(cmake/load_vtk_package.cmake)
+endif()
 
 if (VT_TV_PYTHON_BINDINGS_ENABLED)
   include(cmake/load_nanobind_package.cmake)
@@ -3,6 +3,7 @@ find_package(
   VTK REQUIRED COMPONENTS
   RenderingCore
   IOExodus
+  exodusII
   IOParallel
   IOXML
   CommonColor
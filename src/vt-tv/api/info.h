@@ -47,13 +47,22 @@
 #include "vt-tv/api/types.h"
 #include "vt-tv/api/rank.h"
 #include "vt-tv/api/object_info.h"
+#include "vt-tv/api/migration_diff.h"
+#include "vt-tv/api/qoi_catalog.h"
+#include "vt-tv/api/phase_summary.h"
+#include "vt-tv/utility/log.h"
+#include "vt-tv/utility/parallel_for.h"
 
 #include <fmt-vt/format.h>
 
+#include <algorithm>
 #include <unordered_map>
 #include <cassert>
 #include <functional>
+#include <iterator>
+#include <optional>
 #include <set>
+#include <tuple>
 
 namespace vt::tv {
 
@@ -88,6 +97,10 @@ struct Info {
 
     assert(ranks_.find(r.getRankID()) == ranks_.end() && "Rank must not exist");
     ranks_.try_emplace(r.getRankID(), std::move(r));
+    migration_diffs_.clear();
+    normalized_phases_.clear();
+    qoi_catalog_.clear();
+    phase_summary_.reset();
   }
 
   void setSelectedPhase(PhaseType selected_phase) {
@@ -190,7 +203,11 @@ struct Info {
     {"migratable_load", VtkTypeEnum::TYPE_DOUBLE},
     {"sentinel_load", VtkTypeEnum::TYPE_DOUBLE},
     {"id", VtkTypeEnum::TYPE_INT},
-    {"rank_id", VtkTypeEnum::TYPE_INT}
+    {"rank_id", VtkTypeEnum::TYPE_INT},
+    {"migrations_in", VtkTypeEnum::TYPE_INT},
+    {"migrations_out", VtkTypeEnum::TYPE_INT},
+    {"migrated_load_in", VtkTypeEnum::TYPE_DOUBLE},
+    {"migrated_load_out", VtkTypeEnum::TYPE_DOUBLE}
   };
 
   /**
@@ -234,6 +251,26 @@ struct Info {
       qoi_getter = [&](Rank rank, PhaseType, LBIterationType) {
         return convertQOIVariantTypeToT_<T>(getRankID(rank));
       };
+    } else if (rank_qoi == "migrations_in") {
+      qoi_getter = [&](Rank rank, PhaseType phase, LBIterationType lb_iter) {
+        return static_cast<T>(
+          getMigrationDiff(phase, lb_iter)->n_in.at(rank.getRankID()));
+      };
+    } else if (rank_qoi == "migrations_out") {
+      qoi_getter = [&](Rank rank, PhaseType phase, LBIterationType lb_iter) {
+        return static_cast<T>(
+          getMigrationDiff(phase, lb_iter)->n_out.at(rank.getRankID()));
+      };
+    } else if (rank_qoi == "migrated_load_in") {
+      qoi_getter = [&](Rank rank, PhaseType phase, LBIterationType lb_iter) {
+        return static_cast<T>(
+          getMigrationDiff(phase, lb_iter)->load_in.at(rank.getRankID()));
+      };
+    } else if (rank_qoi == "migrated_load_out") {
+      qoi_getter = [&](Rank rank, PhaseType phase, LBIterationType lb_iter) {
+        return static_cast<T>(
+          getMigrationDiff(phase, lb_iter)->load_out.at(rank.getRankID()));
+      };
     } else {
       // Look in attributes (will throw an error if QOI doesn't exist)
       qoi_getter = [&](Rank rank, PhaseType, LBIterationType) {
@@ -247,36 +284,36 @@ struct Info {
    * \brief Returns a getter to a specified object QOI
    */
   template <typename T>
-  std::function<T(ObjectWork)>
+  std::function<T(ObjectWork const&)>
   getObjectQOIGetter(std::string const& object_qoi) const {
-    std::function<T(ObjectWork)> qoi_getter;
+    std::function<T(ObjectWork const&)> qoi_getter;
     if (object_qoi == "load") {
-      qoi_getter = [&](ObjectWork obj) {
+      qoi_getter = [&](ObjectWork const& obj) {
         return convertQOIVariantTypeToT_<T>(getObjectLoad(obj));
       };
     } else if (object_qoi == "received_volume") {
-      qoi_getter = [&](ObjectWork obj) {
+      qoi_getter = [&](ObjectWork const& obj) {
         return convertQOIVariantTypeToT_<T>(getObjectReceivedVolume(obj));
       };
     } else if (object_qoi == "sent_volume") {
-      qoi_getter = [&](ObjectWork obj) {
+      qoi_getter = [&](ObjectWork const& obj) {
         return convertQOIVariantTypeToT_<T>(getObjectSentVolume(obj));
       };
     } else if (object_qoi == "max_volume") {
-      qoi_getter = [&](ObjectWork obj) {
+      qoi_getter = [&](ObjectWork const& obj) {
         return convertQOIVariantTypeToT_<T>(getObjectMaxVolume(obj));
       };
     } else if (object_qoi == "id") {
-      qoi_getter = [&](ObjectWork obj) {
+      qoi_getter = [&](ObjectWork const& obj) {
         return convertQOIVariantTypeToT_<T>(getObjectID(obj));
       };
     } else if (object_qoi == "rank_id") {
-      qoi_getter = [&](ObjectWork obj) {
+      qoi_getter = [&](ObjectWork const& obj) {
         return convertQOIVariantTypeToT_<T>(getObjectRankID(obj));
       };
     } else {
       // Look in attributes and user_defined (will throw an error if QOI doesn't exist)
-      qoi_getter = [&](ObjectWork obj) {
+      qoi_getter = [&](ObjectWork const& obj) {
         return convertQOIVariantTypeToT_<T>(
           getObjectAttributeOrUserDefined(obj, object_qoi));
       };
@@ -382,7 +419,22 @@ struct Info {
     std::string const& obj_qoi
   ) const {
     auto const& objects = getPhaseObjects(phase, lb_iter);
-    auto const& obj = objects.at(obj_id);
+    return getObjectQOI<T>(objects.at(obj_id), obj_qoi);
+  }
+
+  /**
+   * \brief Get a specified QOI of an object
+   *
+   * Prefer this over \c getObjectQOIAtPhase when the object work is at hand,
+   * as it does not need to gather the objects of the whole phase.
+   *
+   * \param[in] obj the object work
+   * \param[in] obj_qoi the QOI
+   *
+   * \return the object QOI
+   */
+  template <typename T>
+  T getObjectQOI(ObjectWork const& obj, std::string const& obj_qoi) const {
     auto const& ud = obj.getUserDefined();
 
     if (auto it = ud.find(obj_qoi); it != ud.end()) {
@@ -496,7 +548,18 @@ struct Info {
    *
    * \return the maximum volume
    */
-  double getMaxVolume() const {
+  double getMaxVolume() const { return getMaxVolume(selected_phase_); }
+
+  /**
+   * \brief Get maximum inter-object communication volume across all ranks of
+   * a phase
+   *
+   * \param[in] selected_phase the phase, or all phases when set to the
+   * maximum phase value
+   *
+   * \return the maximum volume
+   */
+  double getMaxVolume(PhaseType selected_phase) const {
     double ov_max = 0.;
 
     /*
@@ -508,17 +571,17 @@ struct Info {
     */
     auto const n_phases = getNumPhases();
 
-    if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
-      auto const& objects = getPhaseObjects(selected_phase_, no_lb_iter);
+    if (selected_phase != std::numeric_limits<PhaseType>::max()) {
+      auto const& objects = getPhaseObjects(selected_phase, no_lb_iter);
       for (auto const& [obj_id, obj_work] : objects) {
         auto obj_max_v = obj_work.getMaxVolume();
         if (obj_max_v > ov_max)
           ov_max = obj_max_v;
       }
       auto const& lb_iters =
-        getRank(0).getPhaseWork().at(selected_phase_).getLBIterations();
+        getRank(0).getPhaseWork().at(selected_phase).getLBIterations();
       for (auto const& [lb_iter_id, _] : lb_iters) {
-        auto const& objects2 = getPhaseObjects(selected_phase_, lb_iter_id);
+        auto const& objects2 = getPhaseObjects(selected_phase, lb_iter_id);
         for (auto const& [obj_id, obj_work] : objects2) {
           auto obj_max_v = obj_work.getMaxVolume();
           if (obj_max_v > ov_max)
@@ -553,22 +616,32 @@ struct Info {
    *
    * \return the maximum load
    */
-  double getMaxLoad() const {
+  double getMaxLoad() const { return getMaxLoad(selected_phase_); }
+
+  /**
+   * \brief Get maximum load of objects across all ranks of a phase
+   *
+   * \param[in] selected_phase the phase, or all phases when set to the
+   * maximum phase value
+   *
+   * \return the maximum load
+   */
+  double getMaxLoad(PhaseType selected_phase) const {
     double ol_max = 0.;
 
     auto const n_phases = getNumPhases();
 
-    if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
-      auto const& objects = getPhaseObjects(selected_phase_, no_lb_iter);
+    if (selected_phase != std::numeric_limits<PhaseType>::max()) {
+      auto const& objects = getPhaseObjects(selected_phase, no_lb_iter);
       for (auto const& [obj_id, obj_work] : objects) {
         auto obj_load = obj_work.getLoad();
         if (obj_load > ol_max)
           ol_max = obj_load;
       }
       auto const& lb_iters =
-        getRank(0).getPhaseWork().at(selected_phase_).getLBIterations();
+        getRank(0).getPhaseWork().at(selected_phase).getLBIterations();
       for (auto const& [lb_iter_id, _] : lb_iters) {
-        auto const& objects2 = getPhaseObjects(selected_phase_, lb_iter_id);
+        auto const& objects2 = getPhaseObjects(selected_phase, lb_iter_id);
         for (auto const& [obj_id, obj_work] : objects2) {
           auto obj_load = obj_work.getLoad();
           if (obj_load > ol_max)
@@ -675,7 +748,7 @@ struct Info {
         }
       }
     }
-    fmt::print("Size of all objects: {}\n", objects.size());
+    VT_TV_LOG(Model, Debug, "Size of all objects: {}", objects.size());
     return objects;
   }
 
@@ -689,14 +762,22 @@ struct Info {
   /**
    * \brief Normalize communications for a phase: ensure receives and sends coincide
    *
+   * Phases already normalized are skipped until more ranks are added.
+   *
    * \return void
    */
   void normalizeEdges(PhaseType phase) {
-    fmt::print("\n---- Normalizing Edges for phase {} ----\n", phase);
-    // Vector of tuples of communications to add: {side_to_be_modified, id1, id2, bytes} for an id1 -> id2 communication (1 sends to 2, 2 receives from 1)
+    if (not normalized_phases_.insert(phase).second) {
+      return;
+    }
+    VT_TV_LOG(Model, Debug, "---- Normalizing Edges for phase {} ----", phase);
+    // Vector of tuples of communications to add: {side_to_be_modified, id1, id2, bytes, messages} for an id1 -> id2 communication (1 sends to 2, 2 receives from 1)
     // if type is "sender", communication has to be added to sent communications for object id1
     // if type is "recipient", communication has to be added to received communications for object id2
-    std::vector<std::tuple<std::string, ElementIDType, ElementIDType, double>>
+    // Edges are grouped by peer, so the messages between two objects are
+    // carried by the first edge added between them
+    std::vector<std::tuple<
+      std::string, ElementIDType, ElementIDType, double, uint64_t>>
       communications_to_add;
 
     auto phase_objects = createPhaseObjectsMapping(phase);
@@ -709,7 +790,11 @@ struct Info {
       //      fmt::print(" and {} received communications.\n", received.size());
       // Going through A -> ... communications
       //      fmt::print(" Checking sent communications:\n");
+      std::optional<ElementIDType> previous_id;
       for (auto& [B_id, bytes] : sent) {
+        uint64_t const messages =
+          previous_id == B_id ? 0 : object_work.getSentMessages().at(B_id);
+        previous_id = B_id;
         //        fmt::print("  Communication sent to object {} of {} bytes:\n", B_id, bytes);
         // check if B exists for the A -> B communication
         if (phase_objects.find(B_id) != phase_objects.end()) {
@@ -723,12 +808,13 @@ struct Info {
           } else {
             //            fmt::print(  "   Object {} doesn't have received communication from object {}. Pushing to list of communications to add.\n", B_id, A_id);
             communications_to_add.push_back(
-              std::make_tuple("recipient", A_id, B_id, bytes));
+              std::make_tuple("recipient", A_id, B_id, bytes, messages));
           }
         } else {
-          fmt::print(
-            "  /!\\ Didn't find recipient object {} when searching for "
-            "communication sent by object {} of {} bytes.\n",
+          VT_TV_LOG_LIMITED(
+            Model, Warning, 10,
+            "Warning: didn't find recipient object {} when searching for "
+            "communication sent by object {} of {} bytes.",
             B_id,
             A_id,
             bytes);
@@ -736,8 +822,13 @@ struct Info {
       }
       // Going through A <- ... communications
       //      fmt::print(" Checking received communications:\n");
+      previous_id.reset();
       for (auto& [B_id, bytes] :
            received) { // Going through A <- ... communications
+        uint64_t const messages = previous_id == B_id ?
+          0 :
+          object_work.getReceivedMessages().at(B_id);
+        previous_id = B_id;
         //        fmt::print("  Communication received from object {} of {} bytes:\n", B_id, bytes);
         // check if B exists for the A <- B communication
         if (phase_objects.find(B_id) != phase_objects.end()) {
@@ -751,7 +842,7 @@ struct Info {
           } else {
             //            fmt::print(  "   Object {} doesn't have sent communication to object {}. Pushing to list of communications to add.\n", B_id, A_id);
             communications_to_add.push_back(
-              std::make_tuple("sender", B_id, A_id, bytes));
+              std::make_tuple("sender", B_id, A_id, bytes, messages));
           }
         } else {
           //          fmt::print("  /!\\ Didn't find sender object {} when searching for communication received by object {} of {} bytes.\n", B_id, A_id, bytes);
@@ -770,20 +861,20 @@ struct Info {
         // fmt::print("  Checking if object {} needs to be updated.\n", obj_id);
         // fmt::print("  Communications to update:\n");
         uint64_t i = 0;
-        for (auto& [object_to_update, sender_id, recipient_id, bytes] :
+        for (auto& [object_to_update, sender_id, recipient_id, bytes, messages] :
              communications_to_add) {
           // fmt::print("    {} needs to be updated in {} -> {} communication of {} bytes.\n", object_to_update,
           //  sender_id, recipient_id, bytes);
           if (object_to_update == "sender" && sender_id == obj_id) {
             // fmt::print("    Sender to be updated is object on this rank. Updating.\n");
             rank.addObjectSentCommunicationAtPhase(
-              phase, obj_id, recipient_id, bytes);
+              phase, obj_id, recipient_id, bytes, messages);
             communications_to_add.erase(communications_to_add.begin() + i);
           } else if (
             object_to_update == "recipient" && recipient_id == obj_id) {
             // fmt::print("    Recipient to be updated is object on this rank. Updating.\n");
             rank.addObjectReceivedCommunicationAtPhase(
-              phase, obj_id, sender_id, bytes);
+              phase, obj_id, sender_id, bytes, messages);
             communications_to_add.erase(communications_to_add.begin() + i);
           }
           if (communications_to_add.empty()) {
@@ -821,6 +912,386 @@ struct Info {
     return imbalance;
   }
 
+  /**
+   * \brief Get the frame preceding a phase or LB iteration
+   *
+   * Frames are ordered as they are rendered: each phase is followed by its LB
+   * iterations, then by the next phase.
+   *
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration
+   *
+   * \return the previous phase and LB iteration, if any
+   */
+  std::optional<std::pair<PhaseType, LBIterationType>>
+  getPreviousFrame(PhaseType phase, LBIterationType lb_iter) const {
+    auto const& phase_work = getRank(0).getPhaseWork();
+    if (lb_iter != no_lb_iter) {
+      auto const& lb_iters = phase_work.at(phase).getLBIterations();
+      auto it = lb_iters.find(lb_iter);
+      if (it == lb_iters.end()) {
+        throw std::runtime_error(
+          "LB iteration " + std::to_string(lb_iter) +
+          " doesn't exist for phase " + std::to_string(phase));
+      }
+      if (it == lb_iters.begin()) {
+        return std::make_pair(phase, no_lb_iter);
+      }
+      return std::make_pair(phase, std::prev(it)->first);
+    }
+
+    if (phase == 0) {
+      return std::nullopt;
+    }
+    auto it = phase_work.find(phase - 1);
+    if (it == phase_work.end()) {
+      return std::nullopt;
+    }
+    auto const& lb_iters = it->second.getLBIterations();
+    return std::make_pair(
+      phase - 1, lb_iters.empty() ? no_lb_iter : lb_iters.rbegin()->first);
+  }
+
+  /**
+   * \brief Compute the migrations between two frames
+   *
+   * The ranks of all objects in the earlier frame are indexed once, then each
+   * object of the later frame is looked up: the diff takes linear time in the
+   * number of objects.
+   *
+   * \param[in] from_phase the phase of the earlier frame
+   * \param[in] from_lb_iter the LB iteration of the earlier frame
+   * \param[in] to_phase the phase of the later frame
+   * \param[in] to_lb_iter the LB iteration of the later frame
+   *
+   * \return the migrations
+   */
+  MigrationDiff computeMigrationDiff(
+    PhaseType from_phase, LBIterationType from_lb_iter,
+    PhaseType to_phase, LBIterationType to_lb_iter
+  ) const {
+    uint64_t const n_ranks = ranks_.size();
+    MigrationDiff diff;
+    diff.n_in.assign(n_ranks, 0);
+    diff.n_out.assign(n_ranks, 0);
+    diff.load_in.assign(n_ranks, 0.0);
+    diff.load_out.assign(n_ranks, 0.0);
+
+    std::unordered_map<ElementIDType, NodeType> object_location;
+    for (NodeType rank_id = 0; rank_id < static_cast<NodeType>(n_ranks);
+         rank_id++) {
+      auto const& objects = getWorkDistribution(
+        getRank(rank_id), from_phase, from_lb_iter).getObjectWork();
+      object_location.reserve(object_location.size() + objects.size());
+      for (auto const& [obj_id, obj_work] : objects) {
+        object_location.emplace(obj_id, rank_id);
+      }
+    }
+
+    for (NodeType rank_id = 0; rank_id < static_cast<NodeType>(n_ranks);
+         rank_id++) {
+      auto const& objects = getWorkDistribution(
+        getRank(rank_id), to_phase, to_lb_iter).getObjectWork();
+      std::size_t const rank_begin = diff.migrations.size();
+      for (auto const& [obj_id, obj_work] : objects) {
+        auto it = object_location.find(obj_id);
+        if (it == object_location.end() || it->second == rank_id) {
+          continue;
+        }
+        diff.migrations.push_back(
+          Migration{obj_id, it->second, rank_id, obj_work.getLoad()});
+        diff.n_in[rank_id]++;
+        diff.n_out[it->second]++;
+        diff.load_in[rank_id] += obj_work.getLoad();
+        diff.load_out[it->second] += obj_work.getLoad();
+      }
+      std::sort(
+        diff.migrations.begin() + rank_begin, diff.migrations.end(),
+        [](Migration const& a, Migration const& b) {
+          return a.object < b.object;
+        });
+    }
+    return diff;
+  }
+
+  /**
+   * \brief Get the migrations from the previous frame to a frame
+   *
+   * Diffs are computed once per frame. The first frame has no migrations.
+   *
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration
+   *
+   * \return the migrations
+   */
+  std::shared_ptr<MigrationDiff const>
+  getMigrationDiff(PhaseType phase, LBIterationType lb_iter) const {
+    return migration_diffs_.get(phase, lb_iter, [&] {
+      if (auto previous = getPreviousFrame(phase, lb_iter)) {
+        return computeMigrationDiff(
+          previous->first, previous->second, phase, lb_iter);
+      }
+      // Compared with itself, the first frame has no migrations
+      return computeMigrationDiff(phase, lb_iter, phase, lb_iter);
+    });
+  }
+
+  /**
+   * \brief Get the catalog of the QOI keys of the data
+   *
+   * The catalog is computed once, by the first call, and again after ranks
+   * are added.
+   *
+   * \return the catalog
+   */
+  std::shared_ptr<QOICatalog const> getQOICatalog() const {
+    return qoi_catalog_.get([&] { return computeQOICatalog(); });
+  }
+
+  /**
+   * \brief Compute the catalog of the QOI keys of the data, visiting every
+   * phase and LB iteration of every rank
+   *
+   * \return the catalog
+   */
+  QOICatalog computeQOICatalog() const {
+    auto addKeys = [](
+      QOIKeyMap& keys,
+      std::unordered_map<std::string, QOIVariantTypes> const& values,
+      std::optional<std::pair<PhaseType, LBIterationType>> frame) {
+      for (auto const& [key, value] : values) {
+        auto& key_info = keys[key];
+        key_info.add(value);
+        if (frame) {
+          key_info.frames.insert(*frame);
+        }
+      }
+    };
+
+    // Ranks are visited independently, then merged in order of their IDs
+    std::vector<Rank const*> ranks;
+    for (auto const& [rank_id, rank] : ranks_) {
+      ranks.push_back(&rank);
+    }
+    std::sort(ranks.begin(), ranks.end(), [](auto const* a, auto const* b) {
+      return a->getRankID() < b->getRankID();
+    });
+    std::vector<QOICatalog> rank_catalogs(ranks.size());
+    utility::parallelFor(ranks.size(), [&](uint64_t r) {
+      auto& catalog = rank_catalogs[r];
+      auto addWork = [&](
+        WorkDistribution const& work, PhaseType phase,
+        LBIterationType lb_iter) {
+        std::pair<PhaseType, LBIterationType> const frame{phase, lb_iter};
+        addKeys(catalog.rank_user_defined, work.getUserDefined(), frame);
+        for (auto const& [obj_id, obj_work] : work.getObjectWork()) {
+          addKeys(
+            catalog.object_user_defined, obj_work.getUserDefined(), frame);
+          addKeys(catalog.object_attributes, obj_work.getAttributes(), frame);
+        }
+      };
+
+      addKeys(catalog.rank_attributes, ranks[r]->getAttributes(), std::nullopt);
+      for (auto const& [phase, phase_work] : ranks[r]->getPhaseWork()) {
+        addWork(phase_work, phase, no_lb_iter);
+        for (auto const& [lb_iter_id, lb_iter] :
+             phase_work.getLBIterations()) {
+          addWork(lb_iter, phase, lb_iter_id);
+        }
+      }
+    });
+
+    QOICatalog catalog;
+    for (auto const& rank_catalog : rank_catalogs) {
+      catalog.merge(rank_catalog);
+    }
+    return catalog;
+  }
+
+  /**
+   * \brief Get the summary of all frames attached to the data
+   *
+   * \return the summary, or \c nullptr when none is attached
+   */
+  std::shared_ptr<PhaseSummary const> const& getPhaseSummary() const {
+    return phase_summary_;
+  }
+
+  /**
+   * \brief Attach a summary of all frames to the data, until ranks are added
+   *
+   * \param[in] summary the summary, computed from this data
+   */
+  void setPhaseSummary(std::shared_ptr<PhaseSummary const> summary) {
+    phase_summary_ = std::move(summary);
+  }
+
+  /**
+   * \brief Compute the summary of all frames: the built-in and numerical
+   * user-defined QOIs of each rank, and the range of the built-in, numerical
+   * user-defined and attribute QOIs of objects
+   *
+   * Volumes are those of the edges as they are: normalize the edges of all
+   * phases first to summarize them as they are rendered. Migration QOIs and
+   * rank attributes are not summarized.
+   *
+   * \return the summary
+   */
+  PhaseSummary computePhaseSummary() const {
+    PhaseSummary summary;
+    summary.n_ranks = ranks_.size();
+    summary.n_phases = getNumPhases();
+    if (ranks_.empty()) {
+      return summary;
+    }
+    // Keys of values which are strings somewhere cannot be summarized
+    auto const catalog = getQOICatalog();
+    auto numericKeys = [](QOIKeyMap const& keys) {
+      std::set<std::string> numeric, other;
+      for (auto const& [key, key_info] : keys) {
+        (key_info.isNumeric() ? numeric : other).insert(key);
+      }
+      return std::make_pair(numeric, other);
+    };
+    std::set<std::string> rank_keys, rank_excluded;
+    std::tie(rank_keys, rank_excluded) =
+      numericKeys(catalog->rank_user_defined);
+    std::set<std::string> object_keys = {
+      "load", "received_volume", "sent_volume", "max_volume", "id", "rank_id"};
+    std::set<std::string> object_excluded;
+    for (auto const* keys :
+         {&catalog->object_user_defined, &catalog->object_attributes}) {
+      auto [numeric, other] = numericKeys(*keys);
+      object_keys.insert(numeric.begin(), numeric.end());
+      object_excluded.insert(other.begin(), other.end());
+    }
+    for (auto const& key : object_excluded) {
+      object_keys.erase(key);
+    }
+    using ObjectGetter = std::function<double(ObjectWork const&)>;
+    std::vector<std::pair<std::string, ObjectGetter>> object_getters;
+    for (auto const& key : object_keys) {
+      object_getters.emplace_back(key, nullptr);
+    }
+    for (auto& [key, getter] : object_getters) {
+      getter = getObjectQOIGetter<double>(key);
+    }
+
+    struct RankPart {
+      std::map<std::string, double> rank_qois;
+      std::map<std::string, QOIRangeSummary> object_qois;
+      std::set<std::string> missing;
+      double max_object_load = 0.0;
+      double max_object_volume = 0.0;
+    };
+
+    auto const& phase_work = getRank(0).getPhaseWork();
+    for (PhaseType phase = 0; phase < summary.n_phases; phase++) {
+      std::vector<LBIterationType> lb_iters = {no_lb_iter};
+      for (auto const& [lb_iter, _] : phase_work.at(phase).getLBIterations()) {
+        lb_iters.push_back(lb_iter);
+      }
+      for (auto const lb_iter : lb_iters) {
+        std::vector<RankPart> parts(summary.n_ranks);
+        utility::parallelFor(summary.n_ranks, [&](uint64_t rank_id) {
+          auto& part = parts[rank_id];
+          auto const& rank = getRank(static_cast<NodeType>(rank_id));
+          auto const& work = getWorkDistribution(rank, phase, lb_iter);
+
+          double received = 0.0, sent = 0.0;
+          double migratable_load = 0.0, sentinel_load = 0.0;
+          int n_migratable = 0;
+          for (auto const& [obj_id, obj_work] : work.getObjectWork()) {
+            auto const& obj_info = object_info_.at(obj_id);
+            received += obj_work.getReceivedVolume();
+            sent += obj_work.getSentVolume();
+            if (obj_info.isMigratable()) {
+              n_migratable++;
+              migratable_load += obj_work.getLoad();
+            }
+            if (obj_info.isSentinel()) {
+              sentinel_load += obj_work.getLoad();
+            }
+            part.max_object_load =
+              std::max(part.max_object_load, obj_work.getLoad());
+            part.max_object_volume =
+              std::max(part.max_object_volume, obj_work.getMaxVolume());
+
+            // As in getObjectQOI: numerical user-defined values come first
+            auto const& ud = obj_work.getUserDefined();
+            for (auto const& [key, getter] : object_getters) {
+              if (part.missing.count(key) != 0) {
+                continue;
+              }
+              auto iter = ud.find(key);
+              try {
+                part.object_qois[key].add(
+                  iter != ud.end() and
+                      not std::holds_alternative<std::string>(iter->second) ?
+                    convertQOIVariantTypeToT_<double>(iter->second) :
+                    getter(obj_work));
+              } catch (std::exception const&) {
+                part.missing.insert(key);
+              }
+            }
+          }
+
+          // Rank QOIs are computed as their getters do, without copying ranks
+          auto& rank_qois = part.rank_qois;
+          rank_qois["load"] = rank.getLoad(phase, lb_iter);
+          rank_qois["received_volume"] = received;
+          rank_qois["sent_volume"] = sent;
+          rank_qois["number_of_objects"] =
+            static_cast<double>(work.getObjectWork().size());
+          rank_qois["number_of_migratable_objects"] = n_migratable;
+          rank_qois["migratable_load"] = migratable_load;
+          rank_qois["sentinel_load"] = sentinel_load;
+          rank_qois["id"] = rank.getRankID();
+          auto const& rank_ud = work.getUserDefined();
+          for (auto const& key : rank_keys) {
+            if (auto iter = rank_ud.find(key); iter != rank_ud.end()) {
+              rank_qois[key] = convertQOIVariantTypeToT_<double>(iter->second);
+            } else {
+              part.missing.insert(key);
+            }
+          }
+        });
+
+        // Ranks are merged in order of their IDs
+        FrameSummary frame;
+        frame.phase = phase;
+        frame.lb_iter = lb_iter;
+        std::set<std::string> missing(rank_excluded);
+        for (auto const& part : parts) {
+          missing.insert(part.missing.begin(), part.missing.end());
+        }
+        for (auto const& key : object_keys) {
+          if (missing.count(key) == 0) {
+            frame.object_qois[key];
+          }
+        }
+        for (auto const& part : parts) {
+          frame.max_object_load =
+            std::max(frame.max_object_load, part.max_object_load);
+          frame.max_object_volume =
+            std::max(frame.max_object_volume, part.max_object_volume);
+          for (auto const& [key, value] : part.rank_qois) {
+            if (missing.count(key) == 0) {
+              frame.rank_qois[key].push_back(value);
+            }
+          }
+          for (auto const& [key, range] : part.object_qois) {
+            if (missing.count(key) == 0) {
+              frame.object_qois[key].merge(range);
+            }
+          }
+        }
+        summary.frames.push_back(std::move(frame));
+      }
+    }
+    return summary;
+  }
+
   /* ------------------- Object QOI getters ------------------- */
 
   /**
@@ -830,7 +1301,7 @@ struct Info {
    *
    * \return the id
    */
-  QOIVariantTypes getObjectID(ObjectWork object) const {
+  QOIVariantTypes getObjectID(ObjectWork const& object) const {
     return static_cast<int>(object.getID());
   }
 
@@ -841,9 +1312,9 @@ struct Info {
    *
    * \return the rank id
    */
-  QOIVariantTypes getObjectRankID(ObjectWork object) const {
+  QOIVariantTypes getObjectRankID(ObjectWork const& object) const {
     auto obj_id = object.getID();
-    auto obj_info = object_info_.at(obj_id);
+    auto const& obj_info = object_info_.at(obj_id);
     return obj_info.getHome();
   }
 
@@ -854,7 +1325,7 @@ struct Info {
    *
    * \return the load
    */
-  QOIVariantTypes getObjectLoad(ObjectWork object) const {
+  QOIVariantTypes getObjectLoad(ObjectWork const& object) const {
     return object.getLoad();
   }
 
@@ -865,7 +1336,7 @@ struct Info {
    *
    * \return the received volume
    */
-  QOIVariantTypes getObjectReceivedVolume(ObjectWork object) const {
+  QOIVariantTypes getObjectReceivedVolume(ObjectWork const& object) const {
     return object.getReceivedVolume();
   }
 
@@ -876,7 +1347,7 @@ struct Info {
     *
     * \return the sent volume
     */
-  QOIVariantTypes getObjectSentVolume(ObjectWork object) const {
+  QOIVariantTypes getObjectSentVolume(ObjectWork const& object) const {
     return object.getSentVolume();
   }
 
@@ -887,7 +1358,7 @@ struct Info {
     *
     * \return the max volume
     */
-  QOIVariantTypes getObjectMaxVolume(ObjectWork object) const {
+  QOIVariantTypes getObjectMaxVolume(ObjectWork const& object) const {
     return object.getMaxVolume();
   }
 
@@ -899,15 +1370,16 @@ struct Info {
     * \return the requested attribute or user_defined QOI
     */
   QOIVariantTypes getObjectAttributeOrUserDefined(
-    ObjectWork object, std::string object_qoi
+    ObjectWork const& object, std::string const& object_qoi
   ) const {
-    auto obj_attributes = object.getAttributes();
-    if (obj_attributes.count(object_qoi) > 0) {
-      return obj_attributes.at(object_qoi);
+    auto const& obj_attributes = object.getAttributes();
+    if (auto it = obj_attributes.find(object_qoi); it != obj_attributes.end()) {
+      return it->second;
     } else {
-      auto obj_user_defined = object.getUserDefined();
-      if (obj_user_defined.count(object_qoi) > 0) {
-        return obj_user_defined.at(object_qoi);
+      auto const& obj_user_defined = object.getUserDefined();
+      if (auto it2 = obj_user_defined.find(object_qoi);
+          it2 != obj_user_defined.end()) {
+        return it2->second;
       }
     }
     throw std::runtime_error("Invalid Object QOI: " + object_qoi);
@@ -958,23 +1430,8 @@ struct Info {
    * \return whether it exists
    */
   bool hasRankUserDefined(std::string const& key) const {
-    for (auto const& [id, rank] : ranks_) {
-      auto const num_phases = rank.getNumPhases();
-      for (std::size_t i = 0; i < num_phases; i++) {
-        auto const& ud = rank.getPhaseWork().at(i).getUserDefined();
-        if (auto iter = ud.find(key); iter != ud.end()) {
-          return true;
-        }
-        auto const& lb_iters = rank.getPhaseWork().at(i).getLBIterations();
-        for (auto const& [_, lb_iter] : lb_iters) {
-          auto const& ud2 = lb_iter.getUserDefined();
-          if (auto iter = ud2.find(key); iter != ud2.end()) {
-            return true;
-          }
-        }
-      }
-    }
-    return false;
+    return QOICatalog::find(getQOICatalog()->rank_user_defined, key) !=
+      nullptr;
   }
 
   /**
@@ -1215,6 +1672,18 @@ private:
 
   /// The current phase (or indication to use all phases)
   PhaseType selected_phase_ = std::numeric_limits<PhaseType>::max();
+
+  /// Migrations of each frame from the previous one, computed on demand
+  mutable MigrationDiffCache migration_diffs_;
+
+  /// Phases whose communication edges are normalized
+  std::set<PhaseType> normalized_phases_;
+
+  /// The catalog of the QOI keys, computed on demand
+  mutable QOICatalogCache qoi_catalog_;
+
+  /// The summary of all frames, when one is attached
+  std::shared_ptr<PhaseSummary const> phase_summary_;
 };
 
 } /* end namespace vt::tv */
@@ -0,0 +1,147 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               migration_diff.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_API_MIGRATION_DIFF_H
+#define INCLUDED_VT_TV_API_MIGRATION_DIFF_H
+
+#include "vt-tv/api/types.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace vt::tv {
+
+/**
+ * \struct Migration
+ *
+ * \brief An object that changed rank between two frames
+ */
+struct Migration {
+  /// The object ID
+  ElementIDType object = 0;
+  /// The rank of the object in the earlier frame
+  NodeType from_rank = 0;
+  /// The rank of the object in the later frame
+  NodeType to_rank = 0;
+  /// The load of the object in the later frame
+  TimeType load = 0.0;
+};
+
+/**
+ * \struct MigrationDiff
+ *
+ * \brief The migrations between two frames (phases or LB iterations), with
+ * their counts and loads per rank
+ *
+ * Per-rank vectors are indexed by rank ID. Objects that only exist in one of
+ * the frames have not migrated and are left out.
+ */
+struct MigrationDiff {
+  /// Migrations, ordered by destination rank then by object ID
+  std::vector<Migration> migrations;
+  /// Number of objects arriving on and leaving each rank
+  std::vector<int> n_in, n_out;
+  /// Load of the objects arriving on and leaving each rank
+  std::vector<double> load_in, load_out;
+};
+
+/**
+ * \struct MigrationDiffCache
+ *
+ * \brief Migration diffs already computed for frames, shared between threads
+ *
+ * Copies start empty, since cached diffs describe the data they were computed
+ * from.
+ */
+struct MigrationDiffCache {
+  MigrationDiffCache() = default;
+  MigrationDiffCache(MigrationDiffCache const&) { }
+  MigrationDiffCache& operator=(MigrationDiffCache const&) {
+    clear();
+    return *this;
+  }
+
+  /**
+   * \brief Get the diff of a frame, computing it once
+   *
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration
+   * \param[in] compute the function computing the diff
+   *
+   * \return the diff
+   */
+  template <typename Callable>
+  std::shared_ptr<MigrationDiff const>
+  get(PhaseType phase, LBIterationType lb_iter, Callable&& compute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& diff = diffs_[{phase, lb_iter}];
+    if (!diff) {
+      diff = std::make_shared<MigrationDiff const>(compute());
+    }
+    return diff;
+  }
+
+  /**
+   * \brief Drop all diffs
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    diffs_.clear();
+  }
+
+private:
+  /// Guard of the diffs
+  std::mutex mutex_;
+  /// Diffs with their previous frame, by frame
+  std::map<
+    std::pair<PhaseType, LBIterationType>,
+    std::shared_ptr<MigrationDiff const>>
+    diffs_;
+};
+
+} /* end namespace vt::tv */
+
+#endif /*INCLUDED_VT_TV_API_MIGRATION_DIFF_H*/
@@ -53,6 +53,7 @@
 #include <utility>
 
 #include "vt-tv/api/types.h"
+#include "vt-tv/utility/log.h"
 #include <fmt-vt/format.h>
 
 namespace vt::tv {
@@ -63,6 +64,9 @@ struct Object;
  * \struct ObjectCommunicator
  *
  * \brief A class holding received and sent messages for an object.
+ *
+ * Each edge is a communication record of the data, which may stand for
+ * several messages: their number is kept for each peer object.
  */
 struct ObjectCommunicator {
   ObjectCommunicator() = default;
@@ -87,7 +91,14 @@ struct ObjectCommunicator {
     std::multimap<ElementIDType, double> sent_in)
     : object_id_(id_in),
       received_(recv_in),
-      sent_(sent_in) { }
+      sent_(sent_in) {
+    for (auto const& [from_id, bytes] : received_) {
+      received_messages_[from_id]++;
+    }
+    for (auto const& [to_id, bytes] : sent_) {
+      sent_messages_[to_id]++;
+    }
+  }
 
   /**
    * \brief Get the id of object for this communicator
@@ -99,7 +110,7 @@ struct ObjectCommunicator {
   /**
    * \brief Return all from_object=volume pairs received by object.
    */
-  std::multimap<ElementIDType, double> getReceived() const {
+  std::multimap<ElementIDType, double> const& getReceived() const {
     return this->received_;
   };
 
@@ -120,7 +131,9 @@ struct ObjectCommunicator {
   /**
    * \brief Return all to_object=volume pairs sent from object.
    */
-  std::multimap<ElementIDType, double> getSent() const { return this->sent_; };
+  std::multimap<ElementIDType, double> const& getSent() const {
+    return this->sent_;
+  };
 
   /**
    * \brief Return all volumes of messages sent to an object if any.
@@ -136,17 +149,35 @@ struct ObjectCommunicator {
     return results;
   }
 
+  /**
+   * \brief Return the number of messages received from each object
+   */
+  std::map<ElementIDType, uint64_t> const& getReceivedMessages() const {
+    return this->received_messages_;
+  }
+
+  /**
+   * \brief Return the number of messages sent to each object
+   */
+  std::map<ElementIDType, uint64_t> const& getSentMessages() const {
+    return this->sent_messages_;
+  }
+
   /**
    * \brief Add received edge
    *
    * \param[in] from_id the from object id
    * \param[in] bytes the number of bytes
+   * \param[in] messages the number of messages of the edge
    */
-  void addReceived(ElementIDType from_id, double bytes) {
+  void
+  addReceived(ElementIDType from_id, double bytes, uint64_t messages = 1) {
     this->received_.insert(std::make_pair(from_id, bytes));
+    this->received_messages_[from_id] += messages;
     if (from_id == this->object_id_) {
-      fmt::print(
-        "Object {} receiving communication from myself\n", this->object_id_);
+      VT_TV_LOG_LIMITED(
+        Model, Debug, 10, "Object {} receiving communication from myself",
+        this->object_id_);
     }
   }
 
@@ -155,12 +186,15 @@ struct ObjectCommunicator {
    *
    * \param[in] to_id the to object id
    * \param[in] bytes the number of bytes
+   * \param[in] messages the number of messages of the edge
    */
-  void addSent(ElementIDType to_id, double bytes) {
+  void addSent(ElementIDType to_id, double bytes, uint64_t messages = 1) {
     this->sent_.insert(std::make_pair(to_id, bytes));
+    this->sent_messages_[to_id] += messages;
     if (to_id == this->object_id_) {
-      fmt::print(
-        "Object {} sending communication to myself\n", this->object_id_);
+      VT_TV_LOG_LIMITED(
+        Model, Debug, 10, "Object {} sending communication to myself",
+        this->object_id_);
     }
   }
 
@@ -215,6 +249,32 @@ struct ObjectCommunicator {
     return total;
   }
 
+  /**
+   * \brief Get the total number of messages received by this communicator
+   *
+   * \return total number of received messages
+   */
+  uint64_t getTotalReceivedMessages() const {
+    uint64_t total = 0;
+    for (const auto& [key, value] : this->received_messages_) {
+      total += value;
+    }
+    return total;
+  }
+
+  /**
+   * \brief Get the total number of messages sent by this communicator
+   *
+   * \return total number of sent messages
+   */
+  uint64_t getTotalSentMessages() const {
+    uint64_t total = 0;
+    for (const auto& [key, value] : this->sent_messages_) {
+      total += value;
+    }
+    return total;
+  }
+
   /**
    * \brief Serializer for data
    *
@@ -225,12 +285,18 @@ struct ObjectCommunicator {
     s | object_id_;
     s | received_;
     s | sent_;
+    s | received_messages_;
+    s | sent_messages_;
   }
 
 private:
   ElementIDType object_id_;                       /**< The object id */
   std::multimap<ElementIDType, double> received_; /**< The received edges */
   std::multimap<ElementIDType, double> sent_;     /**< The sent edges */
+  /// The number of messages received from each object
+  std::map<ElementIDType, uint64_t> received_messages_;
+  /// The number of messages sent to each object
+  std::map<ElementIDType, uint64_t> sent_messages_;
 };
 
 } /* end namespace vt::tv */
@@ -131,35 +131,59 @@ struct ObjectWork {
   /**
    * \brief add sent communication to this object
    *
+   * \param[in] to_id the to object id
+   * \param[in] bytes the number of bytes
+   * \param[in] messages the number of messages of the communication
+   *
    * \return void
    */
-  void addSentCommunications(ElementIDType to_id, double bytes) {
-    communicator_.addSent(to_id, bytes);
+  void addSentCommunications(
+    ElementIDType to_id, double bytes, uint64_t messages = 1) {
+    communicator_.addSent(to_id, bytes, messages);
   };
 
   /**
    * \brief add received communication to this object
    *
+   * \param[in] from_id the from object id
+   * \param[in] bytes the number of bytes
+   * \param[in] messages the number of messages of the communication
+   *
    * \return void
    */
-  void addReceivedCommunications(ElementIDType from_id, double bytes) {
-    communicator_.addReceived(from_id, bytes);
+  void addReceivedCommunications(
+    ElementIDType from_id, double bytes, uint64_t messages = 1) {
+    communicator_.addReceived(from_id, bytes, messages);
   };
 
   /**
    * \brief get received communications for this object
    */
-  std::multimap<ElementIDType, double> getReceived() const {
+  std::multimap<ElementIDType, double> const& getReceived() const {
     return communicator_.getReceived();
   }
 
   /**
    * \brief get sent communications for this object
    */
-  std::multimap<ElementIDType, double> getSent() const {
+  std::multimap<ElementIDType, double> const& getSent() const {
     return communicator_.getSent();
   }
 
+  /**
+   * \brief get the number of messages received from each object
+   */
+  std::map<ElementIDType, uint64_t> const& getReceivedMessages() const {
+    return communicator_.getReceivedMessages();
+  }
+
+  /**
+   * \brief get the number of messages sent to each object
+   */
+  std::map<ElementIDType, uint64_t> const& getSentMessages() const {
+    return communicator_.getSentMessages();
+  }
+
   /**
    * \brief Get maximum bytes received or sent at this object
    */
@@ -181,6 +205,24 @@ struct ObjectWork {
    */
   double getSentVolume() const { return communicator_.getTotalSentVolume(); }
 
+  /**
+   * \brief Get the total number of messages received by this object
+   *
+   * \return total number of received messages
+   */
+  uint64_t getNumReceivedMessages() const {
+    return communicator_.getTotalReceivedMessages();
+  }
+
+  /**
+   * \brief Get the total number of messages sent by this object
+   *
+   * \return total number of sent messages
+   */
+  uint64_t getNumSentMessages() const {
+    return communicator_.getTotalSentMessages();
+  }
+
   /**
    * \brief Serializer for data
    *
@@ -0,0 +1,259 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               phase_summary.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_API_PHASE_SUMMARY_H
+#define INCLUDED_VT_TV_API_PHASE_SUMMARY_H
+
+#include "vt-tv/api/types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vt::tv {
+
+/**
+ * \struct QOIRangeSummary
+ *
+ * \brief The range of the values of a QOI and, while they are few, their
+ * distinct values
+ */
+struct QOIRangeSummary {
+  /// The largest number of distinct values kept, beyond which a QOI is
+  /// continuous, as when coloring objects
+  static constexpr std::size_t max_support = 20;
+
+  /// The smallest value, or +infinity when there is none
+  double min = std::numeric_limits<double>::infinity();
+  /// The largest value, or -infinity when there is none
+  double max = -std::numeric_limits<double>::infinity();
+  /// The distinct values, empty once continuous
+  std::set<double> support;
+  /// Whether there are more than \c max_support distinct values
+  bool continuous = false;
+
+  /**
+   * \brief Account for a value
+   *
+   * \param[in] value the value
+   */
+  void add(double value) {
+    min = std::min(min, value);
+    max = std::max(max, value);
+    if (not continuous) {
+      support.insert(value);
+      checkSupport();
+    }
+  }
+
+  /**
+   * \brief Account for the values of another part of the data
+   *
+   * \param[in] other the range of the other values
+   */
+  void merge(QOIRangeSummary const& other) {
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    continuous = continuous or other.continuous;
+    if (not continuous) {
+      support.insert(other.support.begin(), other.support.end());
+    }
+    checkSupport();
+  }
+
+private:
+  void checkSupport() {
+    if (continuous or support.size() > max_support) {
+      support.clear();
+      continuous = true;
+    }
+  }
+};
+
+/**
+ * \struct FrameSummary
+ *
+ * \brief Aggregates of a phase or LB iteration: the QOIs of each rank and
+ * the ranges of the object QOIs
+ */
+struct FrameSummary {
+  PhaseType phase = 0;                  /**< The phase */
+  LBIterationType lb_iter = no_lb_iter; /**< The LB iteration, if any */
+  double max_object_load = 0.0;         /**< Largest object load, or 0 */
+  double max_object_volume = 0.0;       /**< Largest object volume, or 0 */
+  /// The value of each rank QOI on each rank, in order of rank IDs
+  std::map<std::string, std::vector<double>> rank_qois;
+  /// The range of each object QOI over all objects of the frame
+  std::map<std::string, QOIRangeSummary> object_qois;
+};
+
+/**
+ * \struct PhaseSummary
+ *
+ * \brief The aggregates of all frames of the data, from which color ranges
+ * and maxima are derived without visiting any object
+ *
+ * Frames are in rendering order: each phase followed by its LB iterations.
+ * A QOI is summarized only when every rank or object of every frame has a
+ * numerical value for it.
+ */
+struct PhaseSummary {
+  uint64_t n_ranks = 0;             /**< The number of ranks */
+  PhaseType n_phases = 0;           /**< The number of phases */
+  std::vector<FrameSummary> frames; /**< The frames, in order */
+
+  /**
+   * \brief Get the frames of a phase
+   *
+   * \param[in] selected_phase the phase, or all phases when set to the
+   * maximum phase value
+   *
+   * \return the frames
+   */
+  std::vector<FrameSummary const*> getFrames(PhaseType selected_phase) const {
+    std::vector<FrameSummary const*> selected;
+    for (auto const& frame : frames) {
+      if (
+        selected_phase == std::numeric_limits<PhaseType>::max() or
+        frame.phase == selected_phase) {
+        selected.push_back(&frame);
+      }
+    }
+    return selected;
+  }
+
+  /**
+   * \brief Get the range of an object QOI
+   *
+   * \param[in] key the QOI
+   * \param[in] selected_phase the phase, or all phases when set to the
+   * maximum phase value
+   *
+   * \return the range, or nothing when a frame does not summarize the QOI
+   */
+  std::optional<QOIRangeSummary> getObjectQOIRange(
+    std::string const& key, PhaseType selected_phase) const {
+    auto const selected = getFrames(selected_phase);
+    if (selected.empty()) {
+      return std::nullopt;
+    }
+    QOIRangeSummary range;
+    for (auto const* frame : selected) {
+      auto const iter = frame->object_qois.find(key);
+      if (iter == frame->object_qois.end()) {
+        return std::nullopt;
+      }
+      range.merge(iter->second);
+    }
+    return range;
+  }
+
+  /**
+   * \brief Get the range of a rank QOI over all ranks and frames
+   *
+   * \param[in] key the QOI
+   *
+   * \return the range, or nothing when a frame does not summarize the QOI
+   */
+  std::optional<std::pair<double, double>>
+  getRankQOIRange(std::string const& key) const {
+    if (frames.empty()) {
+      return std::nullopt;
+    }
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    for (auto const& frame : frames) {
+      auto const iter = frame.rank_qois.find(key);
+      if (iter == frame.rank_qois.end()) {
+        return std::nullopt;
+      }
+      for (double value : iter->second) {
+        min = std::min(min, value);
+        max = std::max(max, value);
+      }
+    }
+    return std::make_pair(min, max);
+  }
+
+  /**
+   * \brief Get the largest object load
+   *
+   * \param[in] selected_phase the phase, or all phases when set to the
+   * maximum phase value
+   *
+   * \return the largest load, or 0
+   */
+  double getMaxObjectLoad(PhaseType selected_phase) const {
+    double max = 0.0;
+    for (auto const* frame : getFrames(selected_phase)) {
+      max = std::max(max, frame->max_object_load);
+    }
+    return max;
+  }
+
+  /**
+   * \brief Get the largest object communication volume
+   *
+   * \param[in] selected_phase the phase, or all phases when set to the
+   * maximum phase value
+   *
+   * \return the largest volume, or 0
+   */
+  double getMaxObjectVolume(PhaseType selected_phase) const {
+    double max = 0.0;
+    for (auto const* frame : getFrames(selected_phase)) {
+      max = std::max(max, frame->max_object_volume);
+    }
+    return max;
+  }
+};
+
+} /* end namespace vt::tv */
+
+#endif /*INCLUDED_VT_TV_API_PHASE_SUMMARY_H*/
@@ -118,8 +118,9 @@ struct WorkDistribution {
    * \return void
    */
   void addObjectReceivedCommunication(
-    ElementIDType o_id, ElementIDType from_id, double bytes) {
-    objects_.at(o_id).addReceivedCommunications(from_id, bytes);
+    ElementIDType o_id, ElementIDType from_id, double bytes,
+    uint64_t messages = 1) {
+    objects_.at(o_id).addReceivedCommunications(from_id, bytes, messages);
   };
 
   /**
@@ -128,8 +129,9 @@ struct WorkDistribution {
    * \return void
    */
   void addObjectSentCommunication(
-    ElementIDType o_id, ElementIDType to_id, double bytes) {
-    objects_.at(o_id).addSentCommunications(to_id, bytes);
+    ElementIDType o_id, ElementIDType to_id, double bytes,
+    uint64_t messages = 1) {
+    objects_.at(o_id).addSentCommunications(to_id, bytes, messages);
   };
 
   /**
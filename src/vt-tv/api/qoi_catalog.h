@@ -0,0 +1,289 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                qoi_catalog.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_API_QOI_CATALOG_H
+#define INCLUDED_VT_TV_API_QOI_CATALOG_H
+
+#include "vt-tv/api/types.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace vt::tv {
+
+/**
+ * \enum QOIValueType
+ *
+ * \brief The type of the values of a QOI key across the data
+ */
+enum struct QOIValueType : uint8_t {
+  Int = 0,    /**< Only integers */
+  Double = 1, /**< Numbers, at least one of them a double */
+  String = 2, /**< Only strings */
+  Mixed = 3   /**< Both strings and numbers */
+};
+
+/**
+ * \struct QOIKeyInfo
+ *
+ * \brief What is known of a QOI key: the type of its values, the frames
+ * holding it and the range of its numerical values
+ */
+struct QOIKeyInfo {
+  /// The type of all values
+  QOIValueType type = QOIValueType::Int;
+  /// The number of values
+  uint64_t count = 0;
+  /// The smallest numerical value, or +infinity when there is none
+  double min = std::numeric_limits<double>::infinity();
+  /// The largest numerical value, or -infinity when there is none
+  double max = -std::numeric_limits<double>::infinity();
+  /// The frames (phase, LB iteration) holding the key, empty for rank
+  /// attributes, which do not depend on the phase
+  std::set<std::pair<PhaseType, LBIterationType>> frames;
+
+  /**
+   * \brief Account for a value of the key
+   *
+   * \param[in] value the value
+   */
+  void add(QOIVariantTypes const& value) {
+    QOIValueType value_type = QOIValueType::String;
+    if (auto const* i = std::get_if<int>(&value)) {
+      value_type = QOIValueType::Int;
+      addNumber(*i);
+    } else if (auto const* d = std::get_if<double>(&value)) {
+      value_type = QOIValueType::Double;
+      addNumber(*d);
+    }
+    type = count == 0 ? value_type : mergeTypes(type, value_type);
+    count++;
+  }
+
+  /**
+   * \brief Account for the values of the same key elsewhere in the data
+   *
+   * \param[in] other the other values
+   */
+  void merge(QOIKeyInfo const& other) {
+    if (other.count == 0) {
+      return;
+    }
+    type = count == 0 ? other.type : mergeTypes(type, other.type);
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    frames.insert(other.frames.begin(), other.frames.end());
+  }
+
+  /**
+   * \brief Whether all values are numbers
+   *
+   * \return whether the key can be drawn
+   */
+  bool isNumeric() const {
+    return type == QOIValueType::Int or type == QOIValueType::Double;
+  }
+
+  /**
+   * \brief Whether a frame holds the key
+   *
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration
+   *
+   * \return whether the key is found in the frame
+   */
+  bool hasFrame(PhaseType phase, LBIterationType lb_iter) const {
+    return frames.find({phase, lb_iter}) != frames.end();
+  }
+
+  /**
+   * \brief Get the phases holding the key, in themselves or in one of their
+   * LB iterations
+   *
+   * \return the phases
+   */
+  std::set<PhaseType> getPhases() const {
+    std::set<PhaseType> phases;
+    for (auto const& frame : frames) {
+      phases.insert(frame.first);
+    }
+    return phases;
+  }
+
+  /**
+   * \brief Get the name of a value type
+   *
+   * \param[in] in_type the value type
+   *
+   * \return "int", "double", "string" or "mixed"
+   */
+  static std::string getTypeName(QOIValueType in_type) {
+    switch (in_type) {
+    case QOIValueType::Int: return "int";
+    case QOIValueType::Double: return "double";
+    case QOIValueType::String: return "string";
+    case QOIValueType::Mixed: return "mixed";
+    }
+    return "mixed";
+  }
+
+private:
+  void addNumber(double value) {
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+
+  static QOIValueType mergeTypes(QOIValueType a, QOIValueType b) {
+    if (a == b) {
+      return a;
+    }
+    bool const a_numeric = a == QOIValueType::Int or a == QOIValueType::Double;
+    bool const b_numeric = b == QOIValueType::Int or b == QOIValueType::Double;
+    return a_numeric and b_numeric ? QOIValueType::Double : QOIValueType::Mixed;
+  }
+};
+
+/// The keys of a kind of QOI, in alphabetical order
+using QOIKeyMap = std::map<std::string, QOIKeyInfo>;
+
+/**
+ * \struct QOICatalog
+ *
+ * \brief Every user-defined and attribute QOI key of the data, with its type,
+ * frames and range
+ */
+struct QOICatalog {
+  QOIKeyMap rank_user_defined;   /**< Keys of the phases of ranks */
+  QOIKeyMap rank_attributes;     /**< Keys of the attributes of ranks */
+  QOIKeyMap object_user_defined; /**< Keys of the user-defined of tasks */
+  QOIKeyMap object_attributes;   /**< Keys of the attributes of tasks */
+
+  /**
+   * \brief Account for the keys of another part of the data
+   *
+   * \param[in] other the catalog of the other part
+   */
+  void merge(QOICatalog const& other) {
+    auto mergeKeys = [](QOIKeyMap& keys, QOIKeyMap const& other_keys) {
+      for (auto const& [key, key_info] : other_keys) {
+        keys[key].merge(key_info);
+      }
+    };
+    mergeKeys(rank_user_defined, other.rank_user_defined);
+    mergeKeys(rank_attributes, other.rank_attributes);
+    mergeKeys(object_user_defined, other.object_user_defined);
+    mergeKeys(object_attributes, other.object_attributes);
+  }
+
+  /**
+   * \brief Find a key
+   *
+   * \param[in] keys the keys of a kind of QOI
+   * \param[in] key the key
+   *
+   * \return the key information, or \c nullptr when the data does not hold it
+   */
+  static QOIKeyInfo const* find(QOIKeyMap const& keys, std::string const& key) {
+    auto const iter = keys.find(key);
+    return iter != keys.end() ? &iter->second : nullptr;
+  }
+};
+
+/**
+ * \struct QOICatalogCache
+ *
+ * \brief The catalog of the data, computed once and shared between threads
+ *
+ * Copies start empty, since the catalog describes the data it was computed
+ * from.
+ */
+struct QOICatalogCache {
+  QOICatalogCache() = default;
+  QOICatalogCache(QOICatalogCache const&) { }
+  QOICatalogCache& operator=(QOICatalogCache const&) {
+    clear();
+    return *this;
+  }
+
+  /**
+   * \brief Get the catalog, computing it once
+   *
+   * \param[in] compute the function computing the catalog
+   *
+   * \return the catalog
+   */
+  template <typename Callable>
+  std::shared_ptr<QOICatalog const> get(Callable&& compute) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!catalog_) {
+      catalog_ = std::make_shared<QOICatalog const>(compute());
+    }
+    return catalog_;
+  }
+
+  /**
+   * \brief Drop the catalog
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    catalog_.reset();
+  }
+
+private:
+  /// Guard of the catalog
+  std::mutex mutex_;
+  /// The catalog, once computed
+  std::shared_ptr<QOICatalog const> catalog_;
+};
+
+} /* end namespace vt::tv */
+
+#endif /*INCLUDED_VT_TV_API_QOI_CATALOG_H*/
@@ -135,9 +135,10 @@ struct Rank {
     PhaseType phase_id,
     ElementIDType o_id,
     ElementIDType from_id,
-    double bytes) {
+    double bytes,
+    uint64_t messages = 1) {
     phase_info_.at(phase_id).addObjectReceivedCommunication(
-      o_id, from_id, bytes);
+      o_id, from_id, bytes, messages);
   };
 
   /**
@@ -146,8 +147,13 @@ struct Rank {
    * \return void
    */
   void addObjectSentCommunicationAtPhase(
-    PhaseType phase_id, ElementIDType o_id, ElementIDType to_id, double bytes) {
-    phase_info_.at(phase_id).addObjectSentCommunication(o_id, to_id, bytes);
+    PhaseType phase_id,
+    ElementIDType o_id,
+    ElementIDType to_id,
+    double bytes,
+    uint64_t messages = 1) {
+    phase_info_.at(phase_id).addObjectSentCommunication(
+      o_id, to_id, bytes, messages);
   };
 
   /**
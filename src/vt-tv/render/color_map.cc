@@ -0,0 +1,315 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 color_map.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/render/color_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace vt::tv {
+
+namespace {
+
+using RGBType = ColorMap::RGBType;
+
+constexpr double pi = 3.14159265358979323846;
+
+// Reference white point (D65) shared by the Lab conversions
+constexpr double ref_x = 0.9505;
+constexpr double ref_y = 1.000;
+constexpr double ref_z = 1.089;
+
+std::array<double, 3> rgbToLab(RGBType const& rgb) {
+  auto linearize = [](double c) {
+    return c > 0.04045 ? std::pow((c + 0.055) / 1.055, 2.4) : c / 12.92;
+  };
+  double const r = linearize(rgb[0]);
+  double const g = linearize(rgb[1]);
+  double const b = linearize(rgb[2]);
+
+  auto f = [](double t) {
+    return t > 0.008856 ? std::cbrt(t) : 7.787 * t + 16.0 / 116.0;
+  };
+  double const fx = f((r * 0.4124 + g * 0.3576 + b * 0.1805) / ref_x);
+  double const fy = f((r * 0.2126 + g * 0.7152 + b * 0.0722) / ref_y);
+  double const fz = f((r * 0.0193 + g * 0.1192 + b * 0.9505) / ref_z);
+  return {116.0 * fy - 16.0, 500.0 * (fx - fy), 200.0 * (fy - fz)};
+}
+
+RGBType labToRGB(std::array<double, 3> const& lab) {
+  double const fy = (lab[0] + 16.0) / 116.0;
+  double const fx = lab[1] / 500.0 + fy;
+  double const fz = fy - lab[2] / 200.0;
+  auto finv = [](double t) {
+    double const t3 = t * t * t;
+    return t3 > 0.008856 ? t3 : (t - 16.0 / 116.0) / 7.787;
+  };
+  double const x = ref_x * finv(fx);
+  double const y = ref_y * finv(fy);
+  double const z = ref_z * finv(fz);
+
+  auto gamma = [](double c) {
+    c = c > 0.0031308 ? 1.055 * std::pow(c, 1.0 / 2.4) - 0.055 : 12.92 * c;
+    return std::clamp(c, 0.0, 1.0);
+  };
+  return {
+    gamma(x * 3.2406 + y * -1.5372 + z * -0.4986),
+    gamma(x * -0.9689 + y * 1.8758 + z * 0.0415),
+    gamma(x * 0.0557 + y * -0.2040 + z * 1.0570)};
+}
+
+std::array<double, 3> labToMsh(std::array<double, 3> const& lab) {
+  double const m =
+    std::sqrt(lab[0] * lab[0] + lab[1] * lab[1] + lab[2] * lab[2]);
+  double const s = m > 0.001 ? std::acos(lab[0] / m) : 0.0;
+  double const h = s > 0.001 ? std::atan2(lab[2], lab[1]) : 0.0;
+  return {m, s, h};
+}
+
+std::array<double, 3> mshToLab(std::array<double, 3> const& msh) {
+  return {
+    msh[0] * std::cos(msh[1]),
+    msh[0] * std::sin(msh[1]) * std::cos(msh[2]),
+    msh[0] * std::sin(msh[1]) * std::sin(msh[2])};
+}
+
+double angleDiff(double a1, double a2) {
+  double diff = std::fabs(a1 - a2);
+  while (diff >= 2.0 * pi) {
+    diff -= 2.0 * pi;
+  }
+  return diff > pi ? 2.0 * pi - diff : diff;
+}
+
+double adjustHue(std::array<double, 3> const& msh, double unsat_m) {
+  if (msh[0] >= unsat_m - 0.1) {
+    return msh[2];
+  }
+  double const spin = msh[1] * std::sqrt(unsat_m * unsat_m - msh[0] * msh[0]) /
+    (msh[0] * std::sin(msh[1]));
+  return msh[2] > -0.3 * pi ? msh[2] + spin : msh[2] - spin;
+}
+
+bool sameValue(std::variant<double, int> const& v, double value) {
+  return std::visit(
+    [value](auto&& val) { return static_cast<double>(val) == value; }, v);
+}
+
+} /* end anonymous namespace */
+
+ColorMap::ColorMap(
+  std::variant<std::pair<double, double>, std::set<std::variant<double, int>>>
+    attribute_range,
+  ColorType ct) {
+  if (std::holds_alternative<std::set<std::variant<double, int>>>(
+        attribute_range)) {
+    // Discrete support is mapped onto the tab20 categorical colors
+    indexed_ = true;
+    int i = 0;
+    for (auto const& v :
+         std::get<std::set<std::variant<double, int>>>(attribute_range)) {
+      indexed_colors_.emplace_back(v, getTab20Color(i));
+      i++;
+    }
+    return;
+  }
+
+  auto const& range = std::get<std::pair<double, double>>(attribute_range);
+  switch (ct) {
+  case ColorType::BlueToRed: {
+    diverging_ = true;
+    double const mid_point = (range.first + range.second) * .5;
+    points_.push_back({range.first, {.231, .298, .753}});
+    points_.push_back({mid_point, {.865, .865, .865}});
+    points_.push_back({range.second, {.906, .016, .109}});
+    below_range_color_ = {0.0, 1.0, 0.0};
+    above_range_color_ = {1.0, 0.0, 1.0};
+    break;
+  }
+  case ColorType::HotSpot: {
+    diverging_ = true;
+    double const mid_point1 = (range.second - range.first) * 0.25;
+    double const mid_point2 = (range.second - range.first) * 0.75;
+    points_.push_back({range.first, {0.0, 0.0, 1.0}});  // Blue
+    points_.push_back({mid_point1, {0.0, 1.0, 0.0}});   // Green
+    points_.push_back({mid_point2, {1.0, 0.8, 0.0}});   // Orange
+    points_.push_back({range.second, {1.0, 0.0, 0.0}}); // Red
+    below_range_color_ = {0.0, 1.0, 1.0};               // Cyan
+    above_range_color_ = {1.0, 1.0, 0.0};               // Yellow
+    break;
+  }
+  case ColorType::WhiteToBlack: {
+    points_.push_back({range.first, {1.0, 1.0, 1.0}});
+    points_.push_back({range.second, {0.0, 0.0, 0.0}});
+    below_range_color_ = {0.0, 0.0, 1.0};
+    above_range_color_ = {1.0, 0.0, 0.0};
+    break;
+  }
+  case ColorType::Default: {
+    double const mid_point = (range.first + range.second) * .5;
+    points_.push_back({range.first, {.431, .761, .161}});
+    points_.push_back({mid_point, {.98, .992, .059}});
+    points_.push_back({range.second, {1.0, .647, 0.0}});
+    below_range_color_ = {0.8, 0.8, .8};
+    above_range_color_ = {1.0, 0.0, 1.0};
+    break;
+  }
+  }
+
+  // Color transfer functions keep their nodes sorted by value
+  std::stable_sort(
+    points_.begin(), points_.end(),
+    [](auto const& a, auto const& b) { return a.first < b.first; });
+}
+
+ColorMap::RGBAType ColorMap::getColor(double value) const {
+  if (std::isnan(value)) {
+    return nan_color_;
+  }
+
+  if (indexed_) {
+    for (auto const& [v, rgb] : indexed_colors_) {
+      if (sameValue(v, value)) {
+        return {rgb[0], rgb[1], rgb[2], 1.0};
+      }
+    }
+    return nan_color_;
+  }
+
+  if (points_.empty()) {
+    return nan_color_;
+  }
+  if (value < points_.front().first) {
+    auto const& c = below_range_color_;
+    return {c[0], c[1], c[2], 1.0};
+  }
+  if (value > points_.back().first) {
+    auto const& c = above_range_color_;
+    return {c[0], c[1], c[2], 1.0};
+  }
+
+  // Locate the enclosing pair of control points
+  auto upper = std::upper_bound(
+    points_.begin(), points_.end(), value,
+    [](double v, auto const& p) { return v < p.first; });
+  if (upper == points_.end()) {
+    auto const& c = points_.back().second;
+    return {c[0], c[1], c[2], 1.0};
+  }
+  auto lower = std::prev(upper);
+  double const width = upper->first - lower->first;
+  double const s = width > 0.0 ? (value - lower->first) / width : 0.0;
+
+  RGBType rgb;
+  if (diverging_) {
+    rgb = interpolateDiverging(s, lower->second, upper->second);
+  } else {
+    for (int d = 0; d < 3; d++) {
+      rgb[d] = (1.0 - s) * lower->second[d] + s * upper->second[d];
+    }
+  }
+  return {rgb[0], rgb[1], rgb[2], 1.0};
+}
+
+/*static*/ ColorMap::RGBType ColorMap::getTab20Color(int index) {
+  static const std::array<RGBType, 20> tab20_cmap = {{
+    {0.12156862745098039, 0.4666666666666667, 0.7058823529411765},
+    {0.6823529411764706, 0.7803921568627451, 0.9098039215686274},
+    {1.0, 0.4980392156862745, 0.054901960784313725},
+    {1.0, 0.7333333333333333, 0.47058823529411764},
+    {0.17254901960784313, 0.6274509803921569, 0.17254901960784313},
+    {0.596078431372549, 0.8745098039215686, 0.5411764705882353},
+    {0.8392156862745098, 0.15294117647058825, 0.1568627450980392},
+    {1.0, 0.596078431372549, 0.5882352941176471},
+    {0.5803921568627451, 0.403921568627451, 0.7411764705882353},
+    {0.7725490196078432, 0.6901960784313725, 0.8352941176470589},
+    {0.5490196078431373, 0.33725490196078434, 0.29411764705882354},
+    {0.7686274509803922, 0.611764705882353, 0.5803921568627451},
+    {0.8901960784313725, 0.4666666666666667, 0.7607843137254902},
+    {0.9686274509803922, 0.7137254901960784, 0.8235294117647058},
+    {0.4980392156862745, 0.4980392156862745, 0.4980392156862745},
+    {0.7803921568627451, 0.7803921568627451, 0.7803921568627451},
+    {0.7372549019607844, 0.7411764705882353, 0.13333333333333333},
+    {0.8588235294117647, 0.8588235294117647, 0.5529411764705883},
+    {0.09019607843137255, 0.7450980392156863, 0.8117647058823529},
+    {0.6196078431372549, 0.8549019607843137, 0.8980392156862745}}};
+  if (index < 0 || static_cast<std::size_t>(index) >= tab20_cmap.size()) {
+    throw std::runtime_error("Index out of bounds for tab20 colormap.");
+  }
+  return tab20_cmap[index];
+}
+
+/*static*/ ColorMap::RGBType ColorMap::interpolateDiverging(
+  double s, RGBType const& rgb1, RGBType const& rgb2) {
+  auto msh1 = labToMsh(rgbToLab(rgb1));
+  auto msh2 = labToMsh(rgbToLab(rgb2));
+
+  // Place white between distinct saturated colors
+  if (msh1[1] > 0.05 && msh2[1] > 0.05 &&
+      angleDiff(msh1[2], msh2[2]) > 0.33 * pi) {
+    double const m_mid = std::max({msh1[0], msh2[0], 88.0});
+    if (s < 0.5) {
+      msh2 = {m_mid, 0.0, 0.0};
+      s = 2.0 * s;
+    } else {
+      msh1 = {m_mid, 0.0, 0.0};
+      s = 2.0 * s - 1.0;
+    }
+  }
+
+  // The hue of an unsaturated color is meaningless: adjust it to the other one
+  if (msh1[1] < 0.05 && msh2[1] > 0.05) {
+    msh1[2] = adjustHue(msh2, msh1[0]);
+  } else if (msh2[1] < 0.05 && msh1[1] > 0.05) {
+    msh2[2] = adjustHue(msh1, msh2[0]);
+  }
+
+  std::array<double, 3> msh;
+  for (int d = 0; d < 3; d++) {
+    msh[d] = (1.0 - s) * msh1[d] + s * msh2[d];
+  }
+  return labToRGB(mshToLab(msh));
+}
+
+} /* end namespace vt::tv */
@@ -0,0 +1,189 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 color_map.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_RENDER_COLOR_MAP_H
+#define INCLUDED_VT_TV_RENDER_COLOR_MAP_H
+
+#include <array>
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace vt::tv {
+
+/**
+ * \enum ColorType
+ *
+ * \brief The color transfer functions available for QOI mapping
+ */
+enum struct ColorType : uint8_t {
+  Default = 0,
+  BlueToRed = 1,
+  HotSpot = 2,
+  WhiteToBlack = 3
+};
+
+/**
+ * \struct ColorMap
+ *
+ * \brief VTK-independent description of a color transfer function
+ *
+ * Holds the control points, out-of-range colors and indexed colors used to map
+ * a QOI to colors. \c Render builds its VTK color transfer functions from it,
+ * and the raster renderer evaluates it directly so that both back-ends produce
+ * the same colors.
+ */
+struct ColorMap {
+  using RGBType = std::array<double, 3>;
+  using RGBAType = std::array<double, 4>;
+
+  /**
+   * \brief Construct a color map for a QOI range
+   *
+   * \param[in] attribute_range continuous range or discrete support of the QOI
+   * \param[in] ct the color transfer function type
+   */
+  ColorMap(
+    std::variant<std::pair<double, double>, std::set<std::variant<double, int>>>
+      attribute_range,
+    ColorType ct = ColorType::Default);
+
+  /**
+   * \brief Map a value to its color
+   *
+   * \param[in] value the value to map
+   *
+   * \return the RGBA color with components in [0, 1]
+   */
+  RGBAType getColor(double value) const;
+
+  /**
+   * \brief Whether values are mapped through indexed (categorical) colors
+   *
+   * \return whether the map is indexed
+   */
+  bool isIndexed() const { return indexed_; }
+
+  /**
+   * \brief Whether control points are interpolated in diverging color space
+   *
+   * \return whether the map is diverging
+   */
+  bool isDiverging() const { return diverging_; }
+
+  /**
+   * \brief Get the control points, sorted by value
+   *
+   * \return the (value, color) control points
+   */
+  std::vector<std::pair<double, RGBType>> const& getControlPoints() const {
+    return points_;
+  }
+
+  /**
+   * \brief Get the indexed colors in annotation order
+   *
+   * \return the (value, color) pairs
+   */
+  std::vector<std::pair<std::variant<double, int>, RGBType>> const&
+  getIndexedColors() const {
+    return indexed_colors_;
+  }
+
+  /**
+   * \brief Get the color used below the range
+   *
+   * \return the color
+   */
+  RGBType const& getBelowRangeColor() const { return below_range_color_; }
+
+  /**
+   * \brief Get the color used above the range
+   *
+   * \return the color
+   */
+  RGBType const& getAboveRangeColor() const { return above_range_color_; }
+
+  /**
+   * \brief Get the color used for values that cannot be mapped
+   *
+   * \return the RGBA color
+   */
+  RGBAType const& getNanColor() const { return nan_color_; }
+
+  /**
+   * \brief Get a color of the tab20 categorical colormap
+   *
+   * \param[in] index the color index between 0 and 19
+   *
+   * \return the color
+   */
+  static RGBType getTab20Color(int index);
+
+  /**
+   * \brief Interpolate between two colors in Msh (diverging) color space
+   *
+   * \param[in] s the interpolation parameter in [0, 1]
+   * \param[in] rgb1 the color at 0
+   * \param[in] rgb2 the color at 1
+   *
+   * \return the interpolated color
+   */
+  static RGBType
+  interpolateDiverging(double s, RGBType const& rgb1, RGBType const& rgb2);
+
+private:
+  bool indexed_ = false;
+  bool diverging_ = false;
+  std::vector<std::pair<double, RGBType>> points_;
+  std::vector<std::pair<std::variant<double, int>, RGBType>> indexed_colors_;
+  RGBType below_range_color_ = {0., 0., 0.};
+  RGBType above_range_color_ = {1., 1., 1.};
+  RGBAType nan_color_ = {1., 1., 1., 0.};
+};
+
+} /* end namespace vt::tv */
+
+#endif /*INCLUDED_VT_TV_RENDER_COLOR_MAP_H*/
@@ -0,0 +1,520 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              raster_renderer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/render/raster_renderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+#if VT_TV_OPENMP_ENABLED
+#include <omp.h>
+#endif
+
+namespace vt::tv {
+
+namespace {
+
+/// Number of scanlines binned together for parallel rasterization
+constexpr uint32_t band_rows = 16;
+
+/// Glyph cell of the bitmap font, in font pixels
+constexpr uint32_t glyph_width = 5;
+constexpr uint32_t glyph_height = 7;
+constexpr uint32_t glyph_advance = 6;
+constexpr uint32_t line_advance = 11;
+
+/// 5x7 bitmap font for ASCII 32 to 95; bit 4 is the leftmost column
+constexpr uint8_t font_5x7[64][glyph_height] = {
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ' '
+  {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04}, // '!'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '"'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '#'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '$'
+  {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}, // '%'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '&'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '\''
+  {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}, // '('
+  {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}, // ')'
+  {0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00}, // '*'
+  {0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00}, // '+'
+  {0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08}, // ','
+  {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}, // '-'
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}, // '.'
+  {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}, // '/'
+  {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}, // '0'
+  {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}, // '1'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}, // '2'
+  {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}, // '3'
+  {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}, // '4'
+  {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}, // '5'
+  {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}, // '6'
+  {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}, // '7'
+  {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}, // '8'
+  {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}, // '9'
+  {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}, // ':'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // ';'
+  {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02}, // '<'
+  {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00}, // '='
+  {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08}, // '>'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '?'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '@'
+  {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // 'A'
+  {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}, // 'B'
+  {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}, // 'C'
+  {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}, // 'D'
+  {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}, // 'E'
+  {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}, // 'F'
+  {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}, // 'G'
+  {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // 'H'
+  {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}, // 'I'
+  {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}, // 'J'
+  {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}, // 'K'
+  {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}, // 'L'
+  {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}, // 'M'
+  {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}, // 'N'
+  {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // 'O'
+  {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}, // 'P'
+  {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}, // 'Q'
+  {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}, // 'R'
+  {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}, // 'S'
+  {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, // 'T'
+  {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // 'U'
+  {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}, // 'V'
+  {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}, // 'W'
+  {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}, // 'X'
+  {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04}, // 'Y'
+  {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}, // 'Z'
+  {0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E}, // '['
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '\\'
+  {0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E}, // ']'
+  {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '^'
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}, // '_'
+};
+
+uint8_t const* getGlyph(char c) {
+  if (c >= 'a' && c <= 'z') {
+    c = static_cast<char>(c - 'a' + 'A');
+  }
+  if (c < 32 || c > 95) {
+    c = '?';
+  }
+  return font_5x7[c - 32];
+}
+
+uint32_t getTextScale(uint64_t font_size) {
+  return std::max<uint32_t>(1, static_cast<uint32_t>(font_size / 10));
+}
+
+uint8_t toByte(double c) {
+  return static_cast<uint8_t>(std::lround(std::clamp(c, 0.0, 1.0) * 255.0));
+}
+
+std::string formatLabel(double value) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.2G", value);
+  return buf;
+}
+
+} /* end anonymous namespace */
+
+RasterRenderer::RasterRenderer(
+  uint32_t in_width, uint32_t in_height, RGBAType in_background)
+  : width_(in_width),
+    height_(in_height),
+    pixels_(static_cast<std::size_t>(in_width) * in_height * getChannels()) {
+  uint8_t const bg[3] = {
+    toByte(in_background[0]),
+    toByte(in_background[1]),
+    toByte(in_background[2])};
+  for (std::size_t i = 0; i < pixels_.size(); i += getChannels()) {
+    std::copy(bg, bg + 3, pixels_.begin() + i);
+  }
+}
+
+void RasterRenderer::setView(
+  double center_x, double center_y, double world_height) {
+  center_x_ = center_x;
+  center_y_ = center_y;
+  pixels_per_unit_ = world_height > 0.0 ? height_ / world_height : 1.0;
+}
+
+std::array<double, 2> RasterRenderer::worldToPixel(double x, double y) const {
+  return {
+    0.5 * width_ + (x - center_x_) * pixels_per_unit_,
+    0.5 * height_ - (y - center_y_) * pixels_per_unit_};
+}
+
+void RasterRenderer::addPrimitive(Primitive p, RGBAType const& color) {
+  if (color[3] <= 0.0) {
+    // Fully transparent, e.g. the NaN color of a color map
+    return;
+  }
+  p.rgba = {
+    toByte(color[0]), toByte(color[1]), toByte(color[2]), toByte(color[3])};
+  if (p.circle) {
+    p.y_min = p.xy[1] - p.radius;
+    p.y_max = p.xy[1] + p.radius;
+  } else {
+    p.y_min = std::numeric_limits<double>::infinity();
+    p.y_max = -std::numeric_limits<double>::infinity();
+    for (uint8_t k = 0; k < p.n_vertices; k++) {
+      p.y_min = std::min(p.y_min, p.xy[2 * k + 1]);
+      p.y_max = std::max(p.y_max, p.xy[2 * k + 1]);
+    }
+  }
+  primitives_.push_back(p);
+}
+
+void RasterRenderer::addPixelRect(
+  double x0, double y0, double x1, double y1, RGBAType color) {
+  Primitive p;
+  p.n_vertices = 4;
+  p.xy = {x0, y0, x1, y0, x1, y1, x0, y1};
+  addPrimitive(p, color);
+}
+
+void RasterRenderer::addRect(
+  double x0, double y0, double x1, double y1, RGBAType color) {
+  auto const p0 = worldToPixel(x0, y0);
+  auto const p1 = worldToPixel(x1, y1);
+  addPixelRect(p0[0], p0[1], p1[0], p1[1], color);
+}
+
+void RasterRenderer::addCircle(
+  double cx, double cy, double radius, RGBAType color) {
+  auto const c = worldToPixel(cx, cy);
+  Primitive p;
+  p.circle = true;
+  p.xy[0] = c[0];
+  p.xy[1] = c[1];
+  p.radius = radius * pixels_per_unit_;
+  addPrimitive(p, color);
+}
+
+void RasterRenderer::addLine(
+  double x0, double y0, double x1, double y1, double width_px, RGBAType color) {
+  auto const p0 = worldToPixel(x0, y0);
+  auto const p1 = worldToPixel(x1, y1);
+  double const dx = p1[0] - p0[0];
+  double const dy = p1[1] - p0[1];
+  double const length = std::sqrt(dx * dx + dy * dy);
+  if (length == 0.0) {
+    return;
+  }
+  // Lines are at least one pixel wide, as with OpenGL line rasterization
+  double const half = 0.5 * std::max(width_px, 1.0);
+  double const nx = -dy / length * half;
+  double const ny = dx / length * half;
+  Primitive p;
+  p.n_vertices = 4;
+  p.xy = {
+    p0[0] + nx, p0[1] + ny,
+    p1[0] + nx, p1[1] + ny,
+    p1[0] - nx, p1[1] - ny,
+    p0[0] - nx, p0[1] - ny};
+  addPrimitive(p, color);
+}
+
+void RasterRenderer::addViewportRect(
+  double nx0, double ny0, double nx1, double ny1, RGBAType color) {
+  addPixelRect(
+    nx0 * width_, (1.0 - ny1) * height_, nx1 * width_, (1.0 - ny0) * height_,
+    color);
+}
+
+/*static*/ std::pair<uint32_t, uint32_t>
+RasterRenderer::getTextSize(std::string const& text, uint64_t font_size) {
+  uint32_t const scale = getTextScale(font_size);
+  uint32_t n_lines = 1;
+  std::size_t longest = 0, current = 0;
+  for (char c : text) {
+    if (c == '\n') {
+      n_lines++;
+      current = 0;
+    } else {
+      longest = std::max(longest, ++current);
+    }
+  }
+  uint32_t const w = longest > 0 ?
+    static_cast<uint32_t>((longest * glyph_advance - 1) * scale) : 0;
+  uint32_t const h = ((n_lines - 1) * line_advance + glyph_height) * scale;
+  return {w, h};
+}
+
+void RasterRenderer::addPixelText(
+  std::string const& text,
+  double left,
+  double top,
+  uint32_t scale,
+  RGBAType const& color) {
+  double x = left;
+  double y = top;
+  for (char c : text) {
+    if (c == '\n') {
+      x = left;
+      y += line_advance * scale;
+      continue;
+    }
+    auto const glyph = getGlyph(c);
+    for (uint32_t row = 0; row < glyph_height; row++) {
+      // Merge horizontal runs of lit font pixels into single rectangles
+      uint32_t col = 0;
+      while (col < glyph_width) {
+        if (!(glyph[row] & (1u << (glyph_width - 1 - col)))) {
+          col++;
+          continue;
+        }
+        uint32_t end = col;
+        while (end < glyph_width &&
+               (glyph[row] & (1u << (glyph_width - 1 - end)))) {
+          end++;
+        }
+        addPixelRect(
+          x + col * scale, y + row * scale, x + end * scale,
+          y + (row + 1) * scale, color);
+        col = end;
+      }
+    }
+    x += glyph_advance * scale;
+  }
+}
+
+void RasterRenderer::addText(
+  std::string const& text,
+  double nx,
+  double ny,
+  uint64_t font_size,
+  RGBAType color) {
+  auto const [w, h] = getTextSize(text, font_size);
+  (void)w;
+  addPixelText(
+    text, nx * width_, (1.0 - ny) * height_ - h, getTextScale(font_size),
+    color);
+}
+
+void RasterRenderer::addColorBar(
+  ColorMap const& color_map,
+  std::string const& title,
+  double nx,
+  double ny,
+  double n_width,
+  double n_height,
+  uint64_t font_size,
+  bool out_of_range_swatches) {
+  RGBAType const black = {0.0, 0.0, 0.0, 1.0};
+  uint32_t const scale = getTextScale(font_size);
+  double const left = nx * width_;
+  double const right = (nx + n_width) * width_;
+  double const top = (1.0 - ny - n_height) * height_;
+
+  std::string formatted_title = title;
+  std::replace(formatted_title.begin(), formatted_title.end(), '_', ' ');
+  addPixelText(formatted_title, left, top, scale, black);
+
+  double const bar_top = top + (glyph_height + 3) * scale;
+  double const bar_height = std::max(2.0, 0.3 * n_height * height_);
+  double const label_top = bar_top + bar_height + 2.0 * scale;
+  double bar_left = left;
+  double bar_right = right;
+
+  auto centeredLabel = [&](std::string const& label, double center) {
+    auto const w = getTextSize(label, font_size).first;
+    addPixelText(label, center - 0.5 * w, label_top, scale, black);
+  };
+
+  if (out_of_range_swatches && !color_map.isIndexed()) {
+    auto const& below = color_map.getBelowRangeColor();
+    auto const& above = color_map.getAboveRangeColor();
+    double const swatch = bar_height;
+    addPixelRect(
+      left, bar_top, left + swatch, bar_top + bar_height,
+      {below[0], below[1], below[2], 1.0});
+    addPixelRect(
+      right - swatch, bar_top, right, bar_top + bar_height,
+      {above[0], above[1], above[2], 1.0});
+    centeredLabel("<", left + 0.5 * swatch);
+    centeredLabel(">", right - 0.5 * swatch);
+    bar_left += swatch + 2.0 * scale;
+    bar_right -= swatch + 2.0 * scale;
+  }
+  if (bar_right <= bar_left) {
+    return;
+  }
+
+  if (color_map.isIndexed()) {
+    auto const& colors = color_map.getIndexedColors();
+    if (colors.empty()) {
+      return;
+    }
+    double const cell = (bar_right - bar_left) / colors.size();
+    double x = bar_left;
+    for (auto const& [value, rgb] : colors) {
+      addPixelRect(
+        x + scale, bar_top, x + cell - scale, bar_top + bar_height,
+        {rgb[0], rgb[1], rgb[2], 1.0});
+      std::string const label = std::visit(
+        [](auto&& val) { return std::to_string(val); }, value);
+      centeredLabel(label, x + 0.5 * cell);
+      x += cell;
+    }
+    return;
+  }
+
+  auto const& points = color_map.getControlPoints();
+  if (points.empty()) {
+    return;
+  }
+  double const v_min = points.front().first;
+  double const v_max = points.back().first;
+  auto const first_col = static_cast<int64_t>(std::floor(bar_left));
+  auto const last_col = static_cast<int64_t>(std::ceil(bar_right));
+  for (int64_t col = first_col; col < last_col; col++) {
+    double const t = (col + 0.5 - bar_left) / (bar_right - bar_left);
+    double const v = v_min + std::clamp(t, 0.0, 1.0) * (v_max - v_min);
+    addPixelRect(
+      col, bar_top, col + 1, bar_top + bar_height, color_map.getColor(v));
+  }
+
+  auto const min_label = formatLabel(v_min);
+  auto const max_label = formatLabel(v_max);
+  addPixelText(min_label, bar_left, label_top, scale, black);
+  auto const max_width = getTextSize(max_label, font_size).first;
+  addPixelText(max_label, bar_right - max_width, label_top, scale, black);
+}
+
+void RasterRenderer::fillSpan(
+  uint32_t row, double x_min, double x_max, Primitive const& p) {
+  // Pixel centers at x + 0.5 are covered by the span
+  auto const first = static_cast<int64_t>(std::ceil(x_min - 0.5));
+  auto const last = static_cast<int64_t>(std::floor(x_max - 0.5));
+  int64_t const x0 = std::max<int64_t>(first, 0);
+  int64_t const x1 = std::min<int64_t>(last, static_cast<int64_t>(width_) - 1);
+  if (x0 > x1) {
+    return;
+  }
+
+  uint8_t* px = pixels_.data() +
+    (static_cast<std::size_t>(row) * width_ + x0) * getChannels();
+  if (p.rgba[3] == 255) {
+    for (int64_t x = x0; x <= x1; x++, px += getChannels()) {
+      px[0] = p.rgba[0];
+      px[1] = p.rgba[1];
+      px[2] = p.rgba[2];
+    }
+  } else {
+    uint32_t const a = p.rgba[3];
+    for (int64_t x = x0; x <= x1; x++, px += getChannels()) {
+      for (int c = 0; c < 3; c++) {
+        px[c] = static_cast<uint8_t>((p.rgba[c] * a + px[c] * (255 - a)) / 255);
+      }
+    }
+  }
+}
+
+void RasterRenderer::render() {
+  // Bin primitives into bands of scanlines, keeping the painter's order
+  uint32_t const n_bands = (height_ + band_rows - 1) / band_rows;
+  std::vector<std::vector<uint32_t>> bands(n_bands);
+  for (uint32_t i = 0; i < primitives_.size(); i++) {
+    auto const& p = primitives_[i];
+    if (p.y_max < 0.0 || p.y_min >= height_) {
+      continue;
+    }
+    auto const b0 = static_cast<uint32_t>(std::max(p.y_min, 0.0)) / band_rows;
+    auto const b1 = std::min<uint32_t>(
+      static_cast<uint32_t>(std::max(p.y_max, 0.0)) / band_rows, n_bands - 1);
+    for (uint32_t b = b0; b <= b1; b++) {
+      bands[b].push_back(i);
+    }
+  }
+
+  // Bands own disjoint rows of the pixel buffer and are filled independently
+#if VT_TV_OPENMP_ENABLED
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int64_t b = 0; b < static_cast<int64_t>(n_bands); b++) {
+    uint32_t const row_begin = static_cast<uint32_t>(b) * band_rows;
+    uint32_t const row_end = std::min(row_begin + band_rows, height_);
+    for (uint32_t row = row_begin; row < row_end; row++) {
+      double const y = row + 0.5;
+      for (auto const i : bands[b]) {
+        auto const& p = primitives_[i];
+        if (y < p.y_min || y > p.y_max) {
+          continue;
+        }
+        if (p.circle) {
+          double const dy = y - p.xy[1];
+          double const half = std::sqrt(p.radius * p.radius - dy * dy);
+          fillSpan(row, p.xy[0] - half, p.xy[0] + half, p);
+          continue;
+        }
+
+        // Intersect the scanline with the edges of the convex polygon
+        double x_min = std::numeric_limits<double>::infinity();
+        double x_max = -std::numeric_limits<double>::infinity();
+        for (uint8_t k = 0; k < p.n_vertices; k++) {
+          uint8_t const l = (k + 1) % p.n_vertices;
+          double const xa = p.xy[2 * k], ya = p.xy[2 * k + 1];
+          double const xb = p.xy[2 * l], yb = p.xy[2 * l + 1];
+          if ((ya <= y && y <= yb) || (yb <= y && y <= ya)) {
+            if (ya == yb) {
+              x_min = std::min({x_min, xa, xb});
+              x_max = std::max({x_max, xa, xb});
+            } else {
+              double const x = xa + (y - ya) * (xb - xa) / (yb - ya);
+              x_min = std::min(x_min, x);
+              x_max = std::max(x_max, x);
+            }
+          }
+        }
+        if (x_min <= x_max) {
+          fillSpan(row, x_min, x_max, p);
+        }
+      }
+    }
+  }
+}
+
+} /* end namespace vt::tv */
@@ -0,0 +1,265 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              raster_renderer.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_RENDER_RASTER_RENDERER_H
+#define INCLUDED_VT_TV_RENDER_RASTER_RENDERER_H
+
+#include "vt-tv/render/color_map.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vt::tv {
+
+/**
+ * \struct RasterRenderer
+ *
+ * \brief Lightweight CPU rasterizer for the 2D primitives of a frame
+ *
+ * Primitives (rectangles, circles, thick lines and bitmap text) are first
+ * recorded and binned into horizontal bands of scanlines; \c render() then
+ * fills the bands in parallel, preserving the painter's order within each
+ * band. World coordinates are mapped to pixels with a parallel projection,
+ * and legends are placed in normalized viewport coordinates (origin at the
+ * bottom-left corner, as with VTK 2D actors).
+ */
+struct RasterRenderer {
+  using RGBAType = ColorMap::RGBAType;
+
+  /**
+   * \brief Construct a raster renderer
+   *
+   * \param[in] in_width the image width in pixels
+   * \param[in] in_height the image height in pixels
+   * \param[in] in_background the background color
+   */
+  RasterRenderer(
+    uint32_t in_width,
+    uint32_t in_height,
+    RGBAType in_background = {1.0, 1.0, 1.0, 1.0});
+
+  /**
+   * \brief Set the parallel projection from world to pixel coordinates
+   *
+   * \param[in] center_x world X coordinate mapped to the image center
+   * \param[in] center_y world Y coordinate mapped to the image center
+   * \param[in] world_height world extent mapped to the image height
+   */
+  void setView(double center_x, double center_y, double world_height);
+
+  /**
+   * \brief Add an axis-aligned filled rectangle in world coordinates
+   *
+   * \param[in] x0 lower X bound
+   * \param[in] y0 lower Y bound
+   * \param[in] x1 upper X bound
+   * \param[in] y1 upper Y bound
+   * \param[in] color the fill color
+   */
+  void addRect(double x0, double y0, double x1, double y1, RGBAType color);
+
+  /**
+   * \brief Add a filled circle in world coordinates
+   *
+   * \param[in] cx center X coordinate
+   * \param[in] cy center Y coordinate
+   * \param[in] radius the radius
+   * \param[in] color the fill color
+   */
+  void addCircle(double cx, double cy, double radius, RGBAType color);
+
+  /**
+   * \brief Add a line segment in world coordinates
+   *
+   * \param[in] x0 first end point X coordinate
+   * \param[in] y0 first end point Y coordinate
+   * \param[in] x1 second end point X coordinate
+   * \param[in] y1 second end point Y coordinate
+   * \param[in] width_px the line width in pixels
+   * \param[in] color the line color
+   */
+  void addLine(
+    double x0,
+    double y0,
+    double x1,
+    double y1,
+    double width_px,
+    RGBAType color);
+
+  /**
+   * \brief Add a filled rectangle in normalized viewport coordinates
+   *
+   * \param[in] nx0 lower X bound in [0, 1]
+   * \param[in] ny0 lower Y bound in [0, 1]
+   * \param[in] nx1 upper X bound in [0, 1]
+   * \param[in] ny1 upper Y bound in [0, 1]
+   * \param[in] color the fill color
+   */
+  void addViewportRect(
+    double nx0, double ny0, double nx1, double ny1, RGBAType color);
+
+  /**
+   * \brief Add (possibly multi-line) text in normalized viewport coordinates
+   *
+   * \param[in] text the text, lines separated by '\n'
+   * \param[in] nx X coordinate of the bottom-left corner of the text block
+   * \param[in] ny Y coordinate of the bottom-left corner of the text block
+   * \param[in] font_size the font size, comparable to VTK text properties
+   * \param[in] color the text color
+   */
+  void addText(
+    std::string const& text,
+    double nx,
+    double ny,
+    uint64_t font_size,
+    RGBAType color = {0.0, 0.0, 0.0, 1.0});
+
+  /**
+   * \brief Add a horizontal color legend in normalized viewport coordinates
+   *
+   * \param[in] color_map the color map to display
+   * \param[in] title the legend title
+   * \param[in] nx X coordinate of the bottom-left corner of the legend
+   * \param[in] ny Y coordinate of the bottom-left corner of the legend
+   * \param[in] n_width legend width in [0, 1]
+   * \param[in] n_height legend height in [0, 1]
+   * \param[in] font_size the font size
+   * \param[in] out_of_range_swatches whether to draw below/above swatches
+   */
+  void addColorBar(
+    ColorMap const& color_map,
+    std::string const& title,
+    double nx,
+    double ny,
+    double n_width,
+    double n_height,
+    uint64_t font_size,
+    bool out_of_range_swatches = false);
+
+  /**
+   * \brief Compute the pixel size of a text block
+   *
+   * \param[in] text the text, lines separated by '\n'
+   * \param[in] font_size the font size
+   *
+   * \return the (width, height) in pixels
+   */
+  static std::pair<uint32_t, uint32_t>
+  getTextSize(std::string const& text, uint64_t font_size);
+
+  /**
+   * \brief Rasterize all recorded primitives into the pixel buffer
+   */
+  void render();
+
+  /**
+   * \brief Get the RGB pixel buffer, rows ordered top to bottom
+   *
+   * \return the pixels
+   */
+  std::vector<uint8_t> const& getPixels() const { return pixels_; }
+
+  /**
+   * \brief Get the number of channels per pixel of the buffer
+   *
+   * \return the number of channels
+   */
+  static constexpr uint8_t getChannels() { return 3; }
+
+  /**
+   * \brief Get the image width
+   *
+   * \return the width in pixels
+   */
+  uint32_t getWidth() const { return width_; }
+
+  /**
+   * \brief Get the image height
+   *
+   * \return the height in pixels
+   */
+  uint32_t getHeight() const { return height_; }
+
+private:
+  /**
+   * \internal \struct Primitive
+   *
+   * \brief A convex polygon (up to four vertices) or a circle in pixel space
+   */
+  struct Primitive {
+    bool circle = false;             /**< Circle instead of polygon */
+    uint8_t n_vertices = 0;          /**< Number of polygon vertices */
+    std::array<double, 8> xy = {};   /**< Polygon vertices or circle center */
+    double radius = 0.0;             /**< Circle radius */
+    double y_min = 0.0;              /**< Lowest pixel row covered */
+    double y_max = 0.0;              /**< Highest pixel row covered */
+    std::array<uint8_t, 4> rgba = {}; /**< Fill color */
+  };
+
+  void addPrimitive(Primitive p, RGBAType const& color);
+  void addPixelRect(double x0, double y0, double x1, double y1, RGBAType color);
+  void addPixelText(
+    std::string const& text,
+    double left,
+    double top,
+    uint32_t scale,
+    RGBAType const& color);
+  std::array<double, 2> worldToPixel(double x, double y) const;
+  void fillSpan(uint32_t row, double x_min, double x_max, Primitive const& p);
+
+private:
+  uint32_t width_ = 0;              /**< Image width in pixels */
+  uint32_t height_ = 0;             /**< Image height in pixels */
+  double center_x_ = 0.0;           /**< World X coordinate of image center */
+  double center_y_ = 0.0;           /**< World Y coordinate of image center */
+  double pixels_per_unit_ = 1.0;    /**< Parallel projection scale */
+  std::vector<Primitive> primitives_; /**< Primitives in painter's order */
+  std::vector<uint8_t> pixels_;       /**< RGB pixel buffer */
+};
+
+} /* end namespace vt::tv */
+
+#endif /*INCLUDED_VT_TV_RENDER_RASTER_RENDERER_H*/
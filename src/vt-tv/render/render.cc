@@ -51,11 +51,12 @@
 
 namespace vt::tv {
 
-Render::Render(Info in_info)
-  : info_(in_info) // std:move ?
-    ,
-    n_ranks_(in_info.getNumRanks()),
-    n_phases_(in_info.getNumPhases())
+using utility::parallelFor;
+
+Render::Render(std::shared_ptr<Info const> in_info)
+  : info_(in_info),
+    n_ranks_(in_info->getNumRanks()),
+    n_phases_(in_info->getNumPhases())
 {
   // If selected_phase is not provided, use all phases
   selected_phase_ = std::numeric_limits<PhaseType>::max();
@@ -81,36 +82,32 @@ Render::Render(Info in_info)
   }
   max_o_per_dim_ = 0;
 
-  // Set the info selected_phase
-  info_.setSelectedPhase(selected_phase_);
-
-  // Normalize communication edges
-  if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
-    info_.normalizeEdges(selected_phase_);
-  } else {
-    for (PhaseType phase = 0; phase < n_phases_; phase++) {
-      info_.normalizeEdges(phase);
-    }
-  }
-
   // Initialize jitter
-  std::srand(std::time(nullptr));
-  auto const& allObjects = info_.getAllObjectIDs();
-  for (auto const& objectID : allObjects) {
-    std::array<double, 3> jitterDims;
-    for (uint64_t d = 0; d < 3; d++) {
-      if (auto f = rank_dims_.find(d); f != rank_dims_.end()) {
-        jitterDims[d] = ((double)std::rand() / RAND_MAX - 0.5) * object_jitter_;
-      } else
-        jitterDims[d] = 0;
+  {
+    utility::TraceSpan span("object_jitter");
+    std::srand(std::time(nullptr));
+    auto const& allObjects = info_->getAllObjectIDs();
+    for (auto const& objectID : allObjects) {
+      std::array<double, 3> jitterDims;
+      for (uint64_t d = 0; d < 3; d++) {
+        if (auto f = rank_dims_.find(d); f != rank_dims_.end()) {
+          jitterDims[d] =
+            ((double)std::rand() / RAND_MAX - 0.5) * object_jitter_;
+        } else
+          jitterDims[d] = 0;
+      }
+      jitter_dims_.insert(std::make_pair(objectID, jitterDims));
     }
-    jitter_dims_.insert(std::make_pair(objectID, jitterDims));
   }
 
-  object_qoi_range_ = computeObjectQOIRange_();
-  rank_qoi_range_ = computeRankQOIRange_();
-  object_volume_max_ = computeMaxObjectVolume_();
-  object_load_max_ = info_.getMaxLoad();
+  // Compute the color and glyph ranges of all frames
+  {
+    utility::TraceSpan span("compute_ranges");
+    object_qoi_range_ = computeObjectQOIRange_();
+    rank_qoi_range_ = computeRankQOIRange_();
+    object_volume_max_ = computeMaxObjectVolume_();
+    object_load_max_ = computeMaxObjectLoad_();
+  }
 }
 
 std::string printLBIter(LBIterationType lb_iter) {
@@ -124,7 +121,7 @@ std::string printLBIter(LBIterationType lb_iter) {
 Render::Render(
   std::array<std::string, 3> in_qoi_request,
   bool in_continuous_object_qoi,
-  Info& in_info,
+  std::shared_ptr<Info const> in_info,
   std::array<uint64_t, 3> in_grid_size,
   double in_object_jitter,
   std::string in_output_dir,
@@ -137,8 +134,8 @@ Render::Render(
     object_qoi_(in_qoi_request[2]),
     continuous_object_qoi_(in_continuous_object_qoi),
     info_(in_info),
-    n_ranks_(in_info.getNumRanks()),
-    n_phases_(in_info.getNumPhases()),
+    n_ranks_(in_info->getNumRanks()),
+    n_phases_(in_info->getNumPhases()),
     grid_size_(in_grid_size),
     object_jitter_(in_object_jitter),
     output_dir_(in_output_dir),
@@ -148,7 +145,7 @@ Render::Render(
     save_pngs_(in_save_pngs),
     selected_phase_(in_selected_phase) {
   // initialize number of ranks
-  n_ranks_ = info_.getNumRanks();
+  n_ranks_ = info_->getNumRanks();
 
   // initialize rank dimensions according to given grid
   for (uint64_t d = 0; d < 3; d++) {
@@ -157,43 +154,59 @@ Render::Render(
   }
   max_o_per_dim_ = 0;
 
-  // Set the info selected_phase
-  info_.setSelectedPhase(selected_phase_);
-
-  // Normalize communication edges
-  if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
-    info_.normalizeEdges(selected_phase_);
-  } else {
-    for (PhaseType phase = 0; phase < n_phases_; phase++) {
-      info_.normalizeEdges(phase);
-    }
-  }
-
   // Initialize jitter
-  std::srand(std::time(nullptr));
-  auto const& allObjects = info_.getAllObjectIDs();
-  for (auto const& objectID : allObjects) {
-    std::array<double, 3> jitterDims;
-    for (uint64_t d = 0; d < 3; d++) {
-      if (auto f = rank_dims_.find(d); f != rank_dims_.end()) {
-        jitterDims[d] = ((double)std::rand() / RAND_MAX - 0.5) * object_jitter_;
-      } else
-        jitterDims[d] = 0;
+  {
+    utility::TraceSpan span("object_jitter");
+    std::srand(std::time(nullptr));
+    auto const& allObjects = info_->getAllObjectIDs();
+    for (auto const& objectID : allObjects) {
+      std::array<double, 3> jitterDims;
+      for (uint64_t d = 0; d < 3; d++) {
+        if (auto f = rank_dims_.find(d); f != rank_dims_.end()) {
+          jitterDims[d] =
+            ((double)std::rand() / RAND_MAX - 0.5) * object_jitter_;
+        } else
+          jitterDims[d] = 0;
+      }
+      jitter_dims_.insert(std::make_pair(objectID, jitterDims));
     }
-    jitter_dims_.insert(std::make_pair(objectID, jitterDims));
   }
 
-  object_qoi_range_ = computeObjectQOIRange_();
-  rank_qoi_range_ = computeRankQOIRange_();
-  object_volume_max_ = computeMaxObjectVolume_();
-  object_load_max_ = info_.getMaxLoad();
+  // Compute the color and glyph ranges of all frames
+  {
+    utility::TraceSpan span("compute_ranges");
+    object_qoi_range_ = computeObjectQOIRange_();
+    rank_qoi_range_ = computeRankQOIRange_();
+    object_volume_max_ = computeMaxObjectVolume_();
+    object_load_max_ = computeMaxObjectLoad_();
+  }
 };
 
+std::shared_ptr<PhaseSummary const> Render::getSummary_() const {
+  auto const& summary = info_->getPhaseSummary();
+  if (
+    summary == nullptr or summary->n_ranks != n_ranks_ or
+    summary->n_phases != n_phases_) {
+    return nullptr;
+  }
+  return summary;
+}
+
 double Render::computeMaxObjectVolume_() {
-  double ov_max = info_.getMaxVolume();
+  if (auto const summary = getSummary_()) {
+    return summary->getMaxObjectVolume(selected_phase_);
+  }
+  double ov_max = info_->getMaxVolume(selected_phase_);
   return ov_max;
 }
 
+double Render::computeMaxObjectLoad_() {
+  if (auto const summary = getSummary_()) {
+    return summary->getMaxObjectLoad(selected_phase_);
+  }
+  return info_->getMaxLoad(selected_phase_);
+}
+
 std::variant<std::pair<double, double>, std::set<std::variant<double, int>>>
 Render::computeObjectQOIRange_() {
   // Initialize object QOI range attributes
@@ -201,15 +214,32 @@ Render::computeObjectQOIRange_() {
   double oq_min = std::numeric_limits<double>::infinity();
   std::set<std::variant<double, int>> oq_all;
 
+  // The summary holds the range and the few values of each frame
+  auto const summary = getSummary_();
+  if (auto const range = summary ?
+        summary->getObjectQOIRange(object_qoi_, selected_phase_) :
+        std::nullopt) {
+    object_qoi_max_ = range->max;
+    // Beyond 20 distinct values, the QOI is continuous as when scanning
+    continuous_object_qoi_ = continuous_object_qoi_ or range->continuous;
+    if (continuous_object_qoi_) {
+      return std::make_pair(range->min, range->max);
+    }
+    for (double oq : range->support) {
+      if (oq == static_cast<int>(oq)) {
+        oq_all.insert(static_cast<int>(oq));
+      } else {
+        oq_all.insert(oq);
+      }
+    }
+    return oq_all;
+  }
+
   // Update the QOI range
-  auto updateQOIRange = [&](
-    auto const& objects, PhaseType phase, LBIterationType lb_iter
-  ) {
+  auto updateQOIRange = [&](auto const& objects) {
     for (auto const& [obj_id, obj_work] : objects) {
       // Update maximum object qoi
-      auto oq = info_.getObjectQOIAtPhase<double>(
-        obj_id, phase, lb_iter, object_qoi_
-      );
+      auto oq = info_->getObjectQOI<double>(obj_work, object_qoi_);
       if (!continuous_object_qoi_) {
         // Allow for integer categorical QOI (i.e. rank_id)
         if (oq == static_cast<int>(oq)) {
@@ -231,23 +261,23 @@ Render::computeObjectQOIRange_() {
 
   // Iterate over all ranks
   if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
-    auto const& objects = info_.getPhaseObjects(selected_phase_, no_lb_iter);
-    updateQOIRange(objects, selected_phase_, no_lb_iter);
+    auto const& objects = info_->getPhaseObjects(selected_phase_, no_lb_iter);
+    updateQOIRange(objects);
     auto const& lb_iters =
-      info_.getRank(0).getPhaseWork().at(selected_phase_).getLBIterations();
+      info_->getRank(0).getPhaseWork().at(selected_phase_).getLBIterations();
     for (auto const& [lb_iter_id, _] : lb_iters) {
-      auto const& objects2 = info_.getPhaseObjects(selected_phase_, lb_iter_id);
-      updateQOIRange(objects2, selected_phase_, lb_iter_id);
+      auto const& objects2 = info_->getPhaseObjects(selected_phase_, lb_iter_id);
+      updateQOIRange(objects2);
     }
   } else {
     for (PhaseType phase = 0; phase < n_phases_; phase++) {
-      auto const& objects = info_.getPhaseObjects(phase, no_lb_iter);
-      updateQOIRange(objects, phase, no_lb_iter);
+      auto const& objects = info_->getPhaseObjects(phase, no_lb_iter);
+      updateQOIRange(objects);
       auto const& lb_iters =
-        info_.getRank(0).getPhaseWork().at(phase).getLBIterations();
+        info_->getRank(0).getPhaseWork().at(phase).getLBIterations();
       for (auto const& [lb_iter_id, _] : lb_iters) {
-        auto const& objects2 = info_.getPhaseObjects(phase, lb_iter_id);
-        updateQOIRange(objects2, phase, lb_iter_id);
+        auto const& objects2 = info_->getPhaseObjects(phase, lb_iter_id);
+        updateQOIRange(objects2);
       }
     }
   }
@@ -271,9 +301,16 @@ std::pair<double, double> Render::computeRankQOIRange_() {
   double rqmax_for_phase;
   double rqmin_for_phase;
 
+  // The summary holds the QOI of each rank in each frame
+  if (auto const summary = getSummary_()) {
+    if (auto const range = summary->getRankQOIRange(rank_qoi_)) {
+      return *range;
+    }
+  }
+
   // Iterate over all ranks
   for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
-    auto rank_qoi_vec = info_.getAllQOIAtRank(rank_id, rank_qoi_);
+    auto rank_qoi_vec = info_->getAllQOIAtRank(rank_id, rank_qoi_);
 
     // Get max qoi for this rank across all phases
     auto prmax = std::max_element(
@@ -297,18 +334,76 @@ std::pair<double, double> Render::computeRankQOIRange_() {
   return std::make_pair(rq_min, rq_max);
 }
 
-std::map<NodeType, std::unordered_map<ElementIDType, ObjectWork>>
-Render::createObjectMapping_(PhaseType phase, LBIterationType lb_iter) {
-  std::map<NodeType, std::unordered_map<ElementIDType, ObjectWork>>
-    object_mapping;
-  // Add each rank and its corresponding objects at the given phase to the
-  // object mapping
+std::string Render::getFrameCaption_(PhaseType phase, LBIterationType lb_iter) {
+  std::stringstream ss;
+  if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
+    ss << "Phase: " << phase;
+  } else {
+    ss << "Phase: " << phase << "/" << (n_phases_ - 1);
+  }
+  if (lb_iter != no_lb_iter) {
+    auto const n_lb_iters =
+      info_->getRank(0).getPhaseWork().at(phase).getLBIterations().size();
+    ss << ", Iter: " << lb_iter << "/" << n_lb_iters;
+  }
+  ss << "\n";
+  ss << "Load Imbalance: " << std::fixed << std::setprecision(2)
+     << info_->getImbalance(phase, lb_iter);
+  return ss.str();
+}
+
+Render::ObjectOrdering
+Render::createObjectOrdering_(PhaseType phase, LBIterationType lb_iter) {
+  ObjectOrdering ordering;
+  auto const& object_info = info_->getObjectInfo();
+
+  // Each rank owns a contiguous block of points starting at the prefix sum of
+  // the object counts of the ranks before it
+  std::vector<WorkDistribution const*> rank_work(n_ranks_);
+  ordering.rank_offsets.resize(n_ranks_ + 1, 0);
   for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
-    object_mapping.insert(
-      std::make_pair(rank_id, info_.getRankObjects(rank_id, phase, lb_iter))
+    rank_work[rank_id] = &info_->getWorkDistribution(
+      info_->getRank(rank_id), phase, lb_iter
     );
+    ordering.rank_offsets[rank_id + 1] = ordering.rank_offsets[rank_id] +
+      rank_work[rank_id]->getObjectWork().size();
+  }
+  uint64_t const n_o = ordering.rank_offsets[n_ranks_];
+  ordering.objects.resize(n_o);
+  ordering.migratable.resize(n_o);
+
+  // Blocks are then sorted independently
+  parallelFor(n_ranks_, [&](uint64_t rank_id) {
+    // Sort keys are looked up once per object, not at each comparison
+    std::vector<std::tuple<bool, ElementIDType, ObjectWork const*>>
+      rank_objects;
+    auto const& objects = rank_work[rank_id]->getObjectWork();
+    rank_objects.reserve(objects.size());
+    for (auto const& [obj_id, obj_work] : objects) {
+      bool migratable = object_info.at(obj_id).isMigratable();
+      rank_objects.emplace_back(migratable, obj_id, &obj_work);
+    }
+
+    // Non-migratable objects come first, then sort by ID
+    std::sort(rank_objects.begin(), rank_objects.end());
+    uint64_t point_index = ordering.rank_offsets[rank_id];
+    for (auto const& [migratable, obj_id, obj_work] : rank_objects) {
+      ordering.objects[point_index] = obj_work;
+      ordering.migratable[point_index] = migratable;
+      point_index++;
+    }
+  });
+
+  // Numerical user-defined QOIs of the frame are looked up in the catalog
+  auto const catalog = info_->getQOICatalog();
+  for (auto const& [key, key_info] : catalog->object_user_defined) {
+    if (key_info.isNumeric() and key_info.hasFrame(phase, lb_iter)) {
+      ordering.user_defined_types[key] = key_info.type == QOIValueType::Int ?
+        VtkTypeEnum::TYPE_INT : VtkTypeEnum::TYPE_DOUBLE;
+    }
   }
-  return object_mapping;
+
+  return ordering;
 }
 
 template <typename T, typename U>
@@ -320,14 +415,14 @@ vtkNew<U> Render::createRankArrayUserDefined(
   array->SetName(array_name.c_str());
   array->SetNumberOfTuples(n_ranks_);
 
-  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
-    auto const& cur_rank_info = info_.getRanks().at(rank_id);
-    auto const& value = info_.getRankUserDefined(
+  auto* values = array->GetPointer(0);
+  parallelFor(n_ranks_, [&](uint64_t rank_id) {
+    auto const& cur_rank_info = info_->getRanks().at(rank_id);
+    auto const& value = info_->getRankUserDefined(
       cur_rank_info, phase, lb_iter, key
     );
-    //fmt::print("phase={}, key={}, rank_id={}\n", phase, key, rank_id);
-    array->SetTuple1(rank_id, std::get<T>(value));
-  }
+    values[rank_id] = info_->convertQOIVariantTypeToT_<T>(value);
+  });
   return array;
 }
 
@@ -340,51 +435,54 @@ vtkNew<U> Render::createRankArrayComputed(
   array->SetName(array_name.c_str());
   array->SetNumberOfTuples(n_ranks_);
 
-  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
-    array->SetTuple1(
-      rank_id, info_.getRankQOIAtPhase<T>(rank_id, phase, lb_iter, key)
-    );
-  }
+  auto* values = array->GetPointer(0);
+  parallelFor(n_ranks_, [&](uint64_t rank_id) {
+    values[rank_id] = info_->getRankQOIAtPhase<T>(rank_id, phase, lb_iter, key);
+  });
   return array;
 }
 
-vtkNew<vtkPolyData> Render::createRankMesh_(
-  PhaseType phase, LBIterationType lb_iter
-) {
-  fmt::print("\n\n");
-  fmt::print("----- Creating rank mesh for phase {} -----\n", phase);
-  vtkNew<vtkPoints> rank_points_;
-  rank_points_->SetNumberOfPoints(n_ranks_);
+vtkSmartPointer<vtkPoints> Render::createRankPoints_() const {
+  auto rank_points = vtkSmartPointer<vtkPoints>::New();
+  rank_points->SetDataTypeToFloat();
+  rank_points->SetNumberOfPoints(n_ranks_);
 
-  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+  float* point_coords = static_cast<float*>(rank_points->GetVoidPointer(0));
+  parallelFor(n_ranks_, [&](uint64_t rank_id) {
     std::array<uint64_t, 3> cartesian =
       globalIDToCartesian_(rank_id, grid_size_);
-    std::array<double, 3> offsets = {
-      cartesian[0] * grid_resolution_,
-      cartesian[1] * grid_resolution_,
-      cartesian[2] * grid_resolution_
-    };
 
     // Insert point based on cartesian coordinates
-    rank_points_->SetPoint(rank_id, offsets[0], offsets[1], offsets[2]);
-  }
+    for (uint64_t d = 0; d < 3; d++) {
+      point_coords[3 * rank_id + d] =
+        static_cast<float>(cartesian[d] * grid_resolution_);
+    }
+  });
+  return rank_points;
+}
 
+vtkNew<vtkPolyData> Render::createRankMesh_(
+  PhaseType phase, LBIterationType lb_iter
+) {
+  VT_TV_LOG(
+    Render, Debug,
+    "----- Creating rank mesh for phase {} -----", phase);
   vtkNew<vtkPolyData> pd_mesh;
-  pd_mesh->SetPoints(rank_points_);
+  pd_mesh->SetPoints(createRankPoints_());
 
   // First, check user-defined to see if we already have the QOI calculated, if
-  // so grab that first value to determine the type of the variant to allocate
-  // the VTK array
-  auto const has_user_defined_qoi = info_.hasRankUserDefined(rank_qoi_);
-  if (has_user_defined_qoi) {
-    auto const& test_value = info_.getFirstRankUserDefined(rank_qoi_);
-    if (std::holds_alternative<double>(test_value)) {
+  // so its type in the catalog determines the VTK array to allocate
+  auto const catalog = info_->getQOICatalog();
+  auto const* user_defined_qoi =
+    QOICatalog::find(catalog->rank_user_defined, rank_qoi_);
+  if (user_defined_qoi != nullptr) {
+    if (user_defined_qoi->type == QOIValueType::Double) {
       pd_mesh->GetPointData()->SetScalars(
         createRankArrayUserDefined<double, vtkDoubleArray>(
           phase, lb_iter, rank_qoi_
         )
       );
-    } else if (std::holds_alternative<int>(test_value)) {
+    } else if (user_defined_qoi->type == QOIValueType::Int) {
       pd_mesh->GetPointData()->SetScalars(
         createRankArrayUserDefined<int, vtkIntArray>(phase, lb_iter, rank_qoi_)
       );
@@ -392,7 +490,7 @@ vtkNew<vtkPolyData> Render::createRankMesh_(
   } else {
     // We need to calculate the QOI since it's not in user-defined
     // Lookup the type in a map to determine which vtk type array to utilize
-    auto const& types = info_.computable_qoi_types;
+    auto const& types = info_->computable_qoi_types;
     if (auto iter = types.find(rank_qoi_); iter != types.end()) {
       VtkTypeEnum type = iter->second;
       if (type == VtkTypeEnum::TYPE_DOUBLE) {
@@ -409,52 +507,48 @@ vtkNew<vtkPolyData> Render::createRankMesh_(
     }
   }
 
-  auto const& rank_info = info_.getRanks().at(0);
-  auto const& keys = info_.getRankUserDefinedKeys(rank_info, phase);
-  for (auto const& key : keys) {
-    auto const& test_value = info_.getRankUserDefined(
-      rank_info, phase, lb_iter, key
-    );
-    if (std::holds_alternative<double>(test_value)) {
+  // Every numerical user-defined QOI of the frame is added as an array
+  for (auto const& [key, key_info] : catalog->rank_user_defined) {
+    if (not key_info.hasFrame(phase, lb_iter)) {
+      continue;
+    }
+    if (key_info.type == QOIValueType::Double) {
       pd_mesh->GetPointData()->AddArray(
         createRankArrayUserDefined<double, vtkDoubleArray>(phase, lb_iter, key)
       );
-    } else if (std::holds_alternative<int>(test_value)) {
+    } else if (key_info.type == QOIValueType::Int) {
       pd_mesh->GetPointData()->AddArray(
         createRankArrayUserDefined<int, vtkIntArray>(phase, lb_iter, key)
       );
     }
   }
 
-  fmt::print("----- Finished creating rank mesh for phase {} -----\n", phase);
+  VT_TV_LOG(
+    Render, Debug,
+    "----- Finished creating rank mesh for phase {} -----", phase);
   return pd_mesh;
 }
 
-bool compareObjects(
-  std::pair<ObjectWork, uint64_t> const& p1,
-  std::pair<ObjectWork, uint64_t> const& p2
+vtkNew<vtkPolyData> Render::createObjectMesh_(
+  PhaseType phase, LBIterationType lb_iter
 ) {
-  ElementIDType lhsID = p1.first.getID();
-  ElementIDType rhsID = p2.first.getID();
-  uint64_t migratableLhs = p1.second;
-  uint64_t migratableRhs = p2.second;
-  if (migratableLhs != migratableRhs) {
-    return migratableLhs < migratableRhs; // non-migratable comes first
-  }
-  return lhsID < rhsID; // then sort by ID
+  // Order objects once: all point arrays are then filled in a single pass
+  return createObjectMesh_(
+    phase, lb_iter, createObjectOrdering_(phase, lb_iter));
 }
 
 vtkNew<vtkPolyData> Render::createObjectMesh_(
-  PhaseType phase, LBIterationType lb_iter
+  PhaseType phase, LBIterationType lb_iter, ObjectOrdering const& ordering
 ) {
-  fmt::print("\n\n");
-  fmt::print(
-    "----- Creating object mesh for (phase,lb_iter) ({},{}) -----\n",
+  VT_TV_LOG(
+    Render, Debug,
+    "----- Creating object mesh for (phase,lb_iter) ({},{}) -----",
     phase, printLBIter(lb_iter)
   );
+
   // Retrieve number of mesh points and bail out early if empty set
-  uint64_t n_o = info_.getPhaseObjects(phase, lb_iter).size();
-  fmt::print("  Number of objects in phase: {}\n", n_o);
+  uint64_t n_o = ordering.objects.size();
+  VT_TV_LOG(Render, Debug, "  Number of objects in phase: {}", n_o);
 
   // Create point array for object quantity of interest
   vtkNew<vtkDoubleArray> q_arr;
@@ -463,7 +557,8 @@ vtkNew<vtkPolyData> Render::createObjectMesh_(
 
   // Load array must be added when it is not the object QOI
   vtkNew<vtkDoubleArray> l_arr;
-  if (object_qoi_ != "load") {
+  bool const add_load = object_qoi_ != "load";
+  if (add_load) {
     l_arr->SetName("load");
     l_arr->SetNumberOfTuples(n_o);
   }
@@ -473,25 +568,41 @@ vtkNew<vtkPolyData> Render::createObjectMesh_(
   b_arr->SetName("migratable");
   b_arr->SetNumberOfTuples(n_o);
 
+  // Create point arrays for user-defined QOIs, ordered by key
+  std::vector<vtkSmartPointer<vtkDataArray>> ud_arrays;
+  for (auto const& [key, vtk_type] : ordering.user_defined_types) {
+    vtkSmartPointer<vtkDataArray> array;
+    if (vtk_type == VtkTypeEnum::TYPE_INT) {
+      array = vtkSmartPointer<vtkIntArray>::New();
+    } else {
+      array = vtkSmartPointer<vtkDoubleArray>::New();
+    }
+    array->SetName(key.c_str());
+    array->SetNumberOfTuples(n_o);
+    ud_arrays.push_back(array);
+  }
+
   // Create and size point set
   vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
   points->SetNumberOfPoints(n_o);
 
-  // Retrieve elements constant across all ranks
-  std::string object_qoi = object_qoi_;
-
-  // Iterate over ranks and objects to create mesh points
-  uint64_t point_index = 0;
-  std::map<ElementIDType, uint64_t> objectid_to_index;
-  // sent_volumes is a vector to store the communications ("from" object id, "sent to" object id, and volume)
-  std::vector<std::tuple<ElementIDType, ElementIDType, double>> sent_volumes;
-
-  auto object_mapping = createObjectMapping_(phase, lb_iter);
+  // Arrays are preallocated: ranks fill disjoint blocks of their raw buffers
+  float* point_coords = static_cast<float*>(points->GetVoidPointer(0));
+  double* q_values = q_arr->GetPointer(0);
+  double* l_values = add_load ? l_arr->GetPointer(0) : nullptr;
+  std::vector<void*> ud_values;
+  for (auto const& array : ud_arrays) {
+    ud_values.push_back(array->GetVoidPointer(0));
+  }
 
-  std::map<std::string, VtkTypeEnum> qoi_map;
+  // sent_volumes stores the communications ("from" point index, "sent to"
+  // object id, and volume) of each rank, in point order
+  std::vector<std::vector<std::tuple<uint64_t, ElementIDType, double>>>
+    rank_sent_volumes(n_ranks_);
+  std::vector<uint64_t> rank_o_per_dim(n_ranks_, 0);
 
-  // Iterate through object mapping
-  for (auto const& [rankID, objects] : object_mapping) {
+  parallelFor(n_ranks_, [&](uint64_t rankID) {
     std::array<uint64_t, 3> ijk =
       globalIDToCartesian_(rankID, grid_size_);
 
@@ -501,12 +612,12 @@ vtkNew<vtkPolyData> Render::createObjectMesh_(
       ijk[2] * grid_resolution_};
 
     // Compute local object block parameters
-    uint64_t n_o_rank = objects.size();
+    uint64_t const rank_begin = ordering.rank_offsets[rankID];
+    uint64_t const rank_end = ordering.rank_offsets[rankID + 1];
+    uint64_t n_o_rank = rank_end - rank_begin;
 
     uint64_t n_o_per_dim = ceil(pow(n_o_rank, 1.0 / rank_dims_.size()));
-    if (n_o_per_dim > max_o_per_dim_) {
-      max_o_per_dim_ = n_o_per_dim;
-    }
+    rank_o_per_dim[rankID] = n_o_per_dim;
     double o_resolution = grid_resolution_ / (n_o_per_dim + 1.);
 
     // Create point coordinates
@@ -527,105 +638,147 @@ vtkNew<vtkPolyData> Render::createObjectMesh_(
       }
     }
 
-    std::vector<std::pair<ObjectWork, uint64_t>> ordered_objects;
-
-    for (auto const& [objectID, objectWork] : objects) {
-      bool migratable = info_.getObjectInfo().at(objectID).isMigratable();
-      ordered_objects.push_back(std::make_pair(objectWork, migratable));
-      for (auto const& [key, _] : objectWork.getUserDefined()) {
-        auto const& value = objectWork.getUserDefined().at(key);
-        VtkTypeEnum t = VtkTypeEnum::TYPE_DOUBLE;
-        if (std::holds_alternative<int>(value)) {
-          t = VtkTypeEnum::TYPE_INT;
-        }
-        qoi_map[key] = t;
-      }
-    }
-
-    // Sort objects
-    std::sort(ordered_objects.begin(), ordered_objects.end(), compareObjects);
-
     // Add rank objects to point set
-    int i = 0;
-    for (auto const& [objectWork, migratable] : ordered_objects) {
-      // fmt::print("Object ID: {}, migratable: {}\n", objectWork.getID(), migratable);
+    auto& sent_volumes = rank_sent_volumes[rankID];
+    for (uint64_t point_index = rank_begin; point_index < rank_end;
+         point_index++) {
+      ObjectWork const& objectWork = *ordering.objects[point_index];
+      ElementIDType obj_id = objectWork.getID();
 
       // Insert point using offset and rank coordinates
-      std::array<double, 3> currentPointPosition = {0, 0, 0};
+      auto const& jitter = jitter_dims_.at(obj_id);
       int d = 0;
-      for (auto c : globalIDToCartesian_(i, rank_size)) {
-        currentPointPosition[d] = offsets[d] - centering[d] +
-          (jitter_dims_.at(objectWork.getID())[d] + c) * o_resolution;
+      for (auto c : globalIDToCartesian_(point_index - rank_begin, rank_size)) {
+        point_coords[3 * point_index + d] = static_cast<float>(
+          offsets[d] - centering[d] + (jitter[d] + c) * o_resolution
+        );
         d++;
       }
 
-      points->SetPoint(
-        point_index,
-        currentPointPosition[0],
-        currentPointPosition[1],
-        currentPointPosition[2]);
-
       // Set object attributes
-      ElementIDType obj_id = objectWork.getID();
-      auto oq = info_.getObjectQOIAtPhase<double>(
-        obj_id, phase, lb_iter, object_qoi_
-      );
-      q_arr->SetTuple1(point_index, oq);
-      b_arr->SetTuple1(point_index, migratable);
-      if (object_qoi_ != "load") {
-        l_arr->SetTuple1(point_index, objectWork.getLoad());
+      q_values[point_index] =
+        info_->getObjectQOI<double>(objectWork, object_qoi_);
+      if (add_load) {
+        l_values[point_index] = objectWork.getLoad();
       }
 
-      auto objSent = objectWork.getSent();
-      for (auto [k, v] : objSent) {
-        sent_volumes.push_back(std::make_tuple(point_index, k, v));
+      // Missing user-defined QOIs default to zero
+      auto const& ud = objectWork.getUserDefined();
+      std::size_t a = 0;
+      for (auto const& [key, vtk_type] : ordering.user_defined_types) {
+        auto it = ud.find(key);
+        if (vtk_type == VtkTypeEnum::TYPE_INT) {
+          static_cast<int*>(ud_values[a])[point_index] =
+            it != ud.end() ? std::get<int>(it->second) : 0;
+        } else {
+          static_cast<double*>(ud_values[a])[point_index] = it != ud.end() ?
+            info_->convertQOIVariantTypeToT_<double>(it->second) : 0.0;
+        }
+        a++;
       }
 
-      i++;
-      objectid_to_index.insert(std::make_pair(objectWork.getID(), point_index));
-      point_index++;
+      for (auto const& [k, v] : objectWork.getSent()) {
+        sent_volumes.emplace_back(point_index, k, v);
+      }
     }
+  });
+
+  // Bits of neighboring ranks may share a byte, and the index map is not
+  // thread-safe: both are filled once all blocks are done
+  utility::IndexHashMap objectid_to_index(n_o);
+  for (uint64_t point_index = 0; point_index < n_o; point_index++) {
+    b_arr->SetValue(point_index, ordering.migratable[point_index]);
+    objectid_to_index.emplace(
+      ordering.objects[point_index]->getID(), point_index
+    );
+  }
+  for (auto n_o_per_dim : rank_o_per_dim) {
+    max_o_per_dim_ = std::max(max_o_per_dim_, n_o_per_dim);
   }
 
-  vtkNew<vtkDoubleArray> lineValuesArray;
-  lineValuesArray->SetName("bytes");
-  vtkNew<vtkCellArray> lines;
-  uint64_t n_e = 0;
-  std::
-    map<std::tuple<ElementIDType, ElementIDType>, std::tuple<uint64_t, double>>
-      edge_values;
-
-  fmt::print("  Creating inter-object communication edges\n");
-  for (auto& [pt_index, k, v] : sent_volumes) {
-    // sort the point index and the object id in the "ij" tuple
-    std::tuple<ElementIDType, ElementIDType> ij;
-    if (pt_index <= objectid_to_index.at(k)) {
-      ij = {pt_index, objectid_to_index.at(k)};
-    } else {
-      ij = {objectid_to_index.at(k), pt_index};
+  VT_TV_LOG(Render, Debug, "  Creating inter-object communication edges");
+  // Edges are keyed by their sorted point indices and numbered in order of
+  // first appearance; volumes are accumulated in that same order
+  uint64_t n_sent = 0;
+  for (auto const& sent_volumes : rank_sent_volumes) {
+    n_sent += sent_volumes.size();
+  }
+  utility::IndexHashMap edge_indices(n_sent);
+  std::vector<vtkIdType> edge_points;
+  std::vector<double> edge_volumes;
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    for (auto const& [pt_index, k, v] : rank_sent_volumes[rank_id]) {
+      uint64_t const k_index = objectid_to_index.find(k);
+      if (k_index == utility::IndexHashMap::invalid) {
+        throw std::runtime_error(
+          "Object " + std::to_string(k) + " communicated with by object at " +
+          "point " + std::to_string(pt_index) + " is not in the mesh."
+        );
+      }
+
+      // Communications within a rank are dropped before being aggregated
+      if (edge_selection_.inter_rank_only) {
+        auto const k_rank = std::upper_bound(
+          ordering.rank_offsets.begin(), ordering.rank_offsets.end(), k_index
+        ) - ordering.rank_offsets.begin() - 1;
+        if (static_cast<uint64_t>(k_rank) == rank_id) {
+          continue;
+        }
+      }
+
+      uint64_t const i = std::min<uint64_t>(pt_index, k_index);
+      uint64_t const j = std::max<uint64_t>(pt_index, k_index);
+      auto const [e, inserted] = edge_indices.emplace(
+        utility::IndexHashMap::packPair(i, j), edge_volumes.size()
+      );
+      if (inserted) {
+        edge_volumes.push_back(v);
+        edge_points.push_back(i);
+        edge_points.push_back(j);
+      } else {
+        edge_volumes[e] += v;
+      }
     }
+  }
 
-    std::tuple<uint64_t, double> edge_value;
-    if (auto e_ij = edge_values.find(ij); e_ij != edge_values.end()) {
-      // If the line already exist we just update the volume
-      auto current_edge = std::get<0>(edge_values.at(ij));
-      auto current_v = std::get<1>(edge_values.at(ij));
-      edge_values.at(ij) = {current_edge, current_v + v};
-      lineValuesArray->SetTuple1(
-        std::get<0>(edge_values.at(ij)), std::get<1>(edge_values.at(ij)));
-      // fmt::print("\tupdating edge {} ({}--{}): {}\n", current_edge, std::get<0>(ij), std::get<1>(ij), current_v+v);
-    } else {
-      // If it doesn't, we create it
-      // fmt::print("\tcreating edge {} ({}--{}): {}\n", n_e, std::get<0>(ij), std::get<1>(ij), v);
-      edge_value = {n_e, v};
-      edge_values.insert({ij, edge_value});
-      n_e += 1;
-      lineValuesArray->InsertNextTuple1(v);
-      vtkNew<vtkLine> line;
-      line->GetPointIds()->SetId(0, std::get<0>(ij));
-      line->GetPointIds()->SetId(1, std::get<1>(ij));
-      lines->InsertNextCell(line);
+  // Keep the edges within budget, in order of first appearance
+  if (edge_selection_.isActive()) {
+    auto const selected = edge_selection_.select(edge_volumes);
+    VT_TV_LOG(
+      Render, Debug,
+      "  Selected {} of {} communication edges", selected.size(),
+      edge_volumes.size()
+    );
+    for (uint64_t s = 0; s < selected.size(); s++) {
+      uint64_t const e = selected[s];
+      edge_volumes[s] = edge_volumes[e];
+      edge_points[2 * s] = edge_points[2 * e];
+      edge_points[2 * s + 1] = edge_points[2 * e + 1];
     }
+    edge_volumes.resize(selected.size());
+    edge_points.resize(2 * selected.size());
+  }
+
+  // Build all line cells at once from offsets and connectivity
+  uint64_t const n_e = edge_volumes.size();
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(n_e + 1);
+  for (uint64_t e = 0; e <= n_e; e++) {
+    offsets->SetValue(e, 2 * e);
+  }
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(edge_points.size());
+  std::copy(
+    edge_points.begin(), edge_points.end(), connectivity->GetPointer(0)
+  );
+  vtkNew<vtkCellArray> lines;
+  lines->SetData(offsets, connectivity);
+
+  vtkNew<vtkDoubleArray> lineValuesArray;
+  lineValuesArray->SetName("bytes");
+  lineValuesArray->SetNumberOfTuples(n_e);
+  for (uint64_t e = 0; e < n_e; e++) {
+    lineValuesArray->SetValue(e, edge_volumes[e]);
   }
 
   vtkNew<vtkPolyData> pd_mesh;
@@ -633,92 +786,603 @@ vtkNew<vtkPolyData> Render::createObjectMesh_(
   pd_mesh->SetLines(lines);
   pd_mesh->GetPointData()->SetScalars(q_arr);
   pd_mesh->GetPointData()->AddArray(b_arr);
-  if (object_qoi_ != "load") {
+  if (add_load) {
     pd_mesh->GetPointData()->AddArray(l_arr);
   }
   pd_mesh->GetCellData()->SetScalars(lineValuesArray);
+  for (auto const& array : ud_arrays) {
+    pd_mesh->GetPointData()->AddArray(array);
+  }
+
+  VT_TV_LOG(Render, Debug, "----- Finished creating object mesh -----");
+
+  return pd_mesh;
+}
+
+std::vector<uint64_t> Render::mapRanksToTiles_(
+  uint64_t tile_size, std::array<uint64_t, 3> const& tile_grid_size
+) const {
+  std::vector<uint64_t> rank_tile(n_ranks_);
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    auto const ijk = globalIDToCartesian_(rank_id, grid_size_);
+    rank_tile[rank_id] = ijk[0] / tile_size +
+      tile_grid_size[0] *
+        (ijk[1] / tile_size + tile_grid_size[1] * (ijk[2] / tile_size));
+  }
+  return rank_tile;
+}
+
+void Render::accumulateTileEdges_(
+  std::vector<std::pair<ObjectWork const*, uint64_t>> const& object_tiles,
+  TileAggregate& tiles
+) const {
+  // Communications within a tile are not drawn: only their volume is kept
+  utility::IndexHashMap objectid_to_tile(object_tiles.size());
+  for (auto const& [object_work, tile] : object_tiles) {
+    objectid_to_tile.emplace(object_work->getID(), tile);
+  }
+  utility::IndexHashMap edge_indices;
+  for (auto const& [object_work, t] : object_tiles) {
+    for (auto const& [k, v] : object_work->getSent()) {
+      uint64_t const k_tile = objectid_to_tile.find(k);
+      if (k_tile == utility::IndexHashMap::invalid) {
+        throw std::runtime_error(
+          "Object " + std::to_string(k) + " communicated with by object " +
+          std::to_string(object_work->getID()) + " is not in the mesh."
+        );
+      }
+      if (k_tile == t) {
+        tiles.internal_volume[t] += v;
+        continue;
+      }
+      uint64_t const i = std::min<uint64_t>(t, k_tile);
+      uint64_t const j = std::max<uint64_t>(t, k_tile);
+      auto const [e, inserted] = edge_indices.emplace(
+        utility::IndexHashMap::packPair(i, j), tiles.edge_volumes.size()
+      );
+      if (inserted) {
+        tiles.edges.emplace_back(i, j);
+        tiles.edge_volumes.push_back(v);
+      } else {
+        tiles.edge_volumes[e] += v;
+      }
+    }
+  }
+}
+
+double Render::computeMaxTileVolume_(
+  PhaseType phase, LBIterationType lb_iter, uint64_t tile_size
+) const {
+  // Only edges are reduced: objects need not be ordered
+  TileAggregate tiles;
+  for (uint64_t d = 0; d < 3; d++) {
+    tiles.grid_size[d] = (grid_size_[d] + tile_size - 1) / tile_size;
+  }
+  tiles.internal_volume.assign(
+    tiles.grid_size[0] * tiles.grid_size[1] * tiles.grid_size[2], 0.0);
+  auto const rank_tile = mapRanksToTiles_(tile_size, tiles.grid_size);
+  std::vector<std::pair<ObjectWork const*, uint64_t>> object_tiles;
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    auto const& objects = info_->getWorkDistribution(
+      info_->getRank(rank_id), phase, lb_iter
+    ).getObjectWork();
+    for (auto const& [obj_id, obj_work] : objects) {
+      object_tiles.emplace_back(&obj_work, rank_tile[rank_id]);
+    }
+  }
+  accumulateTileEdges_(object_tiles, tiles);
+
+  double volume_max = 0.0;
+  for (double v : tiles.edge_volumes) {
+    volume_max = std::max(volume_max, v);
+  }
+  return volume_max;
+}
+
+Render::TileAggregate Render::aggregateTiles_(
+  PhaseType phase, LBIterationType lb_iter, uint64_t tile_size
+) {
+  if (tile_size == 0) {
+    throw std::runtime_error("LOD tile size must be positive.");
+  }
+  TileAggregate tiles;
+  for (uint64_t d = 0; d < 3; d++) {
+    tiles.grid_size[d] = (grid_size_[d] + tile_size - 1) / tile_size;
+  }
+  uint64_t const n_tiles =
+    tiles.grid_size[0] * tiles.grid_size[1] * tiles.grid_size[2];
+
+  double const nan = std::numeric_limits<double>::quiet_NaN();
+  auto const ordering = createObjectOrdering_(phase, lb_iter);
+  bool const has_user_defined_qoi = info_->hasRankUserDefined(rank_qoi_);
+  bool const has_computed_qoi =
+    info_->computable_qoi_types.find(rank_qoi_) !=
+    info_->computable_qoi_types.end();
+
+  // Reduce each rank and its objects independently
+  auto const rank_tile = mapRanksToTiles_(tile_size, tiles.grid_size);
+  std::vector<double> rank_qoi(n_ranks_, nan);
+  std::vector<double> rank_object_load(n_ranks_, 0.0);
+  std::vector<double> rank_object_qoi_max(n_ranks_, nan);
+  std::vector<uint64_t> rank_migratable(n_ranks_, 0);
+  parallelFor(n_ranks_, [&](uint64_t rank_id) {
+    if (has_user_defined_qoi) {
+      auto const value = info_->getRankUserDefined(
+        info_->getRanks().at(rank_id), phase, lb_iter, rank_qoi_
+      );
+      if (auto const* d = std::get_if<double>(&value)) {
+        rank_qoi[rank_id] = *d;
+      } else if (auto const* i = std::get_if<int>(&value)) {
+        rank_qoi[rank_id] = *i;
+      }
+    } else if (has_computed_qoi) {
+      rank_qoi[rank_id] =
+        info_->getRankQOIAtPhase<double>(rank_id, phase, lb_iter, rank_qoi_);
+    }
+
+    for (uint64_t point_index = ordering.rank_offsets[rank_id];
+         point_index < ordering.rank_offsets[rank_id + 1];
+         point_index++) {
+      ObjectWork const& objectWork = *ordering.objects[point_index];
+      rank_object_load[rank_id] += objectWork.getLoad();
+      double const qoi = info_->getObjectQOI<double>(objectWork, object_qoi_);
+      if (!(qoi <= rank_object_qoi_max[rank_id])) {
+        rank_object_qoi_max[rank_id] = qoi;
+      }
+      rank_migratable[rank_id] += ordering.migratable[point_index];
+    }
+  });
+
+  // Accumulate ranks into their tile, ignoring undefined values
+  tiles.n_ranks.assign(n_tiles, 0);
+  tiles.rank_qoi_max.assign(n_tiles, nan);
+  tiles.rank_qoi_mean.assign(n_tiles, 0.0);
+  tiles.n_objects.assign(n_tiles, 0);
+  tiles.n_migratable.assign(n_tiles, 0);
+  tiles.object_load.assign(n_tiles, 0.0);
+  tiles.object_qoi_max.assign(n_tiles, nan);
+  tiles.internal_volume.assign(n_tiles, 0.0);
+  std::vector<uint64_t> n_defined(n_tiles, 0);
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    uint64_t const t = rank_tile[rank_id];
+    tiles.n_ranks[t]++;
+    if (!std::isnan(rank_qoi[rank_id])) {
+      if (!(rank_qoi[rank_id] <= tiles.rank_qoi_max[t])) {
+        tiles.rank_qoi_max[t] = rank_qoi[rank_id];
+      }
+      tiles.rank_qoi_mean[t] += rank_qoi[rank_id];
+      n_defined[t]++;
+    }
+    tiles.n_objects[t] +=
+      ordering.rank_offsets[rank_id + 1] - ordering.rank_offsets[rank_id];
+    tiles.n_migratable[t] += rank_migratable[rank_id];
+    tiles.object_load[t] += rank_object_load[rank_id];
+    if (!(rank_object_qoi_max[rank_id] <= tiles.object_qoi_max[t])) {
+      tiles.object_qoi_max[t] = rank_object_qoi_max[rank_id];
+    }
+  }
+  for (uint64_t t = 0; t < n_tiles; t++) {
+    tiles.rank_qoi_mean[t] =
+      n_defined[t] > 0 ? tiles.rank_qoi_mean[t] / n_defined[t] : nan;
+  }
+
+  std::vector<std::pair<ObjectWork const*, uint64_t>> object_tiles;
+  object_tiles.reserve(ordering.objects.size());
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    for (uint64_t point_index = ordering.rank_offsets[rank_id];
+         point_index < ordering.rank_offsets[rank_id + 1];
+         point_index++) {
+      object_tiles.emplace_back(
+        ordering.objects[point_index], rank_tile[rank_id]);
+    }
+  }
+  accumulateTileEdges_(object_tiles, tiles);
+
+  return tiles;
+}
 
-  for (auto const& [key, vtk_type] : qoi_map) {
-    if (vtk_type == VtkTypeEnum::TYPE_DOUBLE) {
-      addObjectArray<double, vtkDoubleArray>(pd_mesh, phase, lb_iter, key);
-    } else if (vtk_type == VtkTypeEnum::TYPE_INT) {
-      addObjectArray<int, vtkIntArray>(pd_mesh, phase, lb_iter, key);
+Render::RankCommunication Render::aggregateRankCommunication_(
+  PhaseType phase, LBIterationType lb_iter
+) {
+  // Objects are mapped to their rank once, in a flat table
+  std::vector<WorkDistribution const*> rank_work(n_ranks_);
+  uint64_t n_o = 0;
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    rank_work[rank_id] = &info_->getWorkDistribution(
+      info_->getRank(rank_id), phase, lb_iter
+    );
+    n_o += rank_work[rank_id]->getObjectWork().size();
+  }
+  utility::IndexHashMap objectid_to_rank(n_o);
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    for (auto const& [obj_id, obj_work] : rank_work[rank_id]->getObjectWork()) {
+      objectid_to_rank.emplace(obj_id, rank_id);
+    }
+  }
+
+  // Rows of the matrix are disjoint: each sending rank reduces its own
+  // entries, then sorts them by receiving rank
+  std::vector<std::vector<std::tuple<uint64_t, double, uint64_t>>> rows(
+    n_ranks_
+  );
+  parallelFor(n_ranks_, [&](uint64_t rank_id) {
+    auto& row = rows[rank_id];
+    utility::IndexHashMap entries;
+    for (auto const& [obj_id, obj_work] : rank_work[rank_id]->getObjectWork()) {
+      for (auto const& [k, v] : obj_work.getSent()) {
+        uint64_t const k_rank = objectid_to_rank.find(k);
+        if (k_rank == utility::IndexHashMap::invalid) {
+          throw std::runtime_error(
+            "Object " + std::to_string(k) + " communicated with by object " +
+            std::to_string(obj_id) + " is not in the mesh."
+          );
+        }
+        auto const [e, inserted] = entries.emplace(k_rank, row.size());
+        if (inserted) {
+          row.emplace_back(k_rank, v, 0);
+        } else {
+          std::get<1>(row[e]) += v;
+        }
+      }
+      // Edges stand for one or more messages, counted for each peer
+      for (auto const& [k, n] : obj_work.getSentMessages()) {
+        std::get<2>(row[entries.find(objectid_to_rank.find(k))]) += n;
+      }
+    }
+    std::sort(row.begin(), row.end());
+  });
+
+  // Rows are then concatenated at the prefix sum of their sizes
+  RankCommunication comm;
+  comm.row_offsets.resize(n_ranks_ + 1, 0);
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    comm.row_offsets[rank_id + 1] =
+      comm.row_offsets[rank_id] + rows[rank_id].size();
+  }
+  uint64_t const n_entries = comm.row_offsets[n_ranks_];
+  comm.receivers.resize(n_entries);
+  comm.bytes.resize(n_entries);
+  comm.messages.resize(n_entries);
+  parallelFor(n_ranks_, [&](uint64_t rank_id) {
+    uint64_t e = comm.row_offsets[rank_id];
+    for (auto const& [receiver, bytes, messages] : rows[rank_id]) {
+      comm.receivers[e] = receiver;
+      comm.bytes[e] = bytes;
+      comm.messages[e] = messages;
+      e++;
+    }
+  });
+
+  return comm;
+}
+
+vtkNew<vtkPolyData> Render::createRankCommunicationMesh_(
+  PhaseType phase, LBIterationType lb_iter
+) {
+  VT_TV_LOG(
+    Render, Debug,
+    "----- Creating rank communication mesh for (phase,lb_iter) ({},{}) "
+    "-----",
+    phase, printLBIter(lb_iter)
+  );
+  auto const comm = aggregateRankCommunication_(phase, lb_iter);
+  uint64_t const n_entries = comm.receivers.size();
+
+  // Both directions between two ranks are folded into a single line, and
+  // communications within a rank are kept on its point
+  std::vector<double> internal_bytes(n_ranks_, 0.0);
+  std::vector<uint64_t> internal_messages(n_ranks_, 0);
+  utility::IndexHashMap edge_indices(n_entries);
+  std::vector<vtkIdType> edge_points;
+  std::vector<double> edge_bytes;
+  std::vector<uint64_t> edge_messages;
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    for (uint64_t e = comm.row_offsets[rank_id];
+         e < comm.row_offsets[rank_id + 1];
+         e++) {
+      uint64_t const receiver = comm.receivers[e];
+      if (receiver == rank_id) {
+        internal_bytes[rank_id] += comm.bytes[e];
+        internal_messages[rank_id] += comm.messages[e];
+        continue;
+      }
+      uint64_t const i = std::min(rank_id, receiver);
+      uint64_t const j = std::max(rank_id, receiver);
+      auto const [l, inserted] = edge_indices.emplace(
+        utility::IndexHashMap::packPair(i, j), edge_bytes.size()
+      );
+      if (inserted) {
+        edge_points.push_back(i);
+        edge_points.push_back(j);
+        edge_bytes.push_back(comm.bytes[e]);
+        edge_messages.push_back(comm.messages[e]);
+      } else {
+        edge_bytes[l] += comm.bytes[e];
+        edge_messages[l] += comm.messages[e];
+      }
+    }
+  }
+  uint64_t const n_e = edge_bytes.size();
+  VT_TV_LOG(
+    Render, Debug,
+    "  Number of communicating rank pairs: {} ({} matrix entries)", n_e,
+    n_entries
+  );
+
+  auto makeIdArray = [](
+    std::string const& name, std::vector<uint64_t> const& values
+  ) {
+    auto array = vtkSmartPointer<vtkIdTypeArray>::New();
+    array->SetName(name.c_str());
+    array->SetNumberOfValues(values.size());
+    std::copy(values.begin(), values.end(), array->GetPointer(0));
+    return array;
+  };
+  auto makeDoubleArray = [](
+    std::string const& name, std::vector<double> const& values
+  ) {
+    auto array = vtkSmartPointer<vtkDoubleArray>::New();
+    array->SetName(name.c_str());
+    array->SetNumberOfTuples(values.size());
+    std::copy(values.begin(), values.end(), array->GetPointer(0));
+    return array;
+  };
+
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(n_e + 1);
+  for (uint64_t e = 0; e <= n_e; e++) {
+    offsets->SetValue(e, 2 * e);
+  }
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(edge_points.size());
+  std::copy(
+    edge_points.begin(), edge_points.end(), connectivity->GetPointer(0)
+  );
+  vtkNew<vtkCellArray> lines;
+  lines->SetData(offsets, connectivity);
+
+  vtkNew<vtkPolyData> pd_mesh;
+  pd_mesh->SetPoints(createRankPoints_());
+  pd_mesh->SetLines(lines);
+  pd_mesh->GetCellData()->SetScalars(makeDoubleArray("bytes", edge_bytes));
+  pd_mesh->GetCellData()->AddArray(makeIdArray("messages", edge_messages));
+  pd_mesh->GetPointData()->SetScalars(
+    makeDoubleArray("internal_bytes", internal_bytes));
+  pd_mesh->GetPointData()->AddArray(
+    makeIdArray("internal_messages", internal_messages));
+
+  // The directed matrix is stored in coordinate format
+  std::vector<uint64_t> senders(n_entries);
+  for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+    std::fill(
+      senders.begin() + comm.row_offsets[rank_id],
+      senders.begin() + comm.row_offsets[rank_id + 1], rank_id
+    );
+  }
+  pd_mesh->GetFieldData()->AddArray(makeIdArray("sender", senders));
+  pd_mesh->GetFieldData()->AddArray(makeIdArray("receiver", comm.receivers));
+  pd_mesh->GetFieldData()->AddArray(makeDoubleArray("sent_bytes", comm.bytes));
+  pd_mesh->GetFieldData()->AddArray(
+    makeIdArray("sent_messages", comm.messages));
+
+  VT_TV_LOG(
+    Render, Debug,
+    "----- Finished creating rank communication mesh -----");
+  return pd_mesh;
+}
+
+vtkNew<vtkPolyData> Render::createMigrationMesh_(
+  PhaseType phase, LBIterationType lb_iter
+) {
+  VT_TV_LOG(
+    Render, Debug,
+    "----- Creating migration mesh for (phase,lb_iter) ({},{}) -----",
+    phase, printLBIter(lb_iter)
+  );
+  auto const diff = info_->getMigrationDiff(phase, lb_iter);
+  auto const& migrations = diff->migrations;
+  uint64_t const n_m = migrations.size();
+  VT_TV_LOG(Render, Debug, "  Number of migrations: {}", n_m);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  points->SetNumberOfPoints(2 * n_m);
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("migration");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(2 * n_m);
+  vtkNew<vtkDoubleArray> load_arr;
+  load_arr->SetName("load");
+  load_arr->SetNumberOfTuples(n_m);
+  vtkNew<vtkIdTypeArray> object_arr;
+  object_arr->SetName("object_id");
+  object_arr->SetNumberOfValues(n_m);
+  vtkNew<vtkIdTypeArray> from_arr;
+  from_arr->SetName("from_rank");
+  from_arr->SetNumberOfValues(n_m);
+  vtkNew<vtkIdTypeArray> to_arr;
+  to_arr->SetName("to_rank");
+  to_arr->SetNumberOfValues(n_m);
+
+  float* point_coords = static_cast<float*>(points->GetVoidPointer(0));
+  double* vector_values = vectors->GetPointer(0);
+  double* loads = load_arr->GetPointer(0);
+  vtkIdType* object_ids = object_arr->GetPointer(0);
+  vtkIdType* from_ranks = from_arr->GetPointer(0);
+  vtkIdType* to_ranks = to_arr->GetPointer(0);
+  parallelFor(n_m, [&](uint64_t m) {
+    auto const& migration = migrations[m];
+    auto const from = globalIDToCartesian_(migration.from_rank, grid_size_);
+    auto const to = globalIDToCartesian_(migration.to_rank, grid_size_);
+    for (uint64_t d = 0; d < 3; d++) {
+      point_coords[6 * m + d] =
+        static_cast<float>(from[d] * grid_resolution_);
+      point_coords[6 * m + 3 + d] =
+        static_cast<float>(to[d] * grid_resolution_);
+      vector_values[6 * m + d] =
+        (static_cast<double>(to[d]) - static_cast<double>(from[d])) *
+        grid_resolution_;
+      vector_values[6 * m + 3 + d] = 0.0;
     }
+    loads[m] = migration.load;
+    object_ids[m] = static_cast<vtkIdType>(migration.object);
+    from_ranks[m] = migration.from_rank;
+    to_ranks[m] = migration.to_rank;
+  });
+
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(n_m + 1);
+  for (uint64_t m = 0; m <= n_m; m++) {
+    offsets->SetValue(m, 2 * m);
+  }
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(2 * n_m);
+  for (uint64_t p = 0; p < 2 * n_m; p++) {
+    connectivity->SetValue(p, p);
   }
+  vtkNew<vtkCellArray> lines;
+  lines->SetData(offsets, connectivity);
 
-  fmt::print("----- Finished creating object mesh -----\n");
+  vtkNew<vtkPolyData> pd_mesh;
+  pd_mesh->SetPoints(points);
+  pd_mesh->SetLines(lines);
+  pd_mesh->GetPointData()->SetVectors(vectors);
+  pd_mesh->GetCellData()->SetScalars(load_arr);
+  pd_mesh->GetCellData()->AddArray(object_arr);
+  pd_mesh->GetCellData()->AddArray(from_arr);
+  pd_mesh->GetCellData()->AddArray(to_arr);
 
+  VT_TV_LOG(Render, Debug, "----- Finished creating migration mesh -----");
   return pd_mesh;
 }
 
-template <typename T, typename U>
-void Render::addObjectArray(
-  vtkNew<vtkPolyData>& pd_mesh, PhaseType phase, LBIterationType lb_iter,
-  std::string const& key
+std::pair<vtkSmartPointer<vtkPolyData>, vtkSmartPointer<vtkPolyData>>
+Render::createTileMeshes_(
+  PhaseType phase, LBIterationType lb_iter, uint64_t tile_size
 ) {
-  auto const num_objects = info_.getPhaseObjects(phase, lb_iter).size();
+  VT_TV_LOG(
+    Render, Debug,
+    "----- Creating {}x{} rank tile meshes for (phase,lb_iter) ({},{}) -----",
+    tile_size, tile_size, phase, printLBIter(lb_iter)
+  );
+  return createTileMeshes_(aggregateTiles_(phase, lb_iter, tile_size));
+}
 
-  vtkNew<U> array;
-  array->SetName(key.c_str());
-  array->SetNumberOfTuples(num_objects);
+std::pair<vtkSmartPointer<vtkPolyData>, vtkSmartPointer<vtkPolyData>>
+Render::createTileMeshes_(TileAggregate const& tiles) {
+  uint64_t const n_tiles = tiles.n_ranks.size();
+  VT_TV_LOG(
+    Render, Debug,
+    "  Number of tiles: {} ({} communicating pairs)", n_tiles,
+    tiles.edges.size()
+  );
 
-  int point_index = 0;
-  auto object_mapping = createObjectMapping_(phase, lb_iter);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  points->SetNumberOfPoints(n_tiles);
+  for (uint64_t t = 0; t < n_tiles; t++) {
+    auto const ijk = globalIDToCartesian_(t, tiles.grid_size);
+    points->SetPoint(
+      t, ijk[0] * grid_resolution_, ijk[1] * grid_resolution_,
+      ijk[2] * grid_resolution_
+    );
+  }
 
-  for (auto const& [rankID, objects] : object_mapping) {
-    std::vector<std::pair<ObjectWork, uint64_t>> ordered_objects;
-    for (auto const& [objectID, objectWork] : objects) {
-      bool migratable = info_.getObjectInfo().at(objectID).isMigratable();
-      ordered_objects.push_back(std::make_pair(objectWork, migratable));
+  auto makeDoubleArray = [n_tiles](
+    std::string const& name, std::vector<double> const& values
+  ) {
+    auto array = vtkSmartPointer<vtkDoubleArray>::New();
+    array->SetName(name.c_str());
+    array->SetNumberOfTuples(n_tiles);
+    std::copy(values.begin(), values.end(), array->GetPointer(0));
+    return array;
+  };
+  auto makeIntArray = [n_tiles](
+    std::string const& name, std::vector<uint64_t> const& values
+  ) {
+    auto array = vtkSmartPointer<vtkIntArray>::New();
+    array->SetName(name.c_str());
+    array->SetNumberOfTuples(n_tiles);
+    for (uint64_t t = 0; t < n_tiles; t++) {
+      array->SetValue(t, static_cast<int>(values[t]));
     }
-    std::sort(ordered_objects.begin(), ordered_objects.end(), compareObjects);
+    return array;
+  };
 
-    // Add rank objects to point set
-    for (auto const& [objectWork, migratable] : ordered_objects) {
-      if (
-        auto it = objectWork.getUserDefined().find(key);
-        it != objectWork.getUserDefined().end()
-      ) {
-        //fmt::print("phase={}, key={}, id={}\n", phase, key, objectWork.getID());
-        auto const& value = it->second;
-        array->SetTuple1(point_index, std::get<T>(value));
-      } else {
-        array->SetTuple1(point_index, T{});
-      }
-      point_index++;
+  auto tile_mesh = vtkSmartPointer<vtkPolyData>::New();
+  tile_mesh->SetPoints(points);
+  tile_mesh->GetPointData()->SetScalars(
+    makeDoubleArray(rank_qoi_, tiles.rank_qoi_max));
+  tile_mesh->GetPointData()->AddArray(
+    makeDoubleArray(rank_qoi_ + "_mean", tiles.rank_qoi_mean));
+  tile_mesh->GetPointData()->AddArray(makeIntArray("n_ranks", tiles.n_ranks));
+
+  // Glyphs are sized by the mean object load, which remains in the range of
+  // the object loads, and tiles are drawn as migratable unless they hold a
+  // non-migratable object
+  std::vector<double> mean_load(n_tiles, 0.0);
+  vtkNew<vtkBitArray> b_arr;
+  b_arr->SetName("migratable");
+  b_arr->SetNumberOfTuples(n_tiles);
+  for (uint64_t t = 0; t < n_tiles; t++) {
+    if (tiles.n_objects[t] > 0) {
+      mean_load[t] = tiles.object_load[t] / tiles.n_objects[t];
     }
+    b_arr->SetValue(t, tiles.n_migratable[t] == tiles.n_objects[t]);
+  }
+
+  auto tile_object_mesh = vtkSmartPointer<vtkPolyData>::New();
+  tile_object_mesh->SetPoints(points);
+  if (object_qoi_ == "load") {
+    tile_object_mesh->GetPointData()->SetScalars(
+      makeDoubleArray("load", mean_load));
+  } else {
+    tile_object_mesh->GetPointData()->SetScalars(
+      makeDoubleArray(object_qoi_, tiles.object_qoi_max));
+    tile_object_mesh->GetPointData()->AddArray(
+      makeDoubleArray("load", mean_load));
+  }
+  tile_object_mesh->GetPointData()->AddArray(b_arr);
+  tile_object_mesh->GetPointData()->AddArray(
+    makeDoubleArray("total_load", tiles.object_load));
+  tile_object_mesh->GetPointData()->AddArray(
+    makeIntArray("n_objects", tiles.n_objects));
+  tile_object_mesh->GetPointData()->AddArray(
+    makeDoubleArray("internal_volume", tiles.internal_volume));
+
+  uint64_t const n_e = tiles.edges.size();
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(n_e + 1);
+  for (uint64_t e = 0; e <= n_e; e++) {
+    offsets->SetValue(e, 2 * e);
   }
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(2 * n_e);
+  for (uint64_t e = 0; e < n_e; e++) {
+    connectivity->SetValue(2 * e, tiles.edges[e].first);
+    connectivity->SetValue(2 * e + 1, tiles.edges[e].second);
+  }
+  vtkNew<vtkCellArray> lines;
+  lines->SetData(offsets, connectivity);
+  tile_object_mesh->SetLines(lines);
 
-  pd_mesh->GetPointData()->AddArray(array);
+  vtkNew<vtkDoubleArray> lineValuesArray;
+  lineValuesArray->SetName("bytes");
+  lineValuesArray->SetNumberOfTuples(n_e);
+  std::copy(
+    tiles.edge_volumes.begin(), tiles.edge_volumes.end(),
+    lineValuesArray->GetPointer(0)
+  );
+  tile_object_mesh->GetCellData()->SetScalars(lineValuesArray);
+
+  VT_TV_LOG(Render, Debug, "----- Finished creating tile meshes -----");
+  return {tile_mesh, tile_object_mesh};
 }
 
 void Render::getRgbFromTab20Colormap_(
   int index, double& r, double& g, double& b) {
-  const std::vector<std::tuple<double, double, double>> tab20_cmap = {
-    {0.12156862745098039, 0.4666666666666667, 0.7058823529411765},
-    {0.6823529411764706, 0.7803921568627451, 0.9098039215686274},
-    {1.0, 0.4980392156862745, 0.054901960784313725},
-    {1.0, 0.7333333333333333, 0.47058823529411764},
-    {0.17254901960784313, 0.6274509803921569, 0.17254901960784313},
-    {0.596078431372549, 0.8745098039215686, 0.5411764705882353},
-    {0.8392156862745098, 0.15294117647058825, 0.1568627450980392},
-    {1.0, 0.596078431372549, 0.5882352941176471},
-    {0.5803921568627451, 0.403921568627451, 0.7411764705882353},
-    {0.7725490196078432, 0.6901960784313725, 0.8352941176470589},
-    {0.5490196078431373, 0.33725490196078434, 0.29411764705882354},
-    {0.7686274509803922, 0.611764705882353, 0.5803921568627451},
-    {0.8901960784313725, 0.4666666666666667, 0.7607843137254902},
-    {0.9686274509803922, 0.7137254901960784, 0.8235294117647058},
-    {0.4980392156862745, 0.4980392156862745, 0.4980392156862745},
-    {0.7803921568627451, 0.7803921568627451, 0.7803921568627451},
-    {0.7372549019607844, 0.7411764705882353, 0.13333333333333333},
-    {0.8588235294117647, 0.8588235294117647, 0.5529411764705883},
-    {0.09019607843137255, 0.7450980392156863, 0.8117647058823529},
-    {0.6196078431372549, 0.8549019607843137, 0.8980392156862745}};
-  if (index < 0 || static_cast<std::size_t>(index) >= tab20_cmap.size()) {
-    throw std::runtime_error("Index out of bounds for tab20 colormap.");
-  }
-  std::tie(r, g, b) = tab20_cmap[index];
+  auto const rgb = ColorMap::getTab20Color(index);
+  std::tie(r, g, b) = std::tie(rgb[0], rgb[1], rgb[2]);
 }
 
 /*static*/ vtkSmartPointer<vtkDiscretizableColorTransferFunction>
@@ -728,85 +1392,43 @@ Render::createColorTransferFunction_(
   ColorType ct) {
   vtkSmartPointer<vtkDiscretizableColorTransferFunction> ctf =
     vtkSmartPointer<vtkDiscretizableColorTransferFunction>::New();
-  ctf->SetNanColorRGBA(1., 1., 1., 0.);
+  ColorMap const color_map(attribute_range, ct);
+  auto const& nan = color_map.getNanColor();
+  ctf->SetNanColorRGBA(nan[0], nan[1], nan[2], nan[3]);
   ctf->UseBelowRangeColorOn();
   ctf->UseAboveRangeColorOn();
 
   // Make discrete when requested
-  if (std::holds_alternative<std::set<std::variant<double, int>>>(
-        attribute_range)) {
-    const std::set<std::variant<double, int>>& values =
-      std::get<std::set<std::variant<double, int>>>(attribute_range);
-
-    // Handle the set type
+  if (color_map.isIndexed()) {
+    auto const& indexed_colors = color_map.getIndexedColors();
     ctf->DiscretizeOn();
-    int n_colors = values.size();
+    int n_colors = indexed_colors.size();
     ctf->IndexedLookupOn();
     ctf->SetNumberOfIndexedColors(n_colors);
     int i = 0;
-    for (auto v : values) {
+    for (auto const& [v, rgb] : indexed_colors) {
       std::visit(
         [&ctf](auto&& val) { ctf->SetAnnotation(val, std::to_string(val)); },
         v);
       // Use discrete color map
-      double r, g, b;
-      getRgbFromTab20Colormap_(i, r, g, b);
-      const double rgb[3] = {r, g, b};
-      ctf->SetIndexedColorRGB(i, rgb);
+      ctf->SetIndexedColorRGB(i, rgb.data());
       i++;
     }
     ctf->Build();
     return ctf;
-  } else if (std::holds_alternative<std::pair<double, double>>(
-               attribute_range)) {
-    const std::pair<double, double>& range =
-      std::get<std::pair<double, double>>(attribute_range);
-    switch (ct) {
-    case ColorType::BlueToRed: {
-      ctf->SetColorSpaceToDiverging();
-      double const mid_point = (range.first + range.second) * .5;
-      ctf->AddRGBPoint(range.first, .231, .298, .753);
-      ctf->AddRGBPoint(mid_point, .865, .865, .865);
-      ctf->AddRGBPoint(range.second, .906, .016, .109);
-      ctf->SetBelowRangeColor(0.0, 1.0, 0.0);
-      ctf->SetAboveRangeColor(1.0, 0.0, 1.0);
-      break;
-    }
-    case ColorType::HotSpot: {
-      ctf->SetColorSpaceToDiverging();
-      double const mid_point1 = (range.second - range.first) * 0.25;
-      double const mid_point2 = (range.second - range.first) * 0.75;
-
-      ctf->AddRGBPoint(range.first, 0.0, 0.0, 1.0);  // Blue
-      ctf->AddRGBPoint(mid_point1, 0.0, 1.0, 0.0);   // Green
-      ctf->AddRGBPoint(mid_point2, 1.0, 0.8, 0.0);   // Orange
-      ctf->AddRGBPoint(range.second, 1.0, 0.0, 0.0); // Red
-
-      ctf->SetBelowRangeColor(0.0, 1.0, 1.0); // Cyan
-      ctf->SetAboveRangeColor(1.0, 1.0, 0.0); // Yellow
-      break;
-    }
-    case ColorType::WhiteToBlack: {
-      ctf->AddRGBPoint(range.first, 1.0, 1.0, 1.0);
-      ctf->AddRGBPoint(range.second, 0.0, 0.0, 0.0);
-      ctf->SetBelowRangeColor(0.0, 0.0, 1.0);
-      ctf->SetAboveRangeColor(1.0, 0.0, 0.0);
-      break;
-    }
-    case ColorType::Default: {
-      double const mid_point = (range.first + range.second) * .5;
-      ctf->AddRGBPoint(range.first, .431, .761, .161);
-      ctf->AddRGBPoint(mid_point, .98, .992, .059);
-      ctf->AddRGBPoint(range.second, 1.0, .647, 0.0);
-      ctf->SetBelowRangeColor(0.8, 0.8, .8);
-      ctf->SetAboveRangeColor(1.0, 0.0, 1.0);
-      break;
-    }
-    }
-    return ctf;
-  } else {
-    throw std::runtime_error("Unexpected type in attribute_range variant.");
   }
+
+  if (color_map.isDiverging()) {
+    ctf->SetColorSpaceToDiverging();
+  }
+  for (auto const& [x, rgb] : color_map.getControlPoints()) {
+    ctf->AddRGBPoint(x, rgb[0], rgb[1], rgb[2]);
+  }
+  auto const& below = color_map.getBelowRangeColor();
+  auto const& above = color_map.getAboveRangeColor();
+  ctf->SetBelowRangeColor(below[0], below[1], below[2]);
+  ctf->SetAboveRangeColor(above[0], above[1], above[2]);
+  return ctf;
 }
 
 /*static*/ vtkSmartPointer<vtkScalarBarActor> Render::createScalarBarActor_(
@@ -968,6 +1590,11 @@ void Render::renderPNG(
   std::string output_dir,
   std::string output_file_stem
 ) {
+  utility::TraceSpan span(
+    "render_png",
+    {{"phase", static_cast<int64_t>(phase)},
+     {"lb_iter", static_cast<int64_t>(lb_iter)}});
+
   // Setup rendering space
   vtkSmartPointer<vtkRenderer> renderer = setupRenderer_();
 
@@ -994,10 +1621,16 @@ void Render::renderPNG(
   renderer->AddActor2D(rank_qoi_scale_actor);
 
   if (object_qoi_ != "") {
+    // Edges join tiles instead of objects when ranks are aggregated
+    double const volume_max =
+      tile_size_ > 1 ? tile_volume_max_ : object_volume_max_;
+    std::string const volume_title =
+      tile_size_ > 1 ? "Inter-Tile Volume" : "Inter-Object Volume";
+
     // Create white to black lookup table
     vtkSmartPointer<vtkLookupTable> bw_lut =
       vtkSmartPointer<vtkLookupTable>::New();
-    bw_lut->SetTableRange(0.0, object_volume_max_);
+    bw_lut->SetTableRange(0.0, volume_max);
     bw_lut->SetSaturationRange(0, 0);
     bw_lut->SetHueRange(0, 0);
     bw_lut->SetValueRange(1, 0);
@@ -1009,7 +1642,7 @@ void Render::renderPNG(
       vtkSmartPointer<vtkPolyDataMapper>::New();
     edge_mapper->SetInputData(object_mesh);
     edge_mapper->SetScalarModeToUseCellData();
-    edge_mapper->SetScalarRange(0.0, object_volume_max_);
+    edge_mapper->SetScalarRange(0.0, volume_max);
     edge_mapper->SetLookupTable(bw_lut);
 
     // Create communication volume and its scalar bar actors
@@ -1017,7 +1650,7 @@ void Render::renderPNG(
     edge_actor->SetMapper(edge_mapper);
     edge_actor->GetProperty()->SetLineWidth(edge_width);
     vtkSmartPointer<vtkScalarBarActor> volume_actor = createScalarBarActor_(
-      edge_mapper, "Inter-Object Volume", 0.04, 0.04, font_size);
+      edge_mapper, volume_title, 0.04, 0.04, font_size);
     // Add communications visualization to renderer
     renderer->AddActor(edge_actor);
     renderer->AddActor2D(volume_actor);
@@ -1135,26 +1768,10 @@ void Render::renderPNG(
   }
 
   // Add field data text information to render
-  // Create text
-  std::stringstream ss;
-  if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
-    ss << "Phase: " << phase;
-  } else {
-    ss << "Phase: " << phase << "/" << (n_phases_ - 1);
-  }
-  if (lb_iter != no_lb_iter) {
-    auto const n_lb_iters =
-      info_.getRank(0).getPhaseWork().at(phase).getLBIterations().size();
-    ss << ", Iter: " << lb_iter << "/" << n_lb_iters;
-  }
-  ss << "\n";
-  ss << "Load Imbalance: " << std::fixed << std::setprecision(2)
-     << info_.getImbalance(phase, lb_iter);
-
   // Setup text actor
   vtkSmartPointer<vtkTextActor> text_actor =
     vtkSmartPointer<vtkTextActor>::New();
-  text_actor->SetInput(ss.str().c_str());
+  text_actor->SetInput(getFrameCaption_(phase, lb_iter).c_str());
   vtkTextProperty* textProp = text_actor->GetTextProperty();
   textProp->SetColor(0.0, 0.0, 0.0);
   textProp->ItalicOff();
@@ -1181,18 +1798,550 @@ void Render::renderPNG(
   vtkNew<vtkWindowToImageFilter> w2i;
   w2i->SetInput(render_window);
   w2i->SetScale(1);
+  w2i->Update();
+
+  // Copy the image out of the render window, flipping rows to top-down
+  vtkImageData* image = w2i->GetOutput();
+  int dims[3];
+  image->GetDimensions(dims);
+  auto scalars =
+    vtkUnsignedCharArray::SafeDownCast(image->GetPointData()->GetScalars());
+  auto const channels = static_cast<uint8_t>(scalars->GetNumberOfComponents());
+  std::size_t const row_size = static_cast<std::size_t>(dims[0]) * channels;
+  std::vector<uint8_t> pixels(row_size * dims[1]);
+  for (int y = 0; y < dims[1]; y++) {
+    std::copy_n(
+      scalars->GetPointer(0) + row_size * (dims[1] - 1 - y),
+      row_size,
+      pixels.begin() + row_size * y);
+  }
 
   // Export the PNG image
-  vtkNew<vtkPNGWriter> writer;
-  writer->SetInputConnection(w2i->GetOutputPort());
   std::string png_filename =
     output_dir + output_file_stem + std::to_string(cur_frame) + ".png";
-  writer->SetFileName(png_filename.c_str());
-  writer->SetCompressionLevel(2);
+  writePNG_(std::move(pixels), dims[0], dims[1], channels, png_filename);
+}
+
+void Render::renderRasterPNG(
+  PhaseType phase,
+  LBIterationType lb_iter,
+  int cur_frame,
+  vtkPolyData* rank_mesh,
+  vtkPolyData* object_mesh,
+  uint64_t edge_width,
+  double glyph_factor,
+  uint64_t win_size,
+  uint64_t font_size,
+  std::string output_dir,
+  std::string output_file_stem
+) {
+  utility::TraceSpan span(
+    "render_raster_png",
+    {{"phase", static_cast<int64_t>(phase)},
+     {"lb_iter", static_cast<int64_t>(lb_iter)}});
+
+  RasterRenderer raster(win_size, win_size);
+  ColorMap const rank_color_map(rank_qoi_range_, ColorType::BlueToRed);
+  ColorMap const object_color_map(object_qoi_range_);
+  double const volume_max =
+    tile_size_ > 1 ? tile_volume_max_ : object_volume_max_;
+  ColorMap const volume_color_map(
+    std::make_pair(0.0, volume_max), ColorType::WhiteToBlack);
+
+  // Rank glyphs have the same size as with vtkGlyphSource2D
+  double const rank_half_size = 0.5 * 0.95;
+  bool const draw_objects = object_qoi_ != "";
+
+  vtkDataArray* object_qoi_arr = nullptr;
+  vtkDataArray* load_arr = nullptr;
+  vtkDataArray* migratable_arr = nullptr;
+  if (draw_objects) {
+    auto point_data = object_mesh->GetPointData();
+    object_qoi_arr = point_data->GetArray(object_qoi_.c_str());
+    load_arr = point_data->GetArray("load");
+    migratable_arr = point_data->GetArray("migratable");
+  }
+  auto objectHalfSize = [&](vtkIdType i) {
+    return 0.5 * glyph_factor * std::sqrt(load_arr->GetTuple1(i));
+  };
+
+  // Fit the bounds of all glyphs in the view, as vtkRenderer::ResetCamera
+  std::array<double, 4> bounds = {
+    std::numeric_limits<double>::infinity(),
+    -std::numeric_limits<double>::infinity(),
+    std::numeric_limits<double>::infinity(),
+    -std::numeric_limits<double>::infinity()};
+  auto extendBounds = [&bounds](double const* p, double half) {
+    bounds[0] = std::min(bounds[0], p[0] - half);
+    bounds[1] = std::max(bounds[1], p[0] + half);
+    bounds[2] = std::min(bounds[2], p[1] - half);
+    bounds[3] = std::max(bounds[3], p[1] + half);
+  };
+  for (vtkIdType i = 0; i < rank_mesh->GetNumberOfPoints(); i++) {
+    extendBounds(rank_mesh->GetPoint(i), rank_half_size);
+  }
+  if (draw_objects && load_arr != nullptr) {
+    for (vtkIdType i = 0; i < object_mesh->GetNumberOfPoints(); i++) {
+      extendBounds(object_mesh->GetPoint(i), objectHalfSize(i));
+    }
+  }
+  if (bounds[0] <= bounds[1]) {
+    double const dx = bounds[1] - bounds[0];
+    double const dy = bounds[3] - bounds[2];
+    raster.setView(
+      0.5 * (bounds[0] + bounds[1]),
+      0.5 * (bounds[2] + bounds[3]),
+      std::sqrt(dx * dx + dy * dy));
+  }
+
+  // Ranks are drawn first, then edges, then object glyphs on top
+  vtkDataArray* rank_qoi_arr = rank_mesh->GetPointData()->GetScalars();
+  for (vtkIdType i = 0; i < rank_mesh->GetNumberOfPoints(); i++) {
+    double const* p = rank_mesh->GetPoint(i);
+    double const value = rank_qoi_arr != nullptr ?
+      rank_qoi_arr->GetTuple1(i) : std::numeric_limits<double>::quiet_NaN();
+    raster.addRect(
+      p[0] - rank_half_size, p[1] - rank_half_size, p[0] + rank_half_size,
+      p[1] + rank_half_size, rank_color_map.getColor(value));
+  }
+
+  if (draw_objects) {
+    vtkCellArray* lines = object_mesh->GetLines();
+    vtkDataArray* bytes_arr = object_mesh->GetCellData()->GetScalars();
+    vtkNew<vtkIdList> line_ids;
+    for (vtkIdType e = 0; e < lines->GetNumberOfCells(); e++) {
+      lines->GetCellAtId(e, line_ids);
+      if (line_ids->GetNumberOfIds() != 2) {
+        continue;
+      }
+      // Same 256-entry gray ramp as the VTK lookup table
+      double const t = volume_max > 0.0 && bytes_arr != nullptr ?
+        std::clamp(bytes_arr->GetTuple1(e) / volume_max, 0.0, 1.0) :
+        0.0;
+      double const gray = 1.0 - std::min(std::floor(t * 256.0), 255.0) / 255.0;
+      double p0[3], p1[3];
+      object_mesh->GetPoint(line_ids->GetId(0), p0);
+      object_mesh->GetPoint(line_ids->GetId(1), p1);
+      raster.addLine(
+        p0[0], p0[1], p1[0], p1[1], edge_width, {gray, gray, gray, 1.0});
+    }
+
+    if (object_qoi_arr != nullptr && load_arr != nullptr) {
+      // Non-migratable objects are squares, migratable ones circles
+      for (int migratable = 0; migratable < 2; migratable++) {
+        for (vtkIdType i = 0; i < object_mesh->GetNumberOfPoints(); i++) {
+          bool const is_migratable = migratable_arr != nullptr &&
+            migratable_arr->GetTuple1(i) != 0.0;
+          if (is_migratable != static_cast<bool>(migratable)) {
+            continue;
+          }
+          double const* p = object_mesh->GetPoint(i);
+          double const half = objectHalfSize(i);
+          auto const color =
+            object_color_map.getColor(object_qoi_arr->GetTuple1(i));
+          if (is_migratable) {
+            raster.addCircle(p[0], p[1], half, color);
+          } else {
+            raster.addRect(
+              p[0] - half, p[1] - half, p[0] + half, p[1] + half, color);
+          }
+        }
+      }
+    }
+  }
+
+  // Legends at the same positions as the VTK scalar bars and text
+  raster.addColorBar(
+    rank_color_map, "Rank " + rank_qoi_, 0.5, 0.9, 0.42, 0.08, font_size, true);
+  if (draw_objects) {
+    raster.addColorBar(
+      volume_color_map,
+      tile_size_ > 1 ? "Inter-Tile Volume" : "Inter-Object Volume", 0.04, 0.04,
+      0.42, 0.08, font_size);
+    raster.addColorBar(
+      object_color_map, "Object " + object_qoi_, 0.52, 0.04, 0.42, 0.08,
+      font_size);
+  }
+  raster.addText(getFrameCaption_(phase, lb_iter), 0.04, 0.91, font_size);
+
+  raster.render();
+
+  std::string png_filename =
+    output_dir + output_file_stem + std::to_string(cur_frame) + ".png";
+  writePNG_(
+    raster.getPixels(), raster.getWidth(), raster.getHeight(),
+    RasterRenderer::getChannels(), png_filename);
+}
+
+void Render::submitOutput_(std::function<void()> task) {
+  if (writer_) {
+    writer_->submit(std::move(task));
+  } else {
+    task();
+  }
+}
+
+void Render::writeMesh_(
+  vtkPolyData* mesh, std::string const& name, uint64_t part, uint64_t frame
+) {
+  std::string const file =
+    output_file_stem_ + "_" + name + "_" + std::to_string(frame) + ".vtp";
+
+  // The writer caches ranges in the arrays of the mesh: it must no longer be
+  // used by the caller
+  vtkSmartPointer<vtkPolyData> data = mesh;
+  submitOutput_([data, filename = output_dir_ + file, file, name, part, frame,
+                 collection = collection_, encoding = vtp_encoding_,
+                 compressor = vtp_compressor_,
+                 level = vtp_compression_level_] {
+    utility::TraceSpan span("write_vtp");
+    writeVTP(data, filename, encoding, compressor, level);
+    utility::Trace::get().count("meshes_written", 1);
+
+    // Readers only find meshes in the collection once they are complete
+    if (collection) {
+      collection->addDataSet(static_cast<double>(frame), part, name, file);
+    }
+  });
+}
+
+/*static*/ void Render::writeVTP(
+  vtkPolyData* mesh,
+  std::string const& filename,
+  VTPEncodingType encoding,
+  VTPCompressorType compressor,
+  int compression_level
+) {
+  vtkNew<vtkXMLPolyDataWriter> writer;
+  writer->SetFileName(filename.c_str());
+  writer->SetInputData(mesh);
+  writer->SetDataModeToAppended();
+  if (encoding == VTPEncodingType::Raw) {
+    writer->EncodeAppendedDataOff();
+  } else {
+    writer->EncodeAppendedDataOn();
+  }
+  switch (compressor) {
+  case VTPCompressorType::None:
+    writer->SetCompressorTypeToNone();
+    break;
+  case VTPCompressorType::ZLib:
+    writer->SetCompressorTypeToZLib();
+    writer->SetCompressionLevel(compression_level);
+    break;
+  case VTPCompressorType::LZ4:
+    writer->SetCompressorTypeToLZ4();
+    writer->SetCompressionLevel(compression_level);
+    break;
+  }
   writer->Write();
 }
 
+void Render::writePNG_(
+  std::vector<uint8_t> pixels,
+  uint32_t width,
+  uint32_t height,
+  uint8_t channels,
+  std::string const& filename
+) {
+  utility::MemoryReport::get().addBuffer("png_pixels", pixels.size());
+  if (animation_) {
+    animation_queue_->submit(
+      [animation = animation_, pixels = std::move(pixels), width, height,
+       channels] {
+        utility::TraceSpan span("animation_frame");
+        animation->addFrame(pixels.data(), width, height, channels);
+      });
+    return;
+  }
+
+  int const level = png_compression_level_;
+  if (png_encoder_ == PNGEncoderType::Builtin) {
+    submitOutput_(
+      [pixels = std::move(pixels), width, height, channels, filename, level] {
+        utility::TraceSpan span("encode_png");
+        utility::PNGEncoder(level).write(
+          filename, pixels.data(), width, height, channels);
+        utility::Trace::get().count("pngs_written", 1);
+      });
+    return;
+  }
+
+  submitOutput_(
+    [pixels = std::move(pixels), width, height, channels, filename, level] {
+      utility::TraceSpan span("encode_png");
+      // VTK images are stored bottom-up
+      vtkNew<vtkImageData> image;
+      image->SetDimensions(width, height, 1);
+      image->AllocateScalars(VTK_UNSIGNED_CHAR, channels);
+      auto scalars = static_cast<uint8_t*>(image->GetScalarPointer());
+      std::size_t const row_size = static_cast<std::size_t>(width) * channels;
+      for (uint32_t y = 0; y < height; y++) {
+        std::copy_n(
+          pixels.begin() + row_size * (height - 1 - y),
+          row_size,
+          scalars + row_size * y);
+      }
+
+      vtkNew<vtkPNGWriter> writer;
+      writer->SetInputData(image);
+      writer->SetFileName(filename.c_str());
+      writer->SetCompressionLevel(level);
+      writer->Write();
+      utility::Trace::get().count("pngs_written", 1);
+    });
+}
+
+void Render::writeExodusStep_(
+  PhaseType phase,
+  LBIterationType lb_iter,
+  uint64_t frame,
+  vtkPolyData* rank_mesh,
+  vtkPolyData* object_mesh,
+  ObjectOrdering const& ordering
+) {
+  // Object points follow the ordering of the frame, which identifies them
+  uint64_t const n_o = ordering.objects.size();
+  auto getObjectNode = [&](uint64_t point_index) {
+    ElementIDType const obj_id = ordering.objects[point_index]->getID();
+    uint64_t const node = exodus_object_nodes_.find(obj_id);
+    if (node == utility::IndexHashMap::invalid) {
+      throw std::runtime_error(
+        "Object " + std::to_string(obj_id) + " has no Exodus element.");
+    }
+    return node;
+  };
+
+  if (!exodus_) {
+    auto getArrayNames = [](vtkPolyData* mesh) {
+      std::vector<std::string> names;
+      vtkPointData* point_data = mesh->GetPointData();
+      for (int i = 0; i < point_data->GetNumberOfArrays(); i++) {
+        vtkDataArray* array = point_data->GetArray(i);
+        if (array && array->GetName()) {
+          names.emplace_back(array->GetName());
+        }
+      }
+      return names;
+    };
+
+    // Rank nodes come first, followed by all objects of the run sorted by ID
+    auto const object_ids = info_->getAllObjectIDs();
+    exodus_object_nodes_ = utility::IndexHashMap(object_ids.size());
+    uint64_t node = n_ranks_;
+    for (auto const& obj_id : object_ids) {
+      exodus_object_nodes_.emplace(obj_id, node++);
+    }
+
+    // Objects are placed at their first position, ranks do not move
+    exodus_reference_.assign(n_ranks_ + object_ids.size(), {0.0, 0.0, 0.0});
+    for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+      rank_mesh->GetPoint(rank_id, exodus_reference_[rank_id].data());
+    }
+    for (uint64_t point_index = 0; point_index < n_o; point_index++) {
+      object_mesh->GetPoint(
+        point_index, exodus_reference_[getObjectNode(point_index)].data());
+    }
+
+    std::vector<std::string> object_variables = getArrayNames(object_mesh);
+    for (std::string name : {"rank_id", "present"}) {
+      if (
+        std::find(object_variables.begin(), object_variables.end(), name) ==
+        object_variables.end()) {
+        object_variables.push_back(name);
+      }
+    }
+
+    std::string const filename = output_dir_ + output_file_stem_ + ".exo";
+    VT_TV_LOG(Render, Info, "== Creating Exodus file {}", filename);
+    exodus_ = std::make_shared<utility::ExodusWriter>(
+      filename,
+      "vt-tv " + output_file_stem_,
+      exodus_reference_,
+      std::vector<utility::ExodusWriter::Block>{
+        {"ranks", n_ranks_, getArrayNames(rank_mesh)},
+        {"objects", object_ids.size(), std::move(object_variables)}},
+      std::vector<std::string>{"phase", "lb_iteration", "imbalance"});
+  }
+
+  auto const& blocks = exodus_->getBlocks();
+  std::vector<std::array<double, 3>> displacements(
+    exodus_reference_.size(), {0.0, 0.0, 0.0});
+  std::vector<std::vector<std::vector<double>>> values(blocks.size());
+
+  // Arrays missing from later meshes are written as zeros
+  vtkPointData* rank_data = rank_mesh->GetPointData();
+  for (auto const& name : blocks[0].variables) {
+    auto& v = values[0].emplace_back(n_ranks_, 0.0);
+    if (vtkDataArray* array = rank_data->GetArray(name.c_str())) {
+      for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+        v[rank_id] = array->GetTuple1(rank_id);
+      }
+    }
+  }
+
+  // Objects move between frames: their positions become displacements
+  std::vector<uint64_t> elements(n_o);
+  for (uint64_t point_index = 0; point_index < n_o; point_index++) {
+    uint64_t const node = getObjectNode(point_index);
+    elements[point_index] = node - n_ranks_;
+    std::array<double, 3> position;
+    object_mesh->GetPoint(point_index, position.data());
+    for (uint64_t d = 0; d < 3; d++) {
+      displacements[node][d] = position[d] - exodus_reference_[node][d];
+    }
+  }
+
+  vtkPointData* object_data = object_mesh->GetPointData();
+  uint64_t const n_elements = blocks[1].n_elements;
+  for (auto const& name : blocks[1].variables) {
+    if (name == "rank_id") {
+      auto& v = values[1].emplace_back(n_elements, -1.0);
+      for (uint64_t rank_id = 0; rank_id < n_ranks_; rank_id++) {
+        for (uint64_t point_index = ordering.rank_offsets[rank_id];
+             point_index < ordering.rank_offsets[rank_id + 1];
+             point_index++) {
+          v[elements[point_index]] = static_cast<double>(rank_id);
+        }
+      }
+    } else if (name == "present") {
+      auto& v = values[1].emplace_back(n_elements, 0.0);
+      for (auto element : elements) {
+        v[element] = 1.0;
+      }
+    } else {
+      auto& v = values[1].emplace_back(n_elements, 0.0);
+      if (vtkDataArray* array = object_data->GetArray(name.c_str())) {
+        for (uint64_t point_index = 0; point_index < n_o; point_index++) {
+          v[elements[point_index]] = array->GetTuple1(point_index);
+        }
+      }
+    }
+  }
+
+  std::vector<double> globals = {
+    static_cast<double>(phase),
+    lb_iter == no_lb_iter ? -1.0 : static_cast<double>(lb_iter),
+    info_->getImbalance(phase, lb_iter)};
+
+  // Time steps must be appended in order: a single thread streams them
+  exodus_queue_->submit(
+    [exodus = exodus_, frame, displacements = std::move(displacements),
+     globals = std::move(globals), values = std::move(values)] {
+      exodus->addStep(
+        static_cast<double>(frame), displacements, globals, values);
+    });
+}
+
+void Render::setPNGEncoder(
+  PNGEncoderType in_png_encoder, int in_compression_level
+) {
+  if (in_compression_level < 0 || in_compression_level > 9) {
+    throw std::runtime_error(
+      "PNG compression level must be between 0 and 9 (got " +
+      std::to_string(in_compression_level) + ").");
+  }
+  png_encoder_ = in_png_encoder;
+  png_compression_level_ = in_compression_level;
+}
+
+/*static*/ PNGEncoderType Render::getPNGEncoderType(std::string const& name) {
+  if (name == "vtk") {
+    return PNGEncoderType::VTK;
+  } else if (name == "builtin") {
+    return PNGEncoderType::Builtin;
+  }
+  throw std::runtime_error(
+    "Unknown PNG encoder \"" + name + "\" (expected \"vtk\" or \"builtin\").");
+}
+
+void Render::setVTPOutput(
+  VTPEncodingType in_encoding,
+  VTPCompressorType in_compressor,
+  int in_compression_level
+) {
+  if (in_compression_level < 1 || in_compression_level > 9) {
+    throw std::runtime_error(
+      "VTP compression level must be between 1 and 9 (got " +
+      std::to_string(in_compression_level) + ").");
+  }
+  vtp_encoding_ = in_encoding;
+  vtp_compressor_ = in_compressor;
+  vtp_compression_level_ = in_compression_level;
+}
+
+/*static*/ VTPEncodingType Render::getVTPEncodingType(std::string const& name) {
+  if (name == "base64") {
+    return VTPEncodingType::Base64;
+  } else if (name == "raw") {
+    return VTPEncodingType::Raw;
+  }
+  throw std::runtime_error(
+    "Unknown VTP encoding \"" + name + "\" (expected \"base64\" or \"raw\").");
+}
+
+/*static*/ VTPCompressorType
+Render::getVTPCompressorType(std::string const& name) {
+  if (name == "none") {
+    return VTPCompressorType::None;
+  } else if (name == "zlib") {
+    return VTPCompressorType::ZLib;
+  } else if (name == "lz4") {
+    return VTPCompressorType::LZ4;
+  }
+  throw std::runtime_error(
+    "Unknown VTP compressor \"" + name +
+    "\" (expected \"none\", \"zlib\" or \"lz4\").");
+}
+
+/*static*/ MeshCollectionType
+Render::getMeshCollectionType(std::string const& name) {
+  if (name == "none") {
+    return MeshCollectionType::None;
+  } else if (name == "pvd") {
+    return MeshCollectionType::PVD;
+  }
+  throw std::runtime_error(
+    "Unknown mesh collection \"" + name + "\" (expected \"none\" or \"pvd\").");
+}
+
+uint64_t Render::getLODTileSize(uint64_t win_size) const {
+  if (lod_tile_size_ != 0) {
+    return lod_tile_size_;
+  }
+  // Keep tiles at least 16 pixels wide along the longest grid dimension
+  uint64_t const max_tiles = std::max<uint64_t>(win_size / 16, 1);
+  uint64_t const max_dim =
+    *std::max_element(grid_size_.begin(), grid_size_.end());
+  return std::max<uint64_t>((max_dim + max_tiles - 1) / max_tiles, 1);
+}
+
+/*static*/ utility::AnimationFormat
+Render::getAnimationFormat(std::string const& name) {
+  if (name == "none") {
+    return utility::AnimationFormat::None;
+  } else if (name == "apng") {
+    return utility::AnimationFormat::APNG;
+  } else if (name == "y4m") {
+    return utility::AnimationFormat::Y4M;
+  }
+  throw std::runtime_error(
+    "Unknown animation format \"" + name +
+    "\" (expected \"none\", \"apng\" or \"y4m\").");
+}
+
+/*static*/ RendererType Render::getRendererType(std::string const& name) {
+  if (name == "vtk") {
+    return RendererType::VTK;
+  } else if (name == "raster") {
+    return RendererType::Raster;
+  }
+  throw std::runtime_error(
+    "Unknown renderer \"" + name + "\" (expected \"vtk\" or \"raster\").");
+}
+
 void Render::generate(uint64_t font_size, uint64_t win_size) {
+  utility::TraceSpan generate_span("generate");
   double rank_qoi_min = rank_qoi_range_.first;
   double rank_qoi_max = rank_qoi_range_.second;
 
@@ -1200,47 +2349,127 @@ void Render::generate(uint64_t font_size, uint64_t win_size) {
     auto range_pair = std::get<std::pair<double, double>>(object_qoi_range_);
     double object_qoi_min = range_pair.first;
     double object_qoi_max = range_pair.second;
-    fmt::print(
-      "Rank {} range: {}, {}\n", rank_qoi_, rank_qoi_min, rank_qoi_max);
-    fmt::print(
-      "Object {} range: {}, {}\n", object_qoi_, object_qoi_min, object_qoi_max);
+    VT_TV_LOG(
+      Render, Info,
+      "Rank {} range: {}, {}", rank_qoi_, rank_qoi_min, rank_qoi_max);
+    VT_TV_LOG(
+      Render, Info,
+      "Object {} range: {}, {}", object_qoi_, object_qoi_min, object_qoi_max);
+  }
+
+  VT_TV_LOG(Render, Info, "selected phase={}", selected_phase_);
+
+  // Images and meshes are encoded and written in the background
+  writer_ = std::make_shared<utility::AsyncWriter>(
+    n_writer_threads_, writer_queue_size_);
+  if (save_meshes_ && mesh_collection_ == MeshCollectionType::PVD) {
+    collection_ = std::make_shared<utility::PVDWriter>(
+      output_dir_ + output_file_stem_ + ".pvd");
+  }
+  if (save_pngs_ && animation_format_ != utility::AnimationFormat::None) {
+    // Frames must be appended in order: a single thread streams them
+    animation_ = std::make_shared<utility::AnimationWriter>(
+      output_dir_ + output_file_stem_ +
+        utility::AnimationWriter::getExtension(animation_format_),
+      animation_format_, animation_fps_, png_compression_level_);
+    animation_queue_ = std::make_shared<utility::AsyncWriter>(
+      std::min<uint64_t>(n_writer_threads_, 1), writer_queue_size_);
+  }
+  if (save_exodus_) {
+    exodus_queue_ = std::make_shared<utility::AsyncWriter>(
+      std::min<uint64_t>(n_writer_threads_, 1), writer_queue_size_);
+  }
+
+  auto forEachFrame = [&](auto&& fn) {
+    if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
+      fn(selected_phase_, no_lb_iter);
+      auto const& lb_iters =
+        info_->getRank(0).getPhaseWork().at(selected_phase_).getLBIterations();
+      for (auto const& [id, _] : lb_iters) {
+        fn(selected_phase_, id);
+      }
+    } else {
+      for (PhaseType phase = 0; phase < n_phases_; phase++) {
+        fn(phase, no_lb_iter);
+        auto const& lb_iters =
+          info_->getRank(0).getPhaseWork().at(phase).getLBIterations();
+        for (auto const& [id, _] : lb_iters) {
+          fn(phase, id);
+        }
+      }
+    }
+  };
+
+  // Images of large rank grids are rendered from tiles of ranks, whose
+  // communication volumes are scaled consistently across frames: only the
+  // largest is found upfront, tiles being reduced as their frame is rendered
+  tile_size_ = save_pngs_ ? getLODTileSize(win_size) : 1;
+  tile_volume_max_ = 0.0;
+  std::array<uint64_t, 3> tile_grid_size = grid_size_;
+  if (tile_size_ > 1) {
+    VT_TV_LOG(
+      Render, Info,
+      "== Rendering {}x{} rank tiles in images", tile_size_, tile_size_
+    );
+    for (auto& n : tile_grid_size) {
+      n = (n + tile_size_ - 1) / tile_size_;
+    }
+    forEachFrame([&](PhaseType phase, LBIterationType lb_iter) {
+      utility::TraceSpan span(
+        "max_tile_volume",
+        {{"phase", static_cast<int64_t>(phase)},
+         {"lb_iter", static_cast<int64_t>(lb_iter)}});
+      tile_volume_max_ = std::max(
+        tile_volume_max_, computeMaxTileVolume_(phase, lb_iter, tile_size_));
+    });
   }
 
-  fmt::print("selected phase={}\n", selected_phase_);
+  // Full-resolution meshes are only built when they are written or drawn
+  bool const create_meshes = save_meshes_ || save_exodus_ || tile_size_ <= 1;
 
   auto createMeshAndRender = [&](
     PhaseType phase, LBIterationType lb_iter, int& cur_frame
   ) {
-    vtkNew<vtkPolyData> object_mesh = createObjectMesh_(phase, lb_iter);
-    vtkNew<vtkPolyData> rank_mesh = createRankMesh_(phase, lb_iter);
+    utility::TraceSpan frame_span(
+      "frame",
+      {{"phase", static_cast<int64_t>(phase)},
+       {"lb_iter", static_cast<int64_t>(lb_iter)}});
+    utility::Trace::get().count("frames", 1);
+
+    // The Exodus step identifies the points of the object mesh by the
+    // ordering the mesh was built from
+    ObjectOrdering ordering;
+    vtkSmartPointer<vtkPolyData> object_mesh;
+    vtkSmartPointer<vtkPolyData> rank_mesh;
+    if (create_meshes) {
+      utility::TraceSpan span("create_meshes");
+      ordering = createObjectOrdering_(phase, lb_iter);
+      object_mesh = createObjectMesh_(phase, lb_iter, ordering);
+      rank_mesh = createRankMesh_(phase, lb_iter);
+      auto& report = utility::MemoryReport::get();
+      if (report.isEnabled()) {
+        // VTK reports the memory of a data set in KiB
+        report.addBuffer(
+          "object_mesh", 1024 * object_mesh->GetActualMemorySize());
+        report.addBuffer("rank_mesh", 1024 * rank_mesh->GetActualMemorySize());
+      }
+    }
 
-    if (save_meshes_) {
-      fmt::print(
-        "== Writing object mesh for (phase,lb_iter)= ({},{})\n",
+    if (save_exodus_) {
+      VT_TV_LOG(
+        Render, Info,
+        "== Writing Exodus time step for (phase,lb_iter)= ({},{})",
         phase, printLBIter(lb_iter)
       );
-      vtkNew<vtkXMLPolyDataWriter> writer;
-      std::string object_mesh_filename = output_dir_ + output_file_stem_ +
-        "_object_mesh_" + std::to_string(cur_frame) + ".vtp";
-      writer->SetFileName(object_mesh_filename.c_str());
-      writer->SetInputData(object_mesh);
-      writer->Write();
-
-      fmt::print(
-        "== Writing rank mesh for (phase,lb_iter)= ({},{})\n", phase,
-        printLBIter(lb_iter)
-      );
-      vtkNew<vtkXMLPolyDataWriter> writer2;
-      std::string rank_mesh_filneame = output_dir_ + output_file_stem_ +
-        "_rank_mesh_" + std::to_string(cur_frame) + ".vtp";
-      writer2->SetFileName(rank_mesh_filneame.c_str());
-      writer2->SetInputData(rank_mesh);
-      writer2->Write();
+      utility::TraceSpan span("exodus_step");
+      writeExodusStep_(
+        phase, lb_iter, cur_frame, rank_mesh, object_mesh, ordering);
     }
 
     if (save_pngs_) {
-      fmt::print(
-        "== Rendering visualization PNG for (phase,lb_iter)= ({},{})\n",
+      VT_TV_LOG(
+        Render, Info,
+        "== Rendering visualization PNG for (phase,lb_iter)= ({},{})",
         phase, printLBIter(lb_iter)
       );
 
@@ -1248,52 +2477,147 @@ void Render::generate(uint64_t font_size, uint64_t win_size) {
       try {
         obj_qoi_range = std::get<std::pair<double, double>>(object_qoi_range_);
       } catch (const std::exception& e) {
-        std::cerr << e.what() << '\n';
+        VT_TV_LOG(Render, Warning, "Warning: {}", e.what());
         obj_qoi_range = {0, 1};
       }
 
+      // Each tile is drawn as a rank holding a single object
+      std::pair<vtkSmartPointer<vtkPolyData>, vtkSmartPointer<vtkPolyData>>
+        png_meshes = {rank_mesh, object_mesh};
+      uint64_t o_per_dim = max_o_per_dim_;
+      if (tile_size_ > 1) {
+        utility::TraceSpan span("tile_meshes");
+        png_meshes = createTileMeshes_(phase, lb_iter, tile_size_);
+        o_per_dim = 1;
+        auto& report = utility::MemoryReport::get();
+        if (report.isEnabled()) {
+          report.addBuffer(
+            "tile_meshes",
+            1024 * (png_meshes.first->GetActualMemorySize() +
+                    png_meshes.second->GetActualMemorySize()));
+        }
+      }
+
       uint64_t window_size = win_size;
       uint64_t edge_width = 0.03 * window_size /
-        *std::max_element(grid_size_.begin(), grid_size_.end());
+        *std::max_element(tile_grid_size.begin(), tile_grid_size.end());
       double glyph_factor = 0.8 * grid_resolution_ /
-        ((max_o_per_dim_ + 1) * std::sqrt(object_load_max_));
-      fmt::print("  Image size: {}x{}px\n", win_size, win_size);
-      fmt::print("  Font size: {}pt\n", font_size);
-
-      renderPNG(
-        phase,
-        lb_iter,
-        cur_frame,
-        rank_mesh,
-        object_mesh,
-        edge_width,
-        glyph_factor,
-        window_size,
-        font_size,
-        output_dir_,
-        output_file_stem_
+        ((o_per_dim + 1) * std::sqrt(object_load_max_));
+      VT_TV_LOG(Render, Info, "  Image size: {}x{}px", win_size, win_size);
+      VT_TV_LOG(Render, Info, "  Font size: {}pt", font_size);
+
+      if (renderer_type_ == RendererType::Raster) {
+        renderRasterPNG(
+          phase,
+          lb_iter,
+          cur_frame,
+          png_meshes.first,
+          png_meshes.second,
+          edge_width,
+          glyph_factor,
+          window_size,
+          font_size,
+          output_dir_,
+          output_file_stem_
+        );
+      } else {
+        renderPNG(
+          phase,
+          lb_iter,
+          cur_frame,
+          png_meshes.first,
+          png_meshes.second,
+          edge_width,
+          glyph_factor,
+          window_size,
+          font_size,
+          output_dir_,
+          output_file_stem_
+        );
+      }
+    }
+
+    // Meshes are written in the background once the frame is done with
+    // them: drawing them updates the range and bounds cached in their arrays
+    if (save_meshes_) {
+      utility::TraceSpan span("save_meshes");
+      VT_TV_LOG(
+        Render, Info,
+        "== Writing object mesh for (phase,lb_iter)= ({},{})",
+        phase, printLBIter(lb_iter)
+      );
+      writeMesh_(object_mesh, "object_mesh", 0, cur_frame);
+
+      VT_TV_LOG(
+        Render, Info,
+        "== Writing rank mesh for (phase,lb_iter)= ({},{})", phase,
+        printLBIter(lb_iter)
       );
+      writeMesh_(rank_mesh, "rank_mesh", 1, cur_frame);
+
+      if (save_rank_communication_) {
+        VT_TV_LOG(
+          Render, Info,
+          "== Writing rank communication mesh for (phase,lb_iter)= ({},{})",
+          phase, printLBIter(lb_iter)
+        );
+        writeMesh_(
+          createRankCommunicationMesh_(phase, lb_iter), "rank_comm_mesh", 2,
+          cur_frame
+        );
+      }
+
+      if (save_migrations_) {
+        VT_TV_LOG(
+          Render, Info,
+          "== Writing migration mesh for (phase,lb_iter)= ({},{})",
+          phase, printLBIter(lb_iter)
+        );
+        writeMesh_(
+          createMigrationMesh_(phase, lb_iter), "migration_mesh", 3, cur_frame
+        );
+      }
     }
 
     cur_frame++;
   };
 
   int cur_frame = 0;
-  if (selected_phase_ != std::numeric_limits<PhaseType>::max()) {
-    createMeshAndRender(selected_phase_, no_lb_iter, cur_frame);
-    auto const& lb_iters =
-      info_.getRank(0).getPhaseWork().at(selected_phase_).getLBIterations();
-    for (auto const& [id, _] : lb_iters) {
-      createMeshAndRender(selected_phase_, id, cur_frame);
-    }
-  } else {
-    for (PhaseType phase = 0; phase < n_phases_; phase++) {
-      createMeshAndRender(phase, no_lb_iter, cur_frame);
-      auto const& lb_iters =
-        info_.getRank(0).getPhaseWork().at(phase).getLBIterations();
-      for (auto const& [id, _] : lb_iters) {
-        createMeshAndRender(phase, id, cur_frame);
-      }
+  forEachFrame([&](PhaseType phase, LBIterationType lb_iter) {
+    createMeshAndRender(phase, lb_iter, cur_frame);
+  });
+
+  // Wait for all files to be written before returning
+  utility::TraceSpan flush_span("flush_writers");
+  auto writer = std::move(writer_);
+  writer->flush();
+  if (collection_) {
+    auto collection = std::move(collection_);
+    VT_TV_LOG(
+      Render, Info,
+      "== Indexed {} meshes in {}", collection->getNumDataSets(),
+      collection->getFilename());
+  }
+  if (animation_) {
+    auto animation_queue = std::move(animation_queue_);
+    animation_queue->flush();
+    auto animation = std::move(animation_);
+    animation->close();
+    VT_TV_LOG(
+      Render, Info,
+      "== Wrote {} frames to {}", animation->getNumFrames(),
+      animation->getFilename());
+  }
+  if (exodus_queue_) {
+    auto exodus_queue = std::move(exodus_queue_);
+    exodus_queue->flush();
+    auto exodus = std::move(exodus_);
+    if (exodus) {
+      exodus->close();
+      VT_TV_LOG(
+        Render, Info,
+        "== Wrote {} time steps to {}", exodus->getNumSteps(),
+        exodus->getFilename());
     }
   }
 }
@@ -75,6 +75,12 @@
 #include <vtkCellData.h>
 #include <vtkLookupTable.h>
 #include <vtkDiscretizableColorTransferFunction.h>
+#include <vtkCellArray.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkImageData.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkSmartPointer.h>
 
 #include <vtkPolyDataWriter.h>
 #include <vtkExodusIIWriter.h>
@@ -82,12 +88,26 @@
 
 #include "vt-tv/api/rank.h"
 #include "vt-tv/api/info.h"
+#include "vt-tv/render/color_map.h"
+#include "vt-tv/render/raster_renderer.h"
+#include "vt-tv/utility/animation_writer.h"
+#include "vt-tv/utility/async_writer.h"
+#include "vt-tv/utility/edge_selection.h"
+#include "vt-tv/utility/exodus_writer.h"
+#include "vt-tv/utility/index_hash_map.h"
+#include "vt-tv/utility/log.h"
+#include "vt-tv/utility/memory_report.h"
+#include "vt-tv/utility/parallel_for.h"
+#include "vt-tv/utility/png_encoder.h"
+#include "vt-tv/utility/pvd_writer.h"
+#include "vt-tv/utility/trace.h"
 
 #include <fmt-vt/format.h>
 #include <ostream>
 #include <cmath>
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <cstdlib>
 #include <tuple>
 #include <limits>
@@ -97,9 +117,63 @@
 #include <array>
 #include <variant>
 #include <cmath>
+#include <functional>
+#include <memory>
+#include <exception>
 
 namespace vt::tv {
 
+/**
+ * \enum RendererType
+ *
+ * \brief The back-end used to produce PNG images
+ */
+enum struct RendererType : uint8_t {
+  VTK = 0,   /**< Full VTK rendering pipeline */
+  Raster = 1 /**< Built-in CPU rasterizer, does not require a render window */
+};
+
+/**
+ * \enum PNGEncoderType
+ *
+ * \brief The encoder used to write PNG images
+ */
+enum struct PNGEncoderType : uint8_t {
+  VTK = 0,    /**< vtkPNGWriter (zlib) */
+  Builtin = 1 /**< Built-in encoder, does not require VTK in writer threads */
+};
+
+/**
+ * \enum VTPEncodingType
+ *
+ * \brief The encoding of the appended data section of VTP files
+ */
+enum struct VTPEncodingType : uint8_t {
+  Base64 = 0, /**< Base64-encoded binary data, as written by default by VTK */
+  Raw = 1     /**< Raw binary data, smaller and faster to write and read */
+};
+
+/**
+ * \enum VTPCompressorType
+ *
+ * \brief The compressor applied to the data arrays of VTP files
+ */
+enum struct VTPCompressorType : uint8_t {
+  None = 0, /**< No compression */
+  ZLib = 1, /**< zlib, as written by default by VTK */
+  LZ4 = 2   /**< LZ4, faster but compresses less than zlib */
+};
+
+/**
+ * \enum MeshCollectionType
+ *
+ * \brief The time-series index written along with the per-frame meshes
+ */
+enum struct MeshCollectionType : uint8_t {
+  None = 0, /**< Per-frame mesh files only */
+  PVD = 1   /**< ParaView data collection indexing the meshes of all frames */
+};
+
 /**
  * \struct Render
  *
@@ -109,20 +183,13 @@ struct Render {
 private:
   using VtkTypeEnum = typename Info::VtkTypeEnum;
 
-  enum struct ColorType : uint8_t {
-    Default = 0,
-    BlueToRed = 1,
-    HotSpot = 2,
-    WhiteToBlack = 3
-  };
-
   // quantities of interest
   std::string rank_qoi_ = "load";
   std::string object_qoi_ = "load";
   bool continuous_object_qoi_;
 
-  // Render input data
-  Info info_;
+  // Render input data, shared with the caller rather than copied
+  std::shared_ptr<Info const> info_;
   uint64_t n_ranks_ = 0;
   uint64_t n_phases_ = 0;
   std::array<uint64_t, 3> grid_size_ = {1, 1, 1};
@@ -131,8 +198,42 @@ private:
   std::string output_dir_;
   std::string output_file_stem_;
   double grid_resolution_ = 1.0;
+  utility::EdgeSelection edge_selection_;
   bool save_meshes_ = false;
+  bool save_rank_communication_ = false;
+  bool save_migrations_ = false;
   bool save_pngs_ = false;
+  RendererType renderer_type_ = RendererType::VTK;
+
+  // Output stage
+  PNGEncoderType png_encoder_ = PNGEncoderType::VTK;
+  int png_compression_level_ = 2;
+  uint64_t n_writer_threads_ = 1;
+  uint64_t writer_queue_size_ = 4;
+  VTPEncodingType vtp_encoding_ = VTPEncodingType::Base64;
+  VTPCompressorType vtp_compressor_ = VTPCompressorType::ZLib;
+  int vtp_compression_level_ = 5;
+  MeshCollectionType mesh_collection_ = MeshCollectionType::None;
+  std::shared_ptr<utility::PVDWriter> collection_;
+  std::shared_ptr<utility::AsyncWriter> writer_;
+
+  // Animation output
+  utility::AnimationFormat animation_format_ = utility::AnimationFormat::None;
+  uint32_t animation_fps_ = 10;
+  std::shared_ptr<utility::AnimationWriter> animation_;
+  std::shared_ptr<utility::AsyncWriter> animation_queue_;
+
+  // Level of detail: ranks of square tiles are rendered as one glyph
+  uint64_t lod_tile_size_ = 1;
+  uint64_t tile_size_ = 1;
+  double tile_volume_max_ = 0.0;
+
+  // Exodus output
+  bool save_exodus_ = false;
+  std::shared_ptr<utility::ExodusWriter> exodus_;
+  std::shared_ptr<utility::AsyncWriter> exodus_queue_;
+  utility::IndexHashMap exodus_object_nodes_;
+  std::vector<std::array<double, 3>> exodus_reference_;
   PhaseType selected_phase_ = std::numeric_limits<PhaseType>::max();
 
   // numeric parameters
@@ -149,6 +250,13 @@ private:
   // Jitter per object
   std::unordered_map<ElementIDType, std::array<double, 3>> jitter_dims_;
 
+  /**
+   * \brief Get the summary of the data, when it describes all its frames
+   *
+   * \return the summary, or \c nullptr when ranges are computed from the data
+   */
+  std::shared_ptr<PhaseSummary const> getSummary_() const;
+
   /**
    * \brief Compute maximum value of object volumes.
    *
@@ -156,6 +264,14 @@ private:
    */
   double computeMaxObjectVolume_();
 
+  /**
+   * \brief Compute maximum value of object loads.
+   *
+   * \return max object load
+   */
+  double computeMaxObjectLoad_();
+
+public:
   /**
    * \brief Compute range of object qoi.
    *
@@ -164,6 +280,7 @@ private:
   std::variant<std::pair<double, double>, std::set<std::variant<double, int>>>
   computeObjectQOIRange_();
 
+private:
   /**
    * \brief Compute range of rank qoi.
    *
@@ -171,6 +288,59 @@ private:
    */
   std::pair<double, double> computeRankQOIRange_();
 
+  /**
+   * \brief Build the text displayed in the upper left corner of a frame
+   *
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration
+   *
+   * \return the frame caption
+   */
+  std::string getFrameCaption_(PhaseType phase, LBIterationType lb_iter);
+
+  /**
+   * \brief Hand an output task over to the writer threads
+   *
+   * The task runs synchronously when no asynchronous writer is active.
+   *
+   * \param[in] task the task encoding and writing a file
+   */
+  void submitOutput_(std::function<void()> task);
+
+  /**
+   * \brief Write the mesh of a frame to a VTP file through the output stage
+   *
+   * The file is named after the output file stem, the mesh name and the frame,
+   * and is added to the mesh collection once written. The writer updates the
+   * ranges cached in the arrays of the mesh: the mesh must not be drawn or
+   * written again once submitted.
+   *
+   * \param[in] mesh the mesh to write
+   * \param[in] name the mesh name ("object_mesh" or "rank_mesh")
+   * \param[in] part the part index of the mesh in the collection
+   * \param[in] frame the frame index
+   */
+  void writeMesh_(
+    vtkPolyData* mesh, std::string const& name, uint64_t part, uint64_t frame);
+
+  /**
+   * \brief Write an image to a PNG file through the output stage
+   *
+   * When an animation is being generated, the image is appended to it instead.
+   *
+   * \param[in] pixels interleaved pixels, rows ordered top to bottom
+   * \param[in] width the image width
+   * \param[in] height the image height
+   * \param[in] channels the number of channels per pixel (3 or 4)
+   * \param[in] filename the name of the file
+   */
+  void writePNG_(
+    std::vector<uint8_t> pixels,
+    uint32_t width,
+    uint32_t height,
+    uint8_t channels,
+    std::string const& filename);
+
   // /**
   //  * \brief Compute average of rank qoi.
   //  *
@@ -181,16 +351,181 @@ private:
   // double computeRankQOIAverage_(PhaseType phase, std::string qoi);
 
   /**
-   * \brief Create mapping of objects in ranks
+   * \struct ObjectOrdering
+   *
+   * \brief Objects of a frame in mesh point order, stored as columns
+   */
+  struct ObjectOrdering {
+    /// Objects held by \c info_, grouped by rank and sorted within each rank
+    std::vector<ObjectWork const*> objects;
+    /// Migratability of each object
+    std::vector<uint8_t> migratable;
+    /// Index of the first object of each rank, followed by the total
+    std::vector<uint64_t> rank_offsets;
+    /// Array types of the user-defined object QOIs
+    std::map<std::string, VtkTypeEnum> user_defined_types;
+  };
+
+  /**
+   * \struct TileAggregate
+   *
+   * \brief Ranks and objects of a frame reduced over level-of-detail tiles
+   */
+  struct TileAggregate {
+    /// Number of tiles along each dimension of the rank grid
+    std::array<uint64_t, 3> grid_size = {1, 1, 1};
+    /// Number of ranks of each tile
+    std::vector<uint64_t> n_ranks;
+    /// Maximum and mean rank QOI of each tile
+    std::vector<double> rank_qoi_max, rank_qoi_mean;
+    /// Number of objects and of migratable objects of each tile
+    std::vector<uint64_t> n_objects, n_migratable;
+    /// Total object load and maximum object QOI of each tile
+    std::vector<double> object_load, object_qoi_max;
+    /// Communication volume between objects of the same tile
+    std::vector<double> internal_volume;
+    /// Pairs of communicating tiles, and their total volume
+    std::vector<std::pair<uint64_t, uint64_t>> edges;
+    std::vector<double> edge_volumes;
+  };
+
+  /**
+   * \struct RankCommunication
+   *
+   * \brief Communications of a frame reduced over pairs of ranks
+   *
+   * Stores the sparse rank-by-rank matrix of communications in compressed
+   * rows: entries are grouped by sending rank and sorted by receiving rank.
+   */
+  struct RankCommunication {
+    /// Index of the first entry of each sending rank, followed by the total
+    std::vector<uint64_t> row_offsets;
+    /// Receiving rank of each entry
+    std::vector<uint64_t> receivers;
+    /// Total volume and number of messages of each entry
+    std::vector<double> bytes;
+    std::vector<uint64_t> messages;
+  };
+
+  /**
+   * \brief Reduce the ranks and objects of a frame over tiles of ranks
+   *
+   * Per-rank reductions run concurrently; ranks are then accumulated into
+   * their tile, and communications between objects into tile edges.
+   *
+   * \param[in] phase phase index
+   * \param[in] lb_iter the LB iteration
+   * \param[in] tile_size the number of ranks per tile along each dimension
+   *
+   * \return the tile aggregate
+   */
+  TileAggregate aggregateTiles_(
+    PhaseType phase, LBIterationType lb_iter, uint64_t tile_size
+  );
+
+  /**
+   * \brief Map each rank to the tile holding it
+   *
+   * \param[in] tile_size the number of ranks per tile along each dimension
+   * \param[in] tile_grid_size the number of tiles along each dimension
+   *
+   * \return the flat tile index of each rank
+   */
+  std::vector<uint64_t> mapRanksToTiles_(
+    uint64_t tile_size, std::array<uint64_t, 3> const& tile_grid_size
+  ) const;
+
+  /**
+   * \brief Accumulate the communications sent by objects into the internal
+   * volumes and the edges of their tiles
+   *
+   * \param[in] object_tiles the objects of a frame, with their tile
+   * \param[in,out] tiles the tile aggregate, whose internal volumes are sized
+   */
+  void accumulateTileEdges_(
+    std::vector<std::pair<ObjectWork const*, uint64_t>> const& object_tiles,
+    TileAggregate& tiles
+  ) const;
+
+  /**
+   * \brief Get the largest communication volume between two tiles of a frame
+   *
+   * Only tile edges are reduced, transiently, so that scaling volumes
+   * across frames keeps no more than one frame of tiles in memory.
+   *
+   * \param[in] phase phase index
+   * \param[in] lb_iter the LB iteration
+   * \param[in] tile_size the number of ranks per tile along each dimension
+   *
+   * \return the largest tile edge volume, or zero
+   */
+  double computeMaxTileVolume_(
+    PhaseType phase, LBIterationType lb_iter, uint64_t tile_size
+  ) const;
+
+  /**
+   * \brief Reduce the communications of a frame over pairs of ranks
+   *
+   * Objects are mapped to their rank in a single table, then each sending
+   * rank reduces its own row of the matrix concurrently.
+   *
+   * \param[in] phase phase index
+   * \param[in] lb_iter the LB iteration
+   *
+   * \return the rank communication matrix
+   */
+  RankCommunication aggregateRankCommunication_(
+    PhaseType phase, LBIterationType lb_iter
+  );
+
+  /**
+   * \brief Create the points of the ranks on the rank grid
+   *
+   * \return rank points
+   */
+  vtkSmartPointer<vtkPoints> createRankPoints_() const;
+
+  /**
+   * \brief Order the objects of all ranks as object mesh points
+   *
+   * Within a rank, non-migratable objects come first, then objects are sorted
+   * by ID. Objects are referenced rather than copied. Ranks own contiguous
+   * blocks of points, located by a prefix sum of their object counts, so that
+   * blocks can be sorted and filled concurrently.
    *
    * \param[in] phase phase index
    * \param[in] lb_iter the LB iteration
    *
-   * \return mapping
+   * \return the ordering
    */
-  std::map<NodeType, std::unordered_map<ElementIDType, ObjectWork>>
-  createObjectMapping_(PhaseType phase, LBIterationType lb_iter);
+  ObjectOrdering createObjectOrdering_(
+    PhaseType phase, LBIterationType lb_iter
+  );
 
+  /**
+   * \brief Append the meshes of a frame as a time step of the Exodus file
+   *
+   * The file is created at the first frame: ranks and all objects of the run
+   * become the elements of two blocks, and the arrays of the first meshes
+   * their variables. Objects that are absent from a frame keep their
+   * reference position and have a zero "present" variable.
+   *
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration
+   * \param[in] frame the frame index, used as time value
+   * \param[in] rank_mesh the rank mesh of the frame
+   * \param[in] object_mesh the object mesh of the frame
+   * \param[in] ordering the ordering of the objects of the object mesh
+   */
+  void writeExodusStep_(
+    PhaseType phase,
+    LBIterationType lb_iter,
+    uint64_t frame,
+    vtkPolyData* rank_mesh,
+    vtkPolyData* object_mesh,
+    ObjectOrdering const& ordering);
+
+public:
   /**
    * \brief Map ranks to polygonal mesh.
    *
@@ -228,33 +563,99 @@ private:
     PhaseType phase, LBIterationType lb_iter, std::string const& key
   );
 
-  /**
-   * \brief Add object array
+public:
+    /**
+   * \brief Map objects to polygonal mesh.
    *
-   * \param[in] pd_mesh the mesh
-   * \param[in] phase the phase
+   * \param[in] phase phase
    * \param[in] lb_iter the LB iteration
-   * \param[in] key the QOI key to add
-  */
-  template <typename T, typename U>
-  void addObjectArray(
-    vtkNew<vtkPolyData>& pd_mesh, PhaseType phase, LBIterationType lb_iter,
-    std::string const& key
+   *
+   * \return object mesh
+   */
+  vtkNew<vtkPolyData> createObjectMesh_(
+    PhaseType phase, LBIterationType lb_iter
   );
 
-public:
-    /**
-   * \brief Map objects to polygonal mesh.
+  /**
+   * \brief Map objects already ordered to polygonal mesh.
    *
    * \param[in] phase phase
    * \param[in] lb_iter the LB iteration
+   * \param[in] ordering the ordering of the objects of the frame
    *
    * \return object mesh
    */
   vtkNew<vtkPolyData> createObjectMesh_(
+    PhaseType phase, LBIterationType lb_iter, ObjectOrdering const& ordering
+  );
+
+  /**
+   * \brief Map communications between ranks to a line mesh over the ranks.
+   *
+   * Each pair of communicating ranks is a line whose "bytes" and "messages"
+   * cell arrays sum both directions; communications within a rank are the
+   * "internal_bytes" and "internal_messages" point arrays. The directed
+   * rank-by-rank matrix is stored as field data, one entry per tuple of the
+   * "sender", "receiver", "sent_bytes" and "sent_messages" arrays.
+   *
+   * \param[in] phase phase
+   * \param[in] lb_iter the LB iteration
+   *
+   * \return rank communication mesh
+   */
+  vtkNew<vtkPolyData> createRankCommunicationMesh_(
     PhaseType phase, LBIterationType lb_iter
   );
 
+  /**
+   * \brief Map the migrations from the previous frame to an arrow mesh.
+   *
+   * Each migrated object is a line from its former rank to its new rank. The
+   * "migration" point vectors go from the first point of each line to the
+   * second, so that arrow glyphs can be placed on the former ranks; cells
+   * hold the "load", "object_id", "from_rank" and "to_rank" of migrations.
+   *
+   * \param[in] phase phase
+   * \param[in] lb_iter the LB iteration
+   *
+   * \return migration mesh
+   */
+  vtkNew<vtkPolyData> createMigrationMesh_(
+    PhaseType phase, LBIterationType lb_iter
+  );
+
+  /**
+   * \brief Map tiles of ranks to a tile mesh and a tile object mesh.
+   *
+   * Tiles are laid out as the ranks of a coarser grid. The tile mesh holds
+   * the maximum (as scalars) and mean rank QOI with the number of ranks; the
+   * tile object mesh has one point per tile holding the maximum object QOI,
+   * the mean ("load") and total object loads, the object counts and the
+   * internal volume, and its lines carry the volumes between tiles. Both can
+   * be rendered in place of the rank and object meshes.
+   *
+   * \param[in] phase phase
+   * \param[in] lb_iter the LB iteration
+   * \param[in] tile_size the number of ranks per tile along each dimension
+   *
+   * \return the tile mesh and the tile object mesh
+   */
+  std::pair<vtkSmartPointer<vtkPolyData>, vtkSmartPointer<vtkPolyData>>
+  createTileMeshes_(
+    PhaseType phase, LBIterationType lb_iter, uint64_t tile_size
+  );
+
+  /**
+   * \brief Map tiles of ranks already reduced to a tile mesh and a tile
+   * object mesh, as described above
+   *
+   * \param[in] tiles the tile aggregate of the frame
+   *
+   * \return the tile mesh and the tile object mesh
+   */
+  std::pair<vtkSmartPointer<vtkPolyData>, vtkSmartPointer<vtkPolyData>>
+  createTileMeshes_(TileAggregate const& tiles);
+
   static void
   getRgbFromTab20Colormap_(int index, double& r, double& g, double& b);
 
@@ -294,16 +695,18 @@ public:
   /**
    * \brief Construct render
    *
-   * \param[in] in_info info about the ranks and phases
+   * \param[in] in_info info about the ranks and phases, shared read-only,
+   * whose communication edges are normalized
    */
-  Render(Info in_info);
+  explicit Render(std::shared_ptr<Info const> in_info);
 
   /**
    * \brief Construct render
    *
    * \param[in] in_qoi_request description of rank and object quantities of interest
    * \param[in] in_continuous_object_qoi always treat object QOI as continuous or not
-   * \param[in] in_info general info
+   * \param[in] in_info general info, shared read-only, whose communication
+   * edges of the selected phase are normalized
    * \param[in] in_grid_size triplet containing grid sizes in each dimension
    * \param[in] in_object_jitter coefficient of random jitter with magnitude < 1
    * \param[in] in_output_dir output directory
@@ -314,7 +717,7 @@ public:
   Render(
     std::array<std::string, 3> in_qoi_request,
     bool in_continuous_object_qoi,
-    Info& in_info,
+    std::shared_ptr<Info const> in_info,
     std::array<uint64_t, 3> in_grid_size,
     double in_object_jitter,
     std::string in_output_dir,
@@ -354,6 +757,240 @@ public:
     std::string output_file_stem
   );
 
+  /**
+   * @brief Export a visualization PNG from meshes with the raster renderer.
+   *
+   * Draws the same primitives and legends as \c renderPNG directly from the
+   * mesh arrays, without creating a VTK render window.
+   *
+   * @param phase Phase to render.
+   * @param lb_iter LB iteration to render
+   * @param cur_frame the current frame number being rendered
+   * @param rank_mesh Mesh data for the ranks.
+   * @param object_mesh Mesh data for the objects.
+   * @param edge_width Width of the edges in the visualization.
+   * @param glyph_factor Factor to control the size of glyphs.
+   * @param win_size Size of the image.
+   * @param font_size Font size of the legends.
+   * @param output_dir Directory in which to output artifacts
+   * @param output_file_stem Stem for the artifact naming
+   */
+  void renderRasterPNG(
+    PhaseType phase,
+    LBIterationType lb_iter,
+    int cur_frame,
+    vtkPolyData* rank_mesh,
+    vtkPolyData* object_mesh,
+    uint64_t edge_width,
+    double glyph_factor,
+    uint64_t win_size,
+    uint64_t font_size,
+    std::string output_dir,
+    std::string output_file_stem
+  );
+
+  /**
+   * \brief Get the data rendered
+   *
+   * \return the data, shared with the caller of the constructor
+   */
+  std::shared_ptr<Info const> const& getInfo() const { return info_; }
+
+  /**
+   * \brief Set the back-end used to produce PNG images
+   *
+   * \param[in] in_renderer_type the renderer type
+   */
+  void setRendererType(RendererType in_renderer_type) {
+    renderer_type_ = in_renderer_type;
+  }
+
+  /**
+   * \brief Get the renderer type from its configuration name
+   *
+   * \param[in] name the renderer name ("vtk" or "raster")
+   *
+   * \return the renderer type
+   */
+  static RendererType getRendererType(std::string const& name);
+
+  /**
+   * \brief Set the encoder and compression level of PNG images
+   *
+   * \param[in] in_png_encoder the PNG encoder
+   * \param[in] in_compression_level the compression level between 0 and 9
+   */
+  void setPNGEncoder(PNGEncoderType in_png_encoder, int in_compression_level);
+
+  /**
+   * \brief Get the PNG encoder type from its configuration name
+   *
+   * \param[in] name the encoder name ("vtk" or "builtin")
+   *
+   * \return the PNG encoder type
+   */
+  static PNGEncoderType getPNGEncoderType(std::string const& name);
+
+  /**
+   * \brief Set the encoding and compression of VTP mesh files
+   *
+   * \param[in] in_encoding the encoding of the appended data
+   * \param[in] in_compressor the compressor of the data arrays
+   * \param[in] in_compression_level the compression level between 1 and 9
+   */
+  void setVTPOutput(
+    VTPEncodingType in_encoding,
+    VTPCompressorType in_compressor,
+    int in_compression_level);
+
+  /**
+   * \brief Get the VTP encoding type from its configuration name
+   *
+   * \param[in] name the encoding name ("base64" or "raw")
+   *
+   * \return the VTP encoding type
+   */
+  static VTPEncodingType getVTPEncodingType(std::string const& name);
+
+  /**
+   * \brief Get the VTP compressor type from its configuration name
+   *
+   * \param[in] name the compressor name ("none", "zlib" or "lz4")
+   *
+   * \return the VTP compressor type
+   */
+  static VTPCompressorType getVTPCompressorType(std::string const& name);
+
+  /**
+   * \brief Set the budget on the communication edges of object meshes
+   *
+   * \param[in] in_edge_selection the edge selection policies
+   */
+  void setEdgeSelection(utility::EdgeSelection in_edge_selection) {
+    if (in_edge_selection.min_volume < 0.0) {
+      throw std::runtime_error("Minimum edge volume must not be negative.");
+    }
+    edge_selection_ = in_edge_selection;
+  }
+
+  /**
+   * \brief Set the time-series index of the meshes
+   *
+   * \param[in] in_mesh_collection the collection type
+   */
+  void setMeshCollection(MeshCollectionType in_mesh_collection) {
+    mesh_collection_ = in_mesh_collection;
+  }
+
+  /**
+   * \brief Get the mesh collection type from its configuration name
+   *
+   * \param[in] name the collection name ("none" or "pvd")
+   *
+   * \return the mesh collection type
+   */
+  static MeshCollectionType getMeshCollectionType(std::string const& name);
+
+  /**
+   * \brief Write the rank communication mesh of each frame with the meshes
+   *
+   * \param[in] in_save_rank_communication whether to write the mesh
+   */
+  void setSaveRankCommunication(bool in_save_rank_communication) {
+    save_rank_communication_ = in_save_rank_communication;
+  }
+
+  /**
+   * \brief Write the migration mesh of each frame with the meshes
+   *
+   * \param[in] in_save_migrations whether to write the mesh
+   */
+  void setSaveMigrations(bool in_save_migrations) {
+    save_migrations_ = in_save_migrations;
+  }
+
+  /**
+   * \brief Stream the ranks and objects of all frames into an Exodus II file
+   *
+   * Ranks and objects are written as element blocks and each phase or LB
+   * iteration as a time step, in a file named after the output file stem.
+   *
+   * \param[in] in_save_exodus whether to write the Exodus II file
+   */
+  void setSaveExodus(bool in_save_exodus) { save_exodus_ = in_save_exodus; }
+
+  /**
+   * \brief Render square tiles of ranks as single glyphs in images
+   *
+   * \param[in] in_lod_tile_size the number of ranks per tile along each grid
+   * dimension: 1 renders every rank, 0 derives it from the image size
+   */
+  void setLODTileSize(uint64_t in_lod_tile_size) {
+    lod_tile_size_ = in_lod_tile_size;
+  }
+
+  /**
+   * \brief Get the tile size used to render images of a given size
+   *
+   * The automatic tile size keeps tiles at least 16 pixels wide.
+   *
+   * \param[in] win_size the image size in pixels
+   *
+   * \return the number of ranks per tile along each dimension
+   */
+  uint64_t getLODTileSize(uint64_t win_size) const;
+
+  /**
+   * \brief Write a mesh to a VTP file with appended data
+   *
+   * \param[in] mesh the mesh to write
+   * \param[in] filename the name of the file to write
+   * \param[in] encoding the encoding of the appended data
+   * \param[in] compressor the compressor of the data arrays
+   * \param[in] compression_level the compression level between 1 and 9
+   */
+  static void writeVTP(
+    vtkPolyData* mesh,
+    std::string const& filename,
+    VTPEncodingType encoding = VTPEncodingType::Base64,
+    VTPCompressorType compressor = VTPCompressorType::ZLib,
+    int compression_level = 5);
+
+  /**
+   * \brief Set up the background threads writing images and meshes
+   *
+   * \param[in] in_n_threads the number of writer threads (0 writes in the
+   * rendering thread)
+   * \param[in] in_queue_size the maximum number of files waiting to be written
+   */
+  void setAsyncWriters(uint64_t in_n_threads, uint64_t in_queue_size) {
+    n_writer_threads_ = in_n_threads;
+    writer_queue_size_ = in_queue_size;
+  }
+
+  /**
+   * \brief Stream the rendered frames into a single animation file
+   *
+   * The animation replaces the per-frame PNG files and is named after the
+   * output file stem.
+   *
+   * \param[in] in_format the animation format (\c None for per-frame PNGs)
+   * \param[in] in_fps the number of frames per second
+   */
+  void setAnimation(utility::AnimationFormat in_format, uint32_t in_fps) {
+    animation_format_ = in_format;
+    animation_fps_ = in_fps;
+  }
+
+  /**
+   * \brief Get the animation format from its configuration name
+   *
+   * \param[in] name the format name ("none", "apng" or "y4m")
+   *
+   * \return the animation format
+   */
+  static utility::AnimationFormat getAnimationFormat(std::string const& name);
+
   void generate(uint64_t font_size = 50, uint64_t win_size = 2000);
 };
 
@@ -0,0 +1,204 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 analytics.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/analytics.h"
+#include "vt-tv/utility/parallel_for.h"
+
+#include <nlohmann/json.hpp>
+#include <fmt-vt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace vt::tv::utility {
+
+Analytics::Analytics(Info const& info, PhaseType selected_phase) {
+  uint64_t const n_ranks = info.getNumRanks();
+  if (n_ranks == 0) {
+    return;
+  }
+
+  std::vector<std::pair<PhaseType, LBIterationType>> frames;
+  auto const& phase_work = info.getRank(0).getPhaseWork();
+  for (PhaseType phase = 0; phase < info.getNumPhases(); phase++) {
+    if (
+      selected_phase != std::numeric_limits<PhaseType>::max() &&
+      phase != selected_phase) {
+      continue;
+    }
+    frames.emplace_back(phase, no_lb_iter);
+    for (auto const& [lb_iter, _] : phase_work.at(phase).getLBIterations()) {
+      frames.emplace_back(phase, lb_iter);
+    }
+  }
+
+  auto const& object_info = info.getObjectInfo();
+  std::vector<double> loads(n_ranks);
+  std::vector<uint64_t> n_objects(n_ranks), n_migratable(n_ranks);
+  std::vector<double> sent_volumes(n_ranks);
+  std::vector<uint64_t> n_messages(n_ranks);
+  for (auto const& [phase, lb_iter] : frames) {
+    parallelFor(n_ranks, [&](uint64_t rank_id) {
+      auto const& rank = info.getRank(static_cast<NodeType>(rank_id));
+      auto const& objects =
+        info.getWorkDistribution(rank, phase, lb_iter).getObjectWork();
+      loads[rank_id] = rank.getLoad(phase, lb_iter);
+      n_objects[rank_id] = objects.size();
+      n_migratable[rank_id] = 0;
+      sent_volumes[rank_id] = 0.0;
+      n_messages[rank_id] = 0;
+      for (auto const& [obj_id, obj_work] : objects) {
+        if (object_info.at(obj_id).isMigratable()) {
+          n_migratable[rank_id]++;
+        }
+        sent_volumes[rank_id] += obj_work.getSentVolume();
+        n_messages[rank_id] += obj_work.getNumSentMessages();
+      }
+    });
+
+    // Imbalance is defined as in Info::getImbalance
+    FrameStatistics stats;
+    stats.phase = phase;
+    stats.lb_iter = lb_iter;
+    auto const [min, max] = std::minmax_element(loads.begin(), loads.end());
+    stats.rank_load_min = *min;
+    stats.rank_load_max = *max;
+    for (uint64_t rank_id = 0; rank_id < n_ranks; rank_id++) {
+      stats.rank_load_mean += loads[rank_id];
+      stats.n_objects += n_objects[rank_id];
+      stats.n_migratable_objects += n_migratable[rank_id];
+      stats.sent_volume += sent_volumes[rank_id];
+      stats.n_messages += n_messages[rank_id];
+    }
+    stats.rank_load_mean /= n_ranks;
+    stats.imbalance = stats.rank_load_mean != 0 ?
+      std::max(stats.rank_load_max, 0.0) / stats.rank_load_mean - 1. :
+      std::numeric_limits<double>::quiet_NaN();
+    frames_.push_back(stats);
+  }
+}
+
+void Analytics::writeCSV(std::ostream& os) const {
+  os << "phase,lb_iter,imbalance,rank_load_min,rank_load_mean,"
+        "rank_load_max,n_objects,n_migratable_objects,sent_volume,"
+        "n_messages\n";
+  for (auto const& f : frames_) {
+    os << fmt::format(
+      "{},{},{},{},{},{},{},{},{},{}\n", f.phase,
+      f.lb_iter == no_lb_iter ? std::string() : std::to_string(f.lb_iter),
+      f.imbalance, f.rank_load_min, f.rank_load_mean, f.rank_load_max,
+      f.n_objects, f.n_migratable_objects, f.sent_volume, f.n_messages);
+  }
+}
+
+void Analytics::writeJSON(std::ostream& os) const {
+  auto number = [](double value) {
+    return std::isnan(value) ? nlohmann::json() : nlohmann::json(value);
+  };
+
+  nlohmann::json report = nlohmann::json::array();
+  for (auto const& f : frames_) {
+    report.push_back({
+      {"phase", f.phase},
+      {"lb_iter",
+       f.lb_iter == no_lb_iter ? nlohmann::json() : nlohmann::json(f.lb_iter)},
+      {"imbalance", number(f.imbalance)},
+      {"rank_load_min", f.rank_load_min},
+      {"rank_load_mean", f.rank_load_mean},
+      {"rank_load_max", f.rank_load_max},
+      {"n_objects", f.n_objects},
+      {"n_migratable_objects", f.n_migratable_objects},
+      {"sent_volume", f.sent_volume},
+      {"n_messages", f.n_messages}
+    });
+  }
+  os << report.dump(2) << "\n";
+}
+
+void Analytics::write(std::string const& filename, AnalyticsFormat format)
+  const {
+  std::ofstream os(filename);
+  if (!os) {
+    throw std::runtime_error("Cannot open analytics file " + filename);
+  }
+  switch (format) {
+  case AnalyticsFormat::CSV:
+    writeCSV(os);
+    break;
+  case AnalyticsFormat::JSON:
+    writeJSON(os);
+    break;
+  case AnalyticsFormat::None:
+    break;
+  }
+}
+
+/*static*/ AnalyticsFormat Analytics::getFormat(std::string const& name) {
+  if (name == "none") {
+    return AnalyticsFormat::None;
+  } else if (name == "csv") {
+    return AnalyticsFormat::CSV;
+  } else if (name == "json") {
+    return AnalyticsFormat::JSON;
+  }
+  throw std::runtime_error(
+    "Unknown analytics format \"" + name +
+    "\" (expected \"none\", \"csv\" or \"json\").");
+}
+
+/*static*/ std::string Analytics::getExtension(AnalyticsFormat format) {
+  switch (format) {
+  case AnalyticsFormat::CSV:
+    return ".csv";
+  case AnalyticsFormat::JSON:
+    return ".json";
+  case AnalyticsFormat::None:
+    break;
+  }
+  return "";
+}
+
+} /* end namespace vt::tv::utility */
@@ -0,0 +1,169 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 analytics.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_ANALYTICS_H
+#define INCLUDED_VT_TV_UTILITY_ANALYTICS_H
+
+#include "vt-tv/api/types.h"
+#include "vt-tv/api/info.h"
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \enum AnalyticsFormat
+ *
+ * \brief The formats of analytics reports
+ */
+enum struct AnalyticsFormat : uint8_t {
+  None = 0, /**< No report */
+  CSV = 1,  /**< One line per frame */
+  JSON = 2  /**< An array with one object per frame */
+};
+
+/**
+ * \struct FrameStatistics
+ *
+ * \brief Load and communication statistics of a phase or LB iteration
+ */
+struct FrameStatistics {
+  PhaseType phase = 0;                  /**< The phase */
+  LBIterationType lb_iter = no_lb_iter; /**< The LB iteration, if any */
+  double imbalance = 0.0;               /**< Max over mean rank load, minus 1 */
+  double rank_load_min = 0.0;           /**< Minimum rank load */
+  double rank_load_mean = 0.0;          /**< Mean rank load */
+  double rank_load_max = 0.0;           /**< Maximum rank load */
+  uint64_t n_objects = 0;               /**< Number of objects */
+  uint64_t n_migratable_objects = 0;    /**< Number of migratable objects */
+  double sent_volume = 0.0;             /**< Total volume of communications */
+  uint64_t n_messages = 0;              /**< Total number of messages */
+};
+
+/**
+ * \struct Analytics
+ *
+ * \brief Per-frame statistics computed straight from an \c Info
+ *
+ * Frames are the phases, each followed by its LB iterations, as they are
+ * rendered. Ranks of a frame are reduced concurrently; no mesh is built.
+ * Communications are counted on the side of their senders: the edges of the
+ * frames reported are expected to be normalized, as by
+ * \c InfoLoader::selectPhase, for those recorded only by their recipients
+ * to count.
+ */
+struct Analytics {
+  /**
+   * \brief Compute the statistics of all frames
+   *
+   * \param[in] info the data of all ranks
+   * \param[in] selected_phase the only phase to report, or all phases when
+   * set to the maximum phase value
+   */
+  explicit Analytics(
+    Info const& info,
+    PhaseType selected_phase = std::numeric_limits<PhaseType>::max());
+
+  /**
+   * \brief Get the statistics of the frames, in order
+   *
+   * \return the frame statistics
+   */
+  std::vector<FrameStatistics> const& getFrames() const { return frames_; }
+
+  /**
+   * \brief Write the report as CSV, with a header line
+   *
+   * Frames without LB iteration have an empty \c lb_iter field.
+   *
+   * \param[in] os the output stream
+   */
+  void writeCSV(std::ostream& os) const;
+
+  /**
+   * \brief Write the report as a JSON array of frame objects
+   *
+   * Frames without LB iteration have a null \c lb_iter, as have undefined
+   * imbalances.
+   *
+   * \param[in] os the output stream
+   */
+  void writeJSON(std::ostream& os) const;
+
+  /**
+   * \brief Write the report to a file
+   *
+   * \param[in] filename the name of the file
+   * \param[in] format the report format
+   */
+  void write(std::string const& filename, AnalyticsFormat format) const;
+
+  /**
+   * \brief Get the analytics format from its configuration name
+   *
+   * \param[in] name the format name ("none", "csv" or "json")
+   *
+   * \return the analytics format
+   */
+  static AnalyticsFormat getFormat(std::string const& name);
+
+  /**
+   * \brief Get the conventional file extension of a format
+   *
+   * \param[in] format the report format
+   *
+   * \return the extension, including the leading dot
+   */
+  static std::string getExtension(AnalyticsFormat format);
+
+private:
+  std::vector<FrameStatistics> frames_; /**< Statistics of each frame */
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_ANALYTICS_H*/
@@ -0,0 +1,260 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             animation_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/animation_writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace vt::tv::utility {
+
+AnimationWriter::AnimationWriter(
+  std::string in_filename,
+  AnimationFormat in_format,
+  uint32_t in_fps,
+  int in_compression_level)
+  : filename_(std::move(in_filename)),
+    format_(in_format),
+    fps_(std::clamp<uint32_t>(in_fps, 1, 65535)),
+    encoder_(in_compression_level) {
+  if (format_ == AnimationFormat::None) {
+    throw std::runtime_error("An animation format is required.");
+  }
+}
+
+AnimationWriter::~AnimationWriter() {
+  try {
+    close();
+  } catch (...) {
+    // Errors can only be reported by an explicit close
+  }
+}
+
+/*static*/ std::string AnimationWriter::getExtension(AnimationFormat format) {
+  switch (format) {
+  case AnimationFormat::APNG:
+    return ".apng";
+  case AnimationFormat::Y4M:
+    return ".y4m";
+  case AnimationFormat::None:
+    break;
+  }
+  return ".png";
+}
+
+void AnimationWriter::writeBuffer(std::vector<uint8_t> const& buffer) {
+  os_.write(reinterpret_cast<char const*>(buffer.data()), buffer.size());
+  if (!os_) {
+    throw std::runtime_error("Could not write animation file: " + filename_);
+  }
+}
+
+void AnimationWriter::open(uint32_t width, uint32_t height, uint8_t channels) {
+  os_.open(filename_, std::ios::binary | std::ios::trunc);
+  if (!os_) {
+    throw std::runtime_error(
+      "Could not open animation file for writing: " + filename_);
+  }
+  width_ = width;
+  height_ = height;
+  channels_ = channels;
+
+  if (format_ == AnimationFormat::APNG) {
+    std::vector<uint8_t> header = PNGEncoder::signature();
+    auto const ihdr = PNGEncoder::makeHeader(width, height, channels);
+    PNGEncoder::appendChunk(header, "IHDR", ihdr.data(), ihdr.size());
+
+    // The frame count is not known yet: acTL is patched when closing
+    actl_pos_ = static_cast<std::streamoff>(header.size());
+    std::vector<uint8_t> actl;
+    PNGEncoder::appendU32(actl, 0); // num_frames
+    PNGEncoder::appendU32(actl, 0); // num_plays, 0 loops forever
+    PNGEncoder::appendChunk(header, "acTL", actl.data(), actl.size());
+    writeBuffer(header);
+  } else {
+    // Full-range BT.601 (JPEG) YCbCr, chroma sited as in JPEG
+    std::string const header = "YUV4MPEG2 W" + std::to_string(width) + " H" +
+      std::to_string(height) + " F" + std::to_string(fps_) +
+      ":1 Ip A1:1 C420jpeg XCOLORRANGE=FULL\n";
+    os_.write(header.data(), header.size());
+  }
+}
+
+void AnimationWriter::addFrame(
+  uint8_t const* pixels, uint32_t width, uint32_t height, uint8_t channels) {
+  if (channels != 3 && channels != 4) {
+    throw std::runtime_error("Animation frames must be RGB or RGBA.");
+  }
+  if (!os_.is_open()) {
+    open(width, height, channels);
+  } else if (width != width_ || height != height_ || channels != channels_) {
+    throw std::runtime_error(
+      "Animation frame " + std::to_string(n_frames_) + " is " +
+      std::to_string(width) + "x" + std::to_string(height) +
+      " but previous frames are " + std::to_string(width_) + "x" +
+      std::to_string(height_) + ".");
+  }
+
+  if (format_ == AnimationFormat::APNG) {
+    addAPNGFrame(pixels);
+  } else {
+    addY4MFrame(pixels);
+  }
+  n_frames_++;
+}
+
+void AnimationWriter::addAPNGFrame(uint8_t const* pixels) {
+  auto const raw =
+    PNGEncoder::filterScanlines(pixels, width_, height_, channels_);
+  auto const data = encoder_.compress(raw.data(), raw.size());
+
+  // Frame control: full-size frame replacing the previous one
+  std::vector<uint8_t> fctl;
+  PNGEncoder::appendU32(fctl, sequence_++);
+  PNGEncoder::appendU32(fctl, width_);
+  PNGEncoder::appendU32(fctl, height_);
+  PNGEncoder::appendU32(fctl, 0); // x_offset
+  PNGEncoder::appendU32(fctl, 0); // y_offset
+  fctl.insert(fctl.end(), {0, 1}); // delay_num
+  fctl.push_back(static_cast<uint8_t>(fps_ >> 8));
+  fctl.push_back(static_cast<uint8_t>(fps_)); // delay_den
+  fctl.push_back(0); // dispose_op: none
+  fctl.push_back(0); // blend_op: source
+
+  std::vector<uint8_t> chunks;
+  chunks.reserve(data.size() + 64);
+  PNGEncoder::appendChunk(chunks, "fcTL", fctl.data(), fctl.size());
+  if (n_frames_ == 0) {
+    // The first frame is also the default image seen by non-APNG decoders
+    PNGEncoder::appendChunk(chunks, "IDAT", data.data(), data.size());
+  } else {
+    std::vector<uint8_t> fdat;
+    fdat.reserve(data.size() + 4);
+    PNGEncoder::appendU32(fdat, sequence_++);
+    fdat.insert(fdat.end(), data.begin(), data.end());
+    PNGEncoder::appendChunk(chunks, "fdAT", fdat.data(), fdat.size());
+  }
+  writeBuffer(chunks);
+}
+
+void AnimationWriter::addY4MFrame(uint8_t const* pixels) {
+  uint32_t const cw = (width_ + 1) / 2;
+  uint32_t const ch = (height_ + 1) / 2;
+  std::size_t const luma_size = static_cast<std::size_t>(width_) * height_;
+  std::size_t const chroma_size = static_cast<std::size_t>(cw) * ch;
+  std::string const tag = "FRAME\n";
+  yuv_.resize(tag.size() + luma_size + 2 * chroma_size);
+  std::copy(tag.begin(), tag.end(), yuv_.begin());
+  uint8_t* y_plane = yuv_.data() + tag.size();
+  uint8_t* u_plane = y_plane + luma_size;
+  uint8_t* v_plane = u_plane + chroma_size;
+
+  auto clamp8 = [](double v) {
+    return static_cast<uint8_t>(std::clamp(std::lround(v), 0L, 255L));
+  };
+
+  for (uint32_t y = 0; y < height_; y++) {
+    uint8_t const* row =
+      pixels + static_cast<std::size_t>(y) * width_ * channels_;
+    for (uint32_t x = 0; x < width_; x++) {
+      uint8_t const* px = row + static_cast<std::size_t>(x) * channels_;
+      y_plane[static_cast<std::size_t>(y) * width_ + x] =
+        clamp8(0.299 * px[0] + 0.587 * px[1] + 0.114 * px[2]);
+    }
+  }
+
+  // Chroma is averaged over 2x2 blocks, clamped at odd borders
+  for (uint32_t cy = 0; cy < ch; cy++) {
+    for (uint32_t cx = 0; cx < cw; cx++) {
+      double r = 0.0, g = 0.0, b = 0.0;
+      for (uint32_t dy = 0; dy < 2; dy++) {
+        for (uint32_t dx = 0; dx < 2; dx++) {
+          uint32_t const x = std::min(2 * cx + dx, width_ - 1);
+          uint32_t const y = std::min(2 * cy + dy, height_ - 1);
+          uint8_t const* px = pixels +
+            (static_cast<std::size_t>(y) * width_ + x) * channels_;
+          r += px[0];
+          g += px[1];
+          b += px[2];
+        }
+      }
+      r *= 0.25;
+      g *= 0.25;
+      b *= 0.25;
+      std::size_t const i = static_cast<std::size_t>(cy) * cw + cx;
+      u_plane[i] = clamp8(128.0 - 0.168736 * r - 0.331264 * g + 0.5 * b);
+      v_plane[i] = clamp8(128.0 + 0.5 * r - 0.418688 * g - 0.081312 * b);
+    }
+  }
+  writeBuffer(yuv_);
+}
+
+void AnimationWriter::close() {
+  if (!os_.is_open()) {
+    return;
+  }
+
+  if (format_ == AnimationFormat::APNG) {
+    std::vector<uint8_t> iend;
+    PNGEncoder::appendChunk(iend, "IEND", nullptr, 0);
+    writeBuffer(iend);
+
+    // Patch the frame count now that it is known
+    std::vector<uint8_t> actl;
+    PNGEncoder::appendU32(actl, static_cast<uint32_t>(n_frames_));
+    PNGEncoder::appendU32(actl, 0);
+    std::vector<uint8_t> chunk;
+    PNGEncoder::appendChunk(chunk, "acTL", actl.data(), actl.size());
+    os_.seekp(actl_pos_);
+    writeBuffer(chunk);
+  }
+
+  os_.close();
+  if (!os_) {
+    throw std::runtime_error("Could not close animation file: " + filename_);
+  }
+}
+
+} /* end namespace vt::tv::utility */
@@ -0,0 +1,166 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              animation_writer.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_ANIMATION_WRITER_H
+#define INCLUDED_VT_TV_UTILITY_ANIMATION_WRITER_H
+
+#include "vt-tv/utility/png_encoder.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \enum AnimationFormat
+ *
+ * \brief The containers into which frames can be streamed
+ */
+enum struct AnimationFormat : uint8_t {
+  None = 0, /**< One PNG file per frame */
+  APNG = 1, /**< Animated PNG */
+  Y4M = 2   /**< Raw YUV4MPEG2 (4:2:0), to be piped into video encoders */
+};
+
+/**
+ * \struct AnimationWriter
+ *
+ * \brief Streams frames into a single animation file
+ *
+ * Frames are encoded and appended to the file as they are added, so that no
+ * intermediate image is kept. All frames must have the same dimensions, which
+ * are fixed by the first one. Frames are expected in display order: callers
+ * adding frames from several threads must serialize them.
+ */
+struct AnimationWriter {
+  /**
+   * \brief Construct an animation writer
+   *
+   * \param[in] in_filename the name of the file to write
+   * \param[in] in_format the container format
+   * \param[in] in_fps the number of frames per second
+   * \param[in] in_compression_level the PNG compression level (APNG only)
+   */
+  AnimationWriter(
+    std::string in_filename,
+    AnimationFormat in_format,
+    uint32_t in_fps = 10,
+    int in_compression_level = 2);
+
+  AnimationWriter(AnimationWriter const&) = delete;
+  AnimationWriter& operator=(AnimationWriter const&) = delete;
+
+  /**
+   * \brief Finalize the file if it was not closed
+   */
+  ~AnimationWriter();
+
+  /**
+   * \brief Encode a frame and append it to the animation
+   *
+   * \param[in] pixels interleaved pixels, rows ordered top to bottom
+   * \param[in] width the frame width in pixels
+   * \param[in] height the frame height in pixels
+   * \param[in] channels the number of channels per pixel (3 or 4)
+   */
+  void addFrame(
+    uint8_t const* pixels, uint32_t width, uint32_t height, uint8_t channels);
+
+  /**
+   * \brief Finalize and close the file
+   */
+  void close();
+
+  /**
+   * \brief Get the number of frames added so far
+   *
+   * \return the number of frames
+   */
+  uint64_t getNumFrames() const { return n_frames_; }
+
+  /**
+   * \brief Get the name of the animation file
+   *
+   * \return the file name
+   */
+  std::string const& getFilename() const { return filename_; }
+
+  /**
+   * \brief Get the conventional file extension of a format
+   *
+   * \param[in] format the container format
+   *
+   * \return the extension, including the leading dot
+   */
+  static std::string getExtension(AnimationFormat format);
+
+private:
+  /**
+   * \internal \brief Open the file and write the container header
+   */
+  void open(uint32_t width, uint32_t height, uint8_t channels);
+
+  void addAPNGFrame(uint8_t const* pixels);
+  void addY4MFrame(uint8_t const* pixels);
+  void writeBuffer(std::vector<uint8_t> const& buffer);
+
+private:
+  std::string filename_;              /**< Name of the animation file */
+  AnimationFormat format_;            /**< Container format */
+  uint32_t fps_ = 10;                 /**< Frames per second */
+  PNGEncoder encoder_;                /**< Encoder of APNG frames */
+  std::ofstream os_;                  /**< Output stream */
+  uint32_t width_ = 0;                /**< Frame width fixed by first frame */
+  uint32_t height_ = 0;               /**< Frame height fixed by first frame */
+  uint8_t channels_ = 0;              /**< Channels fixed by first frame */
+  uint64_t n_frames_ = 0;             /**< Number of frames written */
+  uint32_t sequence_ = 0;             /**< APNG chunk sequence number */
+  std::streampos actl_pos_ = 0;       /**< Position of the APNG acTL chunk */
+  std::vector<uint8_t> yuv_;          /**< Y4M frame buffer */
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_ANIMATION_WRITER_H*/
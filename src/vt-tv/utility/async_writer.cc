@@ -0,0 +1,128 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               async_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/async_writer.h"
+
+#include <algorithm>
+
+namespace vt::tv::utility {
+
+AsyncWriter::AsyncWriter(uint64_t in_n_threads, uint64_t in_queue_capacity)
+  : queue_capacity_(std::max<uint64_t>(in_queue_capacity, 1)) {
+  threads_.reserve(in_n_threads);
+  for (uint64_t i = 0; i < in_n_threads; i++) {
+    threads_.emplace_back([this] { work(); });
+  }
+}
+
+AsyncWriter::~AsyncWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_cv_.notify_all();
+  for (auto& t : threads_) {
+    t.join();
+  }
+}
+
+void AsyncWriter::submit(TaskType task) {
+  if (threads_.empty()) {
+    task();
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_cv_.wait(lock, [this] { return queue_.size() < queue_capacity_; });
+    queue_.push_back(std::move(task));
+  }
+  task_cv_.notify_one();
+}
+
+void AsyncWriter::flush() {
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this] { return queue_.empty() && n_active_ == 0; });
+    std::swap(error, error_);
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void AsyncWriter::work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    // Pending tasks are drained before stopping
+    task_cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+    if (queue_.empty()) {
+      return;
+    }
+
+    auto task = std::move(queue_.front());
+    queue_.pop_front();
+    n_active_++;
+    lock.unlock();
+    space_cv_.notify_one();
+
+    std::exception_ptr error;
+    try {
+      task();
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    n_active_--;
+    if (error && !error_) {
+      error_ = error;
+    }
+    if (queue_.empty() && n_active_ == 0) {
+      done_cv_.notify_all();
+    }
+  }
+}
+
+} /* end namespace vt::tv::utility */
@@ -0,0 +1,129 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                async_writer.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_ASYNC_WRITER_H
+#define INCLUDED_VT_TV_UTILITY_ASYNC_WRITER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct AsyncWriter
+ *
+ * \brief Runs output tasks (encoding and writing files) on background threads
+ *
+ * Tasks are fed through a bounded queue: \c submit blocks while the queue is
+ * full, so that at most \c queue_capacity frames are held in memory while the
+ * caller keeps computing the next ones. With zero threads, tasks are executed
+ * synchronously by \c submit.
+ */
+struct AsyncWriter {
+  using TaskType = std::function<void()>;
+
+  /**
+   * \brief Construct an asynchronous writer
+   *
+   * \param[in] in_n_threads the number of background threads (0 to disable)
+   * \param[in] in_queue_capacity the maximum number of pending tasks
+   */
+  AsyncWriter(uint64_t in_n_threads, uint64_t in_queue_capacity);
+
+  AsyncWriter(AsyncWriter const&) = delete;
+  AsyncWriter& operator=(AsyncWriter const&) = delete;
+
+  /**
+   * \brief Wait for the pending tasks and stop the background threads
+   */
+  ~AsyncWriter();
+
+  /**
+   * \brief Submit a task, blocking while the queue is full
+   *
+   * \param[in] task the task to run
+   */
+  void submit(TaskType task);
+
+  /**
+   * \brief Wait until all submitted tasks have completed
+   *
+   * \throws the first exception raised by a task since the last flush
+   */
+  void flush();
+
+  /**
+   * \brief Get the number of background threads
+   *
+   * \return the number of threads
+   */
+  uint64_t getNumThreads() const { return threads_.size(); }
+
+private:
+  /**
+   * \internal \brief Main loop of the background threads
+   */
+  void work();
+
+private:
+  uint64_t queue_capacity_ = 1;      /**< Maximum number of queued tasks */
+  std::vector<std::thread> threads_; /**< Background threads */
+  std::deque<TaskType> queue_;       /**< Pending tasks */
+  uint64_t n_active_ = 0;            /**< Tasks being executed */
+  bool stop_ = false;                /**< Whether threads should exit */
+  std::exception_ptr error_;         /**< First error raised by a task */
+  std::mutex mutex_;
+  std::condition_variable task_cv_;  /**< Signals queued tasks or stop */
+  std::condition_variable space_cv_; /**< Signals free space in the queue */
+  std::condition_variable done_cv_;  /**< Signals completion of all tasks */
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_ASYNC_WRITER_H*/
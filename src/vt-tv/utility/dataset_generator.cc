@@ -0,0 +1,577 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             dataset_generator.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/dataset_generator.h"
+#include "vt-tv/utility/output_adaptor.h"
+#include "vt-tv/utility/parallel_for.h"
+
+#include <nlohmann/json.hpp>
+#include <fmt-vt/format.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+
+namespace vt::tv::utility {
+
+namespace {
+
+/**
+ * \internal \brief Salts keeping the draws of different quantities apart
+ */
+enum Salt : uint64_t {
+  ObjectCount = 1,
+  HotRank = 2,
+  BaseLoad = 3,
+  FrameLoad = 4,
+  Location = 5,
+  Receiver = 6,
+  Message = 7,
+  Subphase = 8,
+  UserDefined = 9
+};
+
+constexpr uint64_t golden_gamma = 0x9e3779b97f4a7c15ULL;
+
+/**
+ * \internal \brief The splitmix64 finalizer
+ */
+uint64_t mix(uint64_t x) {
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+/**
+ * \internal \brief Hash the seed and the values identifying a draw
+ */
+template <typename... Args>
+uint64_t hashOf(uint64_t seed, Args... args) {
+  uint64_t h = mix(seed + golden_gamma);
+  ((h = mix((h ^ static_cast<uint64_t>(args)) + golden_gamma)), ...);
+  return h;
+}
+
+/**
+ * \internal \brief Map 64 random bits to [0, 1)
+ */
+double uniform01(uint64_t bits) {
+  return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+/**
+ * \internal \brief A splitmix64 engine: cheap to seed, as one is seeded for
+ * every draw of an object
+ */
+struct SplitMix64 {
+  using result_type = uint64_t;
+
+  explicit SplitMix64(uint64_t in_state) : state_(in_state) { }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() { return mix(state_ += golden_gamma); }
+
+private:
+  uint64_t state_ = 0;
+};
+
+/**
+ * \internal \brief Append the shortest representation of a finite double,
+ * keeping a decimal point so that it reads back as a floating-point number
+ */
+void appendDouble(fmt::memory_buffer& out, double value) {
+  auto const start = out.size();
+  fmt::format_to(std::back_inserter(out), "{}", value);
+  auto const is_integral =
+    std::none_of(out.begin() + start, out.end(), [](char c) {
+      return c == '.' or c == 'e';
+    });
+  if (is_integral) {
+    out.append(std::string_view{".0"});
+  }
+}
+
+/**
+ * \internal \brief Check that a parameter is a fraction
+ */
+void checkFraction(double value, std::string const& name) {
+  if (not(value >= 0.0 and value <= 1.0)) {
+    throw std::runtime_error(
+      name + " must be within [0, 1] (got " + std::to_string(value) + ").");
+  }
+}
+
+} /* end anonymous namespace */
+
+DatasetGenerator::DatasetGenerator(DatasetSpec in_spec)
+  : spec_(std::move(in_spec)) {
+  if (
+    spec_.num_ranks == 0 or
+    spec_.num_ranks >
+      static_cast<uint64_t>(std::numeric_limits<NodeType>::max())
+  ) {
+    throw std::runtime_error(
+      "The number of ranks must be within [1, " +
+      std::to_string(std::numeric_limits<NodeType>::max()) + "] (got " +
+      std::to_string(spec_.num_ranks) + ").");
+  }
+  if (spec_.num_objects_per_rank == 0) {
+    throw std::runtime_error(
+      "The number of objects per rank must be positive.");
+  }
+  if (not(spec_.load_mean > 0.0)) {
+    throw std::runtime_error("The mean load must be positive.");
+  }
+  if (not(spec_.load_spread >= 0.0 and spec_.comm_bytes >= 0.0)) {
+    throw std::runtime_error(
+      "The load spread and message bytes must not be negative.");
+  }
+  if (not(spec_.hot_rank_factor > 0.0)) {
+    throw std::runtime_error("The load factor of hot ranks must be positive.");
+  }
+  if (spec_.quality < 0 or spec_.quality > 11) {
+    throw std::runtime_error(
+      "The brotli quality must be within [0, 11] (got " +
+      std::to_string(spec_.quality) + ").");
+  }
+  checkFraction(spec_.objects_spread, "The spread of the object counts");
+  checkFraction(spec_.phase_noise, "The phase noise");
+  checkFraction(spec_.hot_rank_fraction, "The fraction of hot ranks");
+  checkFraction(spec_.remote_fraction, "The fraction of remote messages");
+  checkFraction(spec_.migration_fraction, "The fraction of migrated objects");
+
+  for (auto const& field : spec_.user_defined) {
+    // Names are written as they are escaped in a JSON string
+    auto const quoted = nlohmann::json(field.name).dump();
+    escaped_names_.push_back(quoted.substr(1, quoted.size() - 2));
+  }
+
+  offsets_.resize(spec_.num_ranks + 1, 0);
+  for (uint64_t rank = 0; rank < spec_.num_ranks; rank++) {
+    uint64_t n = spec_.num_objects_per_rank;
+    if (spec_.objects_spread > 0.0) {
+      double const u = uniform01(hashOf(spec_.seed, ObjectCount, rank));
+      n = std::max<uint64_t>(
+        1,
+        std::llround(
+          static_cast<double>(n) * (1.0 + spec_.objects_spread * (2 * u - 1))));
+    }
+    offsets_[rank + 1] = offsets_[rank] + n;
+  }
+}
+
+uint64_t DatasetGenerator::getNumObjects(NodeType rank) const {
+  return offsets_.at(rank + 1) - offsets_.at(rank);
+}
+
+NodeType DatasetGenerator::getHome(ElementIDType id) const {
+  assert(id < getTotalObjects() && "Object must exist");
+  auto const next = std::upper_bound(offsets_.begin(), offsets_.end(), id);
+  return static_cast<NodeType>(next - offsets_.begin() - 1);
+}
+
+NodeType DatasetGenerator::getLocation(
+  ElementIDType id, PhaseType phase, LBIterationType lb_iter) const {
+  auto const home = getHome(id);
+  if (spec_.migration_fraction <= 0.0 or spec_.num_ranks == 1) {
+    return home;
+  }
+  auto const h = hashOf(spec_.seed, Location, id, phase, lb_iter);
+  if (uniform01(h) >= spec_.migration_fraction) {
+    return home;
+  }
+  // The lowest bit, dropped by the uniform draw, picks the neighbor
+  auto const n_ranks = spec_.num_ranks;
+  auto const rank = (h & 1) ? (home + 1) % n_ranks
+                            : (home + n_ranks - 1) % n_ranks;
+  return static_cast<NodeType>(rank);
+}
+
+double DatasetGenerator::getLoad(
+  ElementIDType id, PhaseType phase, LBIterationType lb_iter) const {
+  // The base load of an object is the same in all frames
+  SplitMix64 engine(hashOf(spec_.seed, BaseLoad, id));
+  double const mean = spec_.load_mean;
+  double const spread = spec_.load_spread;
+  double load = mean;
+  switch (spec_.load_distribution) {
+  case LoadDistribution::Constant:
+    break;
+  case LoadDistribution::Uniform:
+    load = mean * (1.0 + spread * (2 * uniform01(engine()) - 1));
+    break;
+  case LoadDistribution::Normal:
+    if (spread > 0.0) {
+      load = std::normal_distribution<double>(mean, mean * spread)(engine);
+    }
+    break;
+  case LoadDistribution::LogNormal:
+    if (spread > 0.0) {
+      load = std::lognormal_distribution<double>(
+        std::log(mean) - spread * spread / 2, spread)(engine);
+    }
+    break;
+  }
+
+  if (
+    spec_.hot_rank_fraction > 0.0 and
+    uniform01(hashOf(spec_.seed, HotRank, getHome(id))) <
+      spec_.hot_rank_fraction) {
+    load *= spec_.hot_rank_factor;
+  }
+
+  double const u = uniform01(hashOf(spec_.seed, FrameLoad, id, phase, lb_iter));
+  load *= 1.0 + spec_.phase_noise * (2 * u - 1);
+  return std::max(load, 0.0);
+}
+
+std::vector<ElementIDType>
+DatasetGenerator::getReceivers(ElementIDType id) const {
+  std::vector<ElementIDType> receivers;
+  auto const n_ranks = spec_.num_ranks;
+  auto const total = getTotalObjects();
+  auto const home = getHome(id);
+
+  switch (spec_.comm_topology) {
+  case CommTopology::None:
+    break;
+  case CommTopology::Ring:
+    if (n_ranks > 1) {
+      auto const next = static_cast<NodeType>((home + 1) % n_ranks);
+      auto const local = id - offsets_[home];
+      receivers.push_back(offsets_[next] + local % getNumObjects(next));
+    }
+    break;
+  case CommTopology::Stencil:
+    // Neighbors at distance 1, 2, ... alternately above and below, wrapping
+    // around the last object
+    for (uint64_t k = 0; k < spec_.comm_degree; k++) {
+      uint64_t const distance = (k / 2 + 1) % total;
+      ElementIDType const neighbor = k % 2 == 0
+        ? (id + distance) % total
+        : (id + total - distance) % total;
+      if (
+        neighbor != id and
+        std::find(receivers.begin(), receivers.end(), neighbor) ==
+          receivers.end()) {
+        receivers.push_back(neighbor);
+      }
+    }
+    break;
+  case CommTopology::Random: {
+    SplitMix64 engine(hashOf(spec_.seed, Receiver, id));
+    for (uint64_t k = 0; k < spec_.comm_degree; k++) {
+      uint64_t rank = home;
+      bool const remote = uniform01(engine()) < spec_.remote_fraction or
+        getNumObjects(home) == 1;
+      if (remote and n_ranks > 1) {
+        rank = (home + 1 + engine() % (n_ranks - 1)) % n_ranks;
+      }
+      auto const n = getNumObjects(static_cast<NodeType>(rank));
+      if (rank == static_cast<uint64_t>(home) and n == 1) {
+        // A single object, on a single rank, has nobody to send to
+        continue;
+      }
+      ElementIDType local = engine() % n;
+      if (offsets_[rank] + local == id) {
+        local = (local + 1 + engine() % (n - 1)) % n;
+      }
+      receivers.push_back(offsets_[rank] + local);
+    }
+    break;
+  }
+  }
+  return receivers;
+}
+
+void DatasetGenerator::appendEntity(Buffer& out, ElementIDType id) const {
+  fmt::format_to(
+    std::back_inserter(out),
+    R"({{"type":"object","id":{},"home":{},"migratable":true}})", id,
+    getHome(id));
+}
+
+void DatasetGenerator::appendFrame(
+  Buffer& out, NodeType rank, PhaseType phase, LBIterationType lb_iter) const {
+  auto text = [&out](std::string_view str) { out.append(str); };
+
+  // Objects found on this rank are homed on it or on one of its neighbors
+  auto const n_ranks = spec_.num_ranks;
+  std::vector<uint64_t> homes = {static_cast<uint64_t>(rank)};
+  if (spec_.migration_fraction > 0.0 and n_ranks > 1) {
+    homes.push_back((rank + n_ranks - 1) % n_ranks);
+    homes.push_back((rank + 1) % n_ranks);
+    std::sort(homes.begin(), homes.end());
+    homes.erase(std::unique(homes.begin(), homes.end()), homes.end());
+  }
+
+  std::vector<ElementIDType> objects;
+  for (auto const home : homes) {
+    for (auto id = offsets_[home]; id < offsets_[home + 1]; id++) {
+      if (getLocation(id, phase, lb_iter) == rank) {
+        objects.push_back(id);
+      }
+    }
+  }
+
+  text(R"("tasks":[)");
+  for (std::size_t t = 0; t < objects.size(); t++) {
+    auto const id = objects[t];
+    double const load = getLoad(id, phase, lb_iter);
+    text(t == 0 ? "{" : ",{");
+    text(R"("entity":)");
+    appendEntity(out, id);
+    fmt::format_to(
+      std::back_inserter(out), R"(,"node":{},"resource":"cpu","time":)",
+      rank);
+    appendDouble(out, load);
+
+    if (spec_.num_subphases > 0) {
+      SplitMix64 engine(hashOf(spec_.seed, Subphase, id, phase, lb_iter));
+      std::vector<double> weights(spec_.num_subphases);
+      double sum = 0.0;
+      for (auto& w : weights) {
+        w = 0.5 + uniform01(engine());
+        sum += w;
+      }
+      text(R"(,"subphases":[)");
+      for (std::size_t i = 0; i < weights.size(); i++) {
+        fmt::format_to(
+          std::back_inserter(out), R"({}{{"id":{},"time":)", i == 0 ? "" : ",",
+          i);
+        appendDouble(out, load * weights[i] / sum);
+        text("}");
+      }
+      text("]");
+    }
+
+    if (not spec_.user_defined.empty()) {
+      text(R"(,"user_defined":{)");
+      for (std::size_t i = 0; i < spec_.user_defined.size(); i++) {
+        auto const& name = escaped_names_[i];
+        auto const bits =
+          hashOf(spec_.seed, UserDefined, id, phase, lb_iter, i);
+        fmt::format_to(
+          std::back_inserter(out), R"({}"{}":)", i == 0 ? "" : ",", name);
+        switch (spec_.user_defined[i].type) {
+        case UserDefinedType::Double:
+          appendDouble(out, uniform01(bits));
+          break;
+        case UserDefinedType::Int:
+          fmt::format_to(std::back_inserter(out), "{}", bits % 1000);
+          break;
+        case UserDefinedType::String:
+          fmt::format_to(std::back_inserter(out), R"("{}_{}")", name, id);
+          break;
+        }
+      }
+      text("}");
+    }
+    text("}");
+  }
+  text("]");
+
+  if (spec_.comm_topology == CommTopology::None) {
+    return;
+  }
+
+  text(R"(,"communications":[)");
+  bool first = true;
+  for (auto const id : objects) {
+    auto const receivers = getReceivers(id);
+    for (std::size_t k = 0; k < receivers.size(); k++) {
+      SplitMix64 engine(hashOf(spec_.seed, Message, id, k, phase, lb_iter));
+      uint64_t const messages = 1 + engine() % 4;
+      double const bytes = static_cast<double>(messages) * spec_.comm_bytes *
+        (0.5 + uniform01(engine()));
+      text(first ? R"({"type":"SendRecv","from":)"
+                 : R"(,{"type":"SendRecv","from":)");
+      first = false;
+      appendEntity(out, id);
+      text(R"(,"to":)");
+      appendEntity(out, receivers[k]);
+      fmt::format_to(
+        std::back_inserter(out), R"(,"messages":{},"bytes":)", messages);
+      appendDouble(out, bytes);
+      text("}");
+    }
+  }
+  text("]");
+}
+
+std::string
+DatasetGenerator::generatePhase(NodeType rank, PhaseType phase) const {
+  Buffer out;
+  fmt::format_to(std::back_inserter(out), R"({{"id":{},)", phase);
+  appendFrame(out, rank, phase, no_lb_iter);
+  if (spec_.num_lb_iterations > 0) {
+    out.append(std::string_view{R"(,"lb_iterations":[)"});
+    for (LBIterationType i = 0; i < spec_.num_lb_iterations; i++) {
+      fmt::format_to(
+        std::back_inserter(out), R"({}{{"id":{},)", i == 0 ? "" : ",", i);
+      appendFrame(out, rank, phase, i);
+      out.push_back('}');
+    }
+    out.push_back(']');
+  }
+  out.push_back('}');
+  return fmt::to_string(out);
+}
+
+void DatasetGenerator::writeRank(
+  NodeType rank, std::string const& filename) const {
+  std::ofstream os(filename, std::ios::binary);
+  if (not os.good()) {
+    throw std::runtime_error("Cannot open " + filename + " for writing.");
+  }
+
+  {
+    // Phases are streamed one at a time rather than held in a single document
+    OutputAdaptor<std::ofstream> adaptor(os, spec_.compress, spec_.quality);
+    auto writeText = [&adaptor](std::string const& text) {
+      adaptor.write_characters(text.data(), text.size());
+    };
+    writeText(fmt::format(
+      R"({{"type":"LBDatafile","metadata":{{"type":"LBDatafile","rank":{}}},)"
+      R"("phases":[)",
+      rank));
+    for (PhaseType phase = 0; phase < spec_.num_phases; phase++) {
+      if (phase > 0) {
+        writeText(",");
+      }
+      writeText(generatePhase(rank, phase));
+    }
+    writeText("]}\n");
+  }
+
+  if (not os.good()) {
+    throw std::runtime_error("Failed writing " + filename + ".");
+  }
+}
+
+void DatasetGenerator::write(
+  std::string const& directory, std::string const& stem) const {
+  std::filesystem::create_directories(directory);
+  parallelFor(spec_.num_ranks, [&](uint64_t rank) {
+    auto const r = static_cast<NodeType>(rank);
+    writeRank(r, getFilename(directory, stem, r));
+  });
+}
+
+std::string DatasetGenerator::getFilename(
+  std::string const& directory, std::string const& stem, NodeType rank) const {
+  auto const name = stem + "." + std::to_string(rank) +
+    (spec_.compress ? ".json.br" : ".json");
+  return (std::filesystem::path(directory) / name).string();
+}
+
+/*static*/ LoadDistribution
+DatasetGenerator::getLoadDistribution(std::string const& name) {
+  if (name == "constant") {
+    return LoadDistribution::Constant;
+  } else if (name == "uniform") {
+    return LoadDistribution::Uniform;
+  } else if (name == "normal") {
+    return LoadDistribution::Normal;
+  } else if (name == "lognormal") {
+    return LoadDistribution::LogNormal;
+  }
+  throw std::runtime_error(
+    "Unknown load distribution \"" + name +
+    "\" (expected \"constant\", \"uniform\", \"normal\" or \"lognormal\").");
+}
+
+/*static*/ CommTopology
+DatasetGenerator::getCommTopology(std::string const& name) {
+  if (name == "none") {
+    return CommTopology::None;
+  } else if (name == "ring") {
+    return CommTopology::Ring;
+  } else if (name == "stencil") {
+    return CommTopology::Stencil;
+  } else if (name == "random") {
+    return CommTopology::Random;
+  }
+  throw std::runtime_error(
+    "Unknown communication topology \"" + name +
+    "\" (expected \"none\", \"ring\", \"stencil\" or \"random\").");
+}
+
+/*static*/ UserDefinedField
+DatasetGenerator::getUserDefinedField(std::string const& description) {
+  UserDefinedField field;
+  auto const colon = description.rfind(':');
+  field.name = description.substr(0, colon);
+  if (colon != std::string::npos) {
+    auto const type = description.substr(colon + 1);
+    if (type == "double") {
+      field.type = UserDefinedType::Double;
+    } else if (type == "int") {
+      field.type = UserDefinedType::Int;
+    } else if (type == "string") {
+      field.type = UserDefinedType::String;
+    } else {
+      throw std::runtime_error(
+        "Unknown user-defined type \"" + type +
+        "\" (expected \"double\", \"int\" or \"string\").");
+    }
+  }
+  if (field.name.empty()) {
+    throw std::runtime_error(
+      "User-defined field \"" + description + "\" has no name.");
+  }
+  return field;
+}
+
+} /* end namespace vt::tv::utility */
@@ -0,0 +1,313 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             dataset_generator.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_DATASET_GENERATOR_H
+#define INCLUDED_VT_TV_UTILITY_DATASET_GENERATOR_H
+
+#include "vt-tv/api/types.h"
+
+#include <fmt-vt/format.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \enum LoadDistribution
+ *
+ * \brief The distributions of the object loads
+ */
+enum struct LoadDistribution : uint8_t {
+  Constant = 0, /**< Every object has the mean load */
+  Uniform = 1,  /**< Uniform within mean * (1 +/- spread) */
+  Normal = 2,   /**< Normal with a deviation of mean * spread, clamped at 0 */
+  LogNormal = 3 /**< Log-normal of given mean, with a log deviation of spread */
+};
+
+/**
+ * \enum CommTopology
+ *
+ * \brief The topologies of the object communication graph
+ */
+enum struct CommTopology : uint8_t {
+  None = 0,    /**< No communication */
+  Ring = 1,    /**< Each object sends to its peer on the next rank */
+  Stencil = 2, /**< Each object sends to its nearest neighbors by id */
+  Random = 3   /**< Each object sends to random objects */
+};
+
+/**
+ * \enum UserDefinedType
+ *
+ * \brief The types of the generated user-defined fields
+ */
+enum struct UserDefinedType : uint8_t {
+  Double = 0, /**< Uniform in [0, 1) */
+  Int = 1,    /**< Uniform in [0, 1000) */
+  String = 2  /**< The field name followed by the object id */
+};
+
+/**
+ * \struct UserDefinedField
+ *
+ * \brief A user-defined field added to every task
+ */
+struct UserDefinedField {
+  std::string name;                              /**< The field name */
+  UserDefinedType type = UserDefinedType::Double; /**< The field type */
+};
+
+/**
+ * \struct DatasetSpec
+ *
+ * \brief The parameters of a synthetic LB dataset
+ */
+struct DatasetSpec {
+  uint64_t num_ranks = 4;              /**< Number of ranks (data files) */
+  uint64_t num_objects_per_rank = 100; /**< Mean number of objects per rank */
+  double objects_spread = 0.0;  /**< Relative spread of the object counts */
+  uint64_t num_phases = 1;      /**< Number of phases */
+  uint64_t num_lb_iterations = 0; /**< Number of LB iterations per phase */
+  uint64_t num_subphases = 0;     /**< Number of subphases per task */
+  LoadDistribution load_distribution = LoadDistribution::Uniform;
+  double load_mean = 1.0;    /**< Mean object load */
+  double load_spread = 0.5;  /**< Spread of the object loads */
+  double phase_noise = 0.05; /**< Relative change of the loads per frame */
+  double hot_rank_fraction = 0.0; /**< Fraction of overloaded ranks */
+  double hot_rank_factor = 2.0;   /**< Load factor of overloaded ranks */
+  CommTopology comm_topology = CommTopology::Random;
+  uint64_t comm_degree = 4;       /**< Messages sent per object */
+  double remote_fraction = 0.5;   /**< Random topology: off-rank receivers */
+  double comm_bytes = 1024.0;     /**< Mean bytes per message */
+  double migration_fraction = 0.0; /**< Objects moved to a neighbor rank */
+  std::vector<UserDefinedField> user_defined; /**< Fields of every task */
+  uint64_t seed = 0;     /**< Seed of all random draws */
+  bool compress = false; /**< Whether files are brotli-compressed */
+  int quality = 8;       /**< The brotli quality when compressing */
+};
+
+/**
+ * \struct DatasetGenerator
+ *
+ * \brief Generates synthetic LBDatafile JSON, one file per rank
+ *
+ * Every value is drawn from a hash of the seed and of what it describes, so
+ * that any rank, phase or LB iteration is generated on its own: ranks are
+ * written concurrently and the output does not depend on the number of
+ * threads. Files are streamed a phase at a time, hence the memory needed does
+ * not grow with the number of phases.
+ *
+ * Object ids are contiguous from rank to rank, and objects are homed on the
+ * rank they are created on. In each frame (phase or LB iteration), a fraction
+ * of the objects is found on a neighbor of their home rank instead. Each
+ * communication is recorded once, by the rank of its sender.
+ */
+struct DatasetGenerator {
+  /**
+   * \brief Construct the generator, checking the parameters
+   *
+   * \param[in] in_spec the parameters of the dataset
+   */
+  explicit DatasetGenerator(DatasetSpec in_spec);
+
+  /**
+   * \brief Get the number of objects homed on a rank
+   *
+   * \param[in] rank the rank
+   *
+   * \return the number of objects
+   */
+  uint64_t getNumObjects(NodeType rank) const;
+
+  /**
+   * \brief Get the total number of objects
+   *
+   * \return the number of objects
+   */
+  uint64_t getTotalObjects() const { return offsets_.back(); }
+
+  /**
+   * \brief Get the home rank of an object
+   *
+   * \param[in] id the object id
+   *
+   * \return the home rank
+   */
+  NodeType getHome(ElementIDType id) const;
+
+  /**
+   * \brief Get the rank an object is on in a frame
+   *
+   * \param[in] id the object id
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration, or \c no_lb_iter for the phase
+   *
+   * \return the rank
+   */
+  NodeType getLocation(
+    ElementIDType id, PhaseType phase, LBIterationType lb_iter) const;
+
+  /**
+   * \brief Generate the JSON of a phase of a rank, LB iterations included
+   *
+   * \param[in] rank the rank
+   * \param[in] phase the phase
+   *
+   * \return the phase JSON text
+   */
+  std::string generatePhase(NodeType rank, PhaseType phase) const;
+
+  /**
+   * \brief Write the data file of a rank
+   *
+   * \param[in] rank the rank
+   * \param[in] filename the name of the file
+   */
+  void writeRank(NodeType rank, std::string const& filename) const;
+
+  /**
+   * \brief Write the data files of all ranks, concurrently when OpenMP is
+   * enabled
+   *
+   * \param[in] directory the output directory, created if need be
+   * \param[in] stem the stem of the file names
+   */
+  void write(std::string const& directory, std::string const& stem) const;
+
+  /**
+   * \brief Get the name of the data file of a rank, as found by the reader
+   *
+   * \param[in] directory the output directory
+   * \param[in] stem the stem of the file names
+   * \param[in] rank the rank
+   *
+   * \return the file name
+   */
+  std::string getFilename(
+    std::string const& directory, std::string const& stem,
+    NodeType rank) const;
+
+  /**
+   * \brief Get the load distribution of a given name
+   *
+   * \param[in] name "constant", "uniform", "normal" or "lognormal"
+   *
+   * \return the load distribution
+   */
+  static LoadDistribution getLoadDistribution(std::string const& name);
+
+  /**
+   * \brief Get the communication topology of a given name
+   *
+   * \param[in] name "none", "ring", "stencil" or "random"
+   *
+   * \return the communication topology
+   */
+  static CommTopology getCommTopology(std::string const& name);
+
+  /**
+   * \brief Get a user-defined field from its description
+   *
+   * \param[in] description the name, optionally followed by ":double",
+   * ":int" or ":string"
+   *
+   * \return the user-defined field
+   */
+  static UserDefinedField getUserDefinedField(std::string const& description);
+
+private:
+  using Buffer = fmt::memory_buffer;
+
+  /**
+   * \internal \brief Append the tasks and communications of a frame
+   *
+   * \param[out] out the JSON text
+   * \param[in] rank the rank
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration, or \c no_lb_iter for the phase
+   */
+  void appendFrame(
+    Buffer& out, NodeType rank, PhaseType phase, LBIterationType lb_iter) const;
+
+  /**
+   * \internal \brief Append the entity of an object
+   *
+   * \param[out] out the JSON text
+   * \param[in] id the object id
+   */
+  void appendEntity(Buffer& out, ElementIDType id) const;
+
+  /**
+   * \internal \brief Get the load of an object in a frame
+   *
+   * \param[in] id the object id
+   * \param[in] phase the phase
+   * \param[in] lb_iter the LB iteration, or \c no_lb_iter for the phase
+   *
+   * \return the load
+   */
+  double getLoad(
+    ElementIDType id, PhaseType phase, LBIterationType lb_iter) const;
+
+  /**
+   * \internal \brief Get the receivers of the messages of an object
+   *
+   * \param[in] id the object id
+   *
+   * \return the receiving object ids
+   */
+  std::vector<ElementIDType> getReceivers(ElementIDType id) const;
+
+private:
+  DatasetSpec spec_;
+  /** The first object id of every rank, followed by the number of objects */
+  std::vector<ElementIDType> offsets_;
+  /** The names of the user-defined fields, escaped for JSON strings */
+  std::vector<std::string> escaped_names_;
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_DATASET_GENERATOR_H*/
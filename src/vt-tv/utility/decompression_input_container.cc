@@ -52,7 +52,8 @@ DecompressionInputContainer::DecompressionInputContainer(
   : chunk_size_(in_chunk_size) {
   std::ifstream is(filename, std::ios::binary);
   assert(is.good());
-  d_ = std::make_unique<DecompressorStreamType<std::ifstream>>(std::move(is));
+  d_ = std::make_unique<DecompressorStreamType<std::ifstream>>(
+    std::move(is), chunk_size_);
   output_buf_ = std::make_unique<uint8_t[]>(chunk_size_);
   len_ = d_->read(output_buf_.get(), chunk_size_);
 }
@@ -61,11 +62,8 @@ bool DecompressionInputContainer::advance() const {
   if (cur_ + 1 == len_) {
     len_ = d_->read(output_buf_.get(), chunk_size_);
     cur_ = 0;
-    if (cur_ + 1 < len_) {
-      return true;
-    } else {
-      return false;
-    }
+    // A last chunk of a single character is still data
+    return len_ > 0;
   }
   if (cur_ + 1 < len_) {
     cur_++;
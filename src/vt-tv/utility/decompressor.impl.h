@@ -45,6 +45,7 @@
 #define INCLUDED_VT_TV_UTILITY_COMPRESS_DECOMPRESSOR_IMPL_H
 
 #include "vt-tv/utility/decompressor.h"
+#include "vt-tv/utility/log.h"
 
 #include <cassert>
 
@@ -127,14 +128,13 @@ std::size_t Decompressor<Readable>::read(
     case BROTLI_DECODER_RESULT_ERROR: {
       // we have hit an unknown error, print the code and corresponding message!
       auto error_code = BrotliDecoderGetErrorCode(dec_);
-      auto error_str = fmt::format(
-        "code={}, msg={}\n",
+      VT_TV_LOG(
+        Loader, Error, "code={}, msg={}",
         static_cast<typename std::underlying_type<decltype(error_code)>::type>(
           error_code
         ),
         BrotliDecoderErrorString(error_code)
       );
-      fmt::print(error_str);
       assert(false);
       break;
     }
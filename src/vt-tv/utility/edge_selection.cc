@@ -0,0 +1,86 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              edge_selection.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/edge_selection.h"
+
+#include <algorithm>
+
+namespace vt::tv::utility {
+
+std::vector<uint64_t>
+EdgeSelection::select(std::vector<double> const& volumes) const {
+  uint64_t const n_edges = volumes.size();
+  std::vector<uint64_t> selected;
+  if (top_k == 0) {
+    for (uint64_t e = 0; e < n_edges; e++) {
+      if (volumes[e] >= min_volume) {
+        selected.push_back(e);
+      }
+    }
+    return selected;
+  }
+
+  // The heap holds the best edges seen so far, the worst one at its front
+  auto better = [&volumes](uint64_t a, uint64_t b) {
+    return volumes[a] > volumes[b] || (volumes[a] == volumes[b] && a < b);
+  };
+  selected.reserve(std::min(top_k, n_edges));
+  for (uint64_t e = 0; e < n_edges; e++) {
+    if (!(volumes[e] >= min_volume)) {
+      continue;
+    }
+    if (selected.size() < top_k) {
+      selected.push_back(e);
+      std::push_heap(selected.begin(), selected.end(), better);
+    } else if (better(e, selected.front())) {
+      std::pop_heap(selected.begin(), selected.end(), better);
+      selected.back() = e;
+      std::push_heap(selected.begin(), selected.end(), better);
+    }
+  }
+
+  std::sort(selected.begin(), selected.end());
+  return selected;
+}
+
+} /* end namespace vt::tv::utility */
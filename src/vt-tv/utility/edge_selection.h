@@ -0,0 +1,91 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               edge_selection.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_EDGE_SELECTION_H
+#define INCLUDED_VT_TV_UTILITY_EDGE_SELECTION_H
+
+#include <cstdint>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct EdgeSelection
+ *
+ * \brief Budget on the communication edges written to object meshes
+ *
+ * Edges can be restricted to communications between ranks, to volumes above
+ * a threshold, and to the largest volumes. The largest volumes are selected
+ * in a single pass with a bounded heap, so that the cost stays proportional
+ * to the number of edges and the memory to the budget.
+ */
+struct EdgeSelection {
+  uint64_t top_k = 0;           /**< Maximum number of edges (0 for all) */
+  double min_volume = 0.0;      /**< Minimum volume of an edge */
+  bool inter_rank_only = false; /**< Whether to drop edges within a rank */
+
+  /**
+   * \brief Whether the selection may drop any edge
+   *
+   * \return whether edges are filtered
+   */
+  bool isActive() const {
+    return top_k > 0 || min_volume > 0.0 || inter_rank_only;
+  }
+
+  /**
+   * \brief Select edges by volume
+   *
+   * Edges below the minimum volume are dropped, then the \c top_k largest
+   * volumes are kept, ties going to the earliest edges.
+   *
+   * \param[in] volumes the volume of each edge
+   *
+   * \return the indices of the selected edges, in increasing order
+   */
+  std::vector<uint64_t> select(std::vector<double> const& volumes) const;
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_EDGE_SELECTION_H*/
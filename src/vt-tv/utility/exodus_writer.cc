@@ -0,0 +1,305 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               exodus_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/exodus_writer.h"
+
+#include <vtk_exodusII.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace vt::tv::utility {
+
+namespace {
+
+/**
+ * \internal \brief Build the array of C strings expected by Exodus II
+ */
+std::vector<char*> toCStrings(std::vector<std::string>& names) {
+  std::vector<char*> c_names;
+  for (auto& name : names) {
+    c_names.push_back(name.data());
+  }
+  return c_names;
+}
+
+} /* end anonymous namespace */
+
+ExodusWriter::ExodusWriter(
+  std::string in_filename,
+  std::string const& title,
+  std::vector<std::array<double, 3>> const& coordinates,
+  std::vector<Block> in_blocks,
+  std::vector<std::string> in_global_variables)
+  : filename_(std::move(in_filename)),
+    n_nodes_(coordinates.size()),
+    blocks_(std::move(in_blocks)),
+    global_variables_(std::move(in_global_variables)) {
+  uint64_t n_elements = 0;
+  for (auto const& block : blocks_) {
+    n_elements += block.n_elements;
+  }
+  if (n_elements != n_nodes_) {
+    throw std::runtime_error(
+      "Exodus element blocks hold " + std::to_string(n_elements) +
+      " elements for " + std::to_string(n_nodes_) + " nodes.");
+  }
+
+  int comp_ws = sizeof(double);
+  int io_ws = sizeof(double);
+  exoid_ = ex_create(filename_.c_str(), EX_CLOBBER, &comp_ws, &io_ws);
+  if (exoid_ < 0) {
+    throw std::runtime_error(
+      "Cannot create Exodus file \"" + filename_ + "\".");
+  }
+
+  // Names are not truncated to the default 32 characters
+  std::size_t max_name_length = 32;
+  for (auto const& block : blocks_) {
+    max_name_length = std::max(max_name_length, block.name.size());
+    for (auto const& variable : block.variables) {
+      max_name_length = std::max(max_name_length, variable.size());
+    }
+  }
+  for (auto const& variable : global_variables_) {
+    max_name_length = std::max(max_name_length, variable.size());
+  }
+  check(
+    ex_set_max_name_length(exoid_, static_cast<int>(max_name_length)),
+    "ex_set_max_name_length");
+
+  check(
+    ex_put_init(
+      exoid_, title.c_str(), 3, n_nodes_, n_elements, blocks_.size(), 0, 0),
+    "ex_put_init");
+
+  std::vector<double> x(n_nodes_), y(n_nodes_), z(n_nodes_);
+  for (uint64_t i = 0; i < n_nodes_; i++) {
+    x[i] = coordinates[i][0];
+    y[i] = coordinates[i][1];
+    z[i] = coordinates[i][2];
+  }
+  check(ex_put_coord(exoid_, x.data(), y.data(), z.data()), "ex_put_coord");
+
+  // Each element of a block is attached to the next node
+  std::vector<std::string> element_variables;
+  std::vector<int> node_conn;
+  int node = 1;
+  for (std::size_t b = 0; b < blocks_.size(); b++) {
+    auto const& block = blocks_[b];
+    ex_entity_id const block_id = b + 1;
+    check(
+      ex_put_block(
+        exoid_, EX_ELEM_BLOCK, block_id, "SPHERE", block.n_elements, 1, 0, 0,
+        0),
+      "ex_put_block");
+    check(
+      ex_put_name(exoid_, EX_ELEM_BLOCK, block_id, block.name.c_str()),
+      "ex_put_name");
+    node_conn.resize(block.n_elements);
+    for (auto& n : node_conn) {
+      n = node++;
+    }
+    if (block.n_elements > 0) {
+      check(
+        ex_put_conn(
+          exoid_, EX_ELEM_BLOCK, block_id, node_conn.data(), nullptr, nullptr),
+        "ex_put_conn");
+    }
+
+    // Blocks share the element variables that have the same name
+    variable_indices_.emplace_back();
+    for (auto const& variable : block.variables) {
+      auto it = std::find(
+        element_variables.begin(), element_variables.end(), variable);
+      variable_indices_.back().push_back(
+        static_cast<int>(it - element_variables.begin()));
+      if (it == element_variables.end()) {
+        element_variables.push_back(variable);
+      }
+    }
+  }
+
+  auto displacement_names = getDisplacementNames();
+  std::vector<std::string> nodal_variables(
+    displacement_names.begin(), displacement_names.end());
+  check(ex_put_variable_param(exoid_, EX_NODAL, 3), "ex_put_variable_param");
+  check(
+    ex_put_variable_names(
+      exoid_, EX_NODAL, 3, toCStrings(nodal_variables).data()),
+    "ex_put_variable_names");
+
+  if (!element_variables.empty()) {
+    int const n_vars = static_cast<int>(element_variables.size());
+    check(
+      ex_put_variable_param(exoid_, EX_ELEM_BLOCK, n_vars),
+      "ex_put_variable_param");
+    check(
+      ex_put_variable_names(
+        exoid_, EX_ELEM_BLOCK, n_vars, toCStrings(element_variables).data()),
+      "ex_put_variable_names");
+
+    // Variables are only stored on the blocks that define them
+    std::vector<int> truth_table(blocks_.size() * n_vars, 0);
+    for (std::size_t b = 0; b < blocks_.size(); b++) {
+      for (int v : variable_indices_[b]) {
+        truth_table[b * n_vars + v] = 1;
+      }
+    }
+    check(
+      ex_put_truth_table(
+        exoid_, EX_ELEM_BLOCK, static_cast<int>(blocks_.size()), n_vars,
+        truth_table.data()),
+      "ex_put_truth_table");
+  }
+
+  if (!global_variables_.empty()) {
+    int const n_vars = static_cast<int>(global_variables_.size());
+    check(
+      ex_put_variable_param(exoid_, EX_GLOBAL, n_vars),
+      "ex_put_variable_param");
+    check(
+      ex_put_variable_names(
+        exoid_, EX_GLOBAL, n_vars, toCStrings(global_variables_).data()),
+      "ex_put_variable_names");
+  }
+
+  check(ex_update(exoid_), "ex_update");
+}
+
+ExodusWriter::~ExodusWriter() {
+  try {
+    close();
+  } catch (...) {
+    // Errors can only be reported by an explicit close
+  }
+}
+
+void ExodusWriter::check(int status, char const* what) const {
+  if (status < 0) {
+    throw std::runtime_error(
+      std::string(what) + " failed on Exodus file \"" + filename_ + "\".");
+  }
+}
+
+void ExodusWriter::addStep(
+  double time,
+  std::vector<std::array<double, 3>> const& displacements,
+  std::vector<double> const& global_values,
+  std::vector<std::vector<std::vector<double>>> const& element_values) {
+  if (exoid_ < 0) {
+    throw std::runtime_error("Exodus file \"" + filename_ + "\" is closed.");
+  }
+  if (
+    displacements.size() != n_nodes_ ||
+    global_values.size() != global_variables_.size() ||
+    element_values.size() != blocks_.size()) {
+    throw std::runtime_error("Exodus time step does not match the mesh.");
+  }
+  for (std::size_t b = 0; b < blocks_.size(); b++) {
+    auto const& block = blocks_[b];
+    if (element_values[b].size() != block.variables.size()) {
+      throw std::runtime_error(
+        "Exodus time step does not match the variables of block " +
+        block.name + ".");
+    }
+    for (std::size_t v = 0; v < block.variables.size(); v++) {
+      if (element_values[b][v].size() != block.n_elements) {
+        throw std::runtime_error(
+          "Exodus variable " + block.variables[v] + " of block " + block.name +
+          " does not have one value per element.");
+      }
+    }
+  }
+
+  // Exodus II time steps are numbered from 1
+  int const step = static_cast<int>(n_steps_ + 1);
+  check(ex_put_time(exoid_, step, &time), "ex_put_time");
+
+  std::vector<double> values(n_nodes_);
+  for (int d = 0; d < 3; d++) {
+    for (uint64_t i = 0; i < n_nodes_; i++) {
+      values[i] = displacements[i][d];
+    }
+    check(
+      ex_put_var(exoid_, step, EX_NODAL, d + 1, 1, n_nodes_, values.data()),
+      "ex_put_var");
+  }
+
+  for (std::size_t b = 0; b < blocks_.size(); b++) {
+    auto const& block = blocks_[b];
+    if (block.n_elements == 0) {
+      continue;
+    }
+    for (std::size_t v = 0; v < block.variables.size(); v++) {
+      check(
+        ex_put_var(
+          exoid_, step, EX_ELEM_BLOCK, variable_indices_[b][v] + 1, b + 1,
+          block.n_elements, element_values[b][v].data()),
+        "ex_put_var");
+    }
+  }
+
+  if (!global_values.empty()) {
+    check(
+      ex_put_var(
+        exoid_, step, EX_GLOBAL, 1, 1, global_values.size(),
+        global_values.data()),
+      "ex_put_var");
+  }
+
+  // Make the step visible to readers before the next one is produced
+  check(ex_update(exoid_), "ex_update");
+  n_steps_++;
+}
+
+void ExodusWriter::close() {
+  if (exoid_ >= 0) {
+    int const exoid = exoid_;
+    exoid_ = -1;
+    check(ex_close(exoid), "ex_close");
+  }
+}
+
+} /* end namespace vt::tv::utility */
@@ -0,0 +1,175 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               exodus_writer.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_EXODUS_WRITER_H
+#define INCLUDED_VT_TV_UTILITY_EXODUS_WRITER_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct ExodusWriter
+ *
+ * \brief Streams a time series of point clouds into an Exodus II file
+ *
+ * The mesh is made of element blocks of single-node (sphere) elements, whose
+ * nodes are laid out block after block. The topology is fixed when the file
+ * is created; time steps then only carry nodal displacements, element
+ * variables and global variables, and are written one at a time so that the
+ * file can be read back while it is being generated.
+ */
+struct ExodusWriter {
+  /**
+   * \struct Block
+   *
+   * \brief Description of an element block
+   */
+  struct Block {
+    std::string name;                   /**< The block name */
+    uint64_t n_elements = 0;            /**< The number of elements */
+    std::vector<std::string> variables; /**< The element variable names */
+  };
+
+  /**
+   * \brief Create an Exodus II file and define its mesh and variables
+   *
+   * \param[in] in_filename the name of the file to write
+   * \param[in] title the title of the database
+   * \param[in] coordinates the reference coordinates of all nodes
+   * \param[in] in_blocks the element blocks, whose sizes sum to the number of
+   * nodes
+   * \param[in] in_global_variables the global variable names
+   */
+  ExodusWriter(
+    std::string in_filename,
+    std::string const& title,
+    std::vector<std::array<double, 3>> const& coordinates,
+    std::vector<Block> in_blocks,
+    std::vector<std::string> in_global_variables);
+
+  ExodusWriter(ExodusWriter const&) = delete;
+  ExodusWriter& operator=(ExodusWriter const&) = delete;
+
+  /**
+   * \brief Close the file if it was not closed
+   */
+  ~ExodusWriter();
+
+  /**
+   * \brief Append a time step
+   *
+   * \param[in] time the time value of the step
+   * \param[in] displacements the displacement of each node from its
+   * reference coordinates
+   * \param[in] global_values the value of each global variable
+   * \param[in] element_values the values of each element variable of each
+   * block, indexed by block, then variable, then element
+   */
+  void addStep(
+    double time,
+    std::vector<std::array<double, 3>> const& displacements,
+    std::vector<double> const& global_values,
+    std::vector<std::vector<std::vector<double>>> const& element_values);
+
+  /**
+   * \brief Close the file
+   */
+  void close();
+
+  /**
+   * \brief Get the number of time steps written so far
+   *
+   * \return the number of time steps
+   */
+  uint64_t getNumSteps() const { return n_steps_; }
+
+  /**
+   * \brief Get the element blocks
+   *
+   * \return the blocks
+   */
+  std::vector<Block> const& getBlocks() const { return blocks_; }
+
+  /**
+   * \brief Get the name of the Exodus II file
+   *
+   * \return the file name
+   */
+  std::string const& getFilename() const { return filename_; }
+
+  /**
+   * \brief Get the names of the nodal displacement variables
+   *
+   * \return the names, recognized as displacements by Exodus readers
+   */
+  static std::array<std::string, 3> getDisplacementNames() {
+    return {"DISPL_X", "DISPL_Y", "DISPL_Z"};
+  }
+
+private:
+  /**
+   * \internal \brief Throw if an Exodus II call failed
+   *
+   * \param[in] status the value returned by the call
+   * \param[in] what the description of the call
+   */
+  void check(int status, char const* what) const;
+
+private:
+  std::string filename_;                      /**< The name of the file */
+  int exoid_ = -1;                            /**< The Exodus file handle */
+  uint64_t n_nodes_ = 0;                      /**< The number of nodes */
+  std::vector<Block> blocks_;                 /**< The element blocks */
+  std::vector<std::string> global_variables_; /**< The global variables */
+  /// Index of each block variable among all element variables
+  std::vector<std::vector<int>> variable_indices_;
+  uint64_t n_steps_ = 0;                      /**< The number of time steps */
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_EXODUS_WRITER_H*/
@@ -0,0 +1,183 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               index_hash_map.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_INDEX_HASH_MAP_H
+#define INCLUDED_VT_TV_UTILITY_INDEX_HASH_MAP_H
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct IndexHashMap
+ *
+ * \brief Open-addressing hash map from 64-bit keys to dense indices
+ *
+ * Stores keys and values in a single flat table with linear probing, which
+ * avoids the per-node allocations of \c std::map and \c std::unordered_map
+ * when mapping IDs or packed index pairs to positions in an array. Values
+ * must be smaller than \c invalid.
+ */
+struct IndexHashMap {
+  /// Marker of empty slots, never a valid value
+  static constexpr uint64_t invalid = std::numeric_limits<uint64_t>::max();
+
+  /**
+   * \brief Construct a hash map
+   *
+   * \param[in] expected_size the number of keys to reserve space for
+   */
+  explicit IndexHashMap(std::size_t expected_size = 0) {
+    reserve(expected_size);
+  }
+
+  /**
+   * \brief Make room for a number of keys without rehashing
+   *
+   * \param[in] n the number of keys
+   */
+  void reserve(std::size_t n) {
+    // Keep the load factor at or below one half
+    std::size_t capacity = 16;
+    while (capacity < 2 * n) {
+      capacity *= 2;
+    }
+    if (capacity > slots_.size()) {
+      rehash(capacity);
+    }
+  }
+
+  /**
+   * \brief Insert a key unless it is already present
+   *
+   * \param[in] key the key
+   * \param[in] value the value to associate with a new key
+   *
+   * \return the value associated with the key and whether it was inserted
+   */
+  std::pair<uint64_t, bool> emplace(uint64_t key, uint64_t value) {
+    if (2 * (size_ + 1) > slots_.size()) {
+      rehash(2 * slots_.size());
+    }
+    std::size_t const mask = slots_.size() - 1;
+    for (std::size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+      auto& slot = slots_[i];
+      if (slot.second == invalid) {
+        slot = {key, value};
+        size_++;
+        return {value, true};
+      }
+      if (slot.first == key) {
+        return {slot.second, false};
+      }
+    }
+  }
+
+  /**
+   * \brief Look up the value of a key
+   *
+   * \param[in] key the key
+   *
+   * \return the value, or \c invalid when the key is absent
+   */
+  uint64_t find(uint64_t key) const {
+    std::size_t const mask = slots_.size() - 1;
+    for (std::size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+      auto const& slot = slots_[i];
+      if (slot.second == invalid || slot.first == key) {
+        return slot.second;
+      }
+    }
+  }
+
+  /**
+   * \brief Get the number of keys
+   *
+   * \return the number of keys
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * \brief Pack an ordered pair of 32-bit indices into a key
+   *
+   * \param[in] i the first index
+   * \param[in] j the second index
+   *
+   * \return the key
+   */
+  static uint64_t packPair(uint64_t i, uint64_t j) { return (i << 32) | j; }
+
+private:
+  /// splitmix64 finalizer: sequential IDs spread over the whole table
+  static uint64_t hash(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+
+  void rehash(std::size_t capacity) {
+    std::vector<std::pair<uint64_t, uint64_t>> old(
+      capacity, std::make_pair(uint64_t{0}, invalid));
+    old.swap(slots_);
+    size_ = 0;
+    for (auto const& [key, value] : old) {
+      if (value != invalid) {
+        emplace(key, value);
+      }
+    }
+  }
+
+private:
+  std::vector<std::pair<uint64_t, uint64_t>> slots_; /**< (key, value) slots */
+  std::size_t size_ = 0;                             /**< Number of keys */
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_INDEX_HASH_MAP_H*/
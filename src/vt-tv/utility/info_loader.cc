@@ -0,0 +1,235 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                info_loader.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/info_loader.h"
+#include "vt-tv/utility/json_reader.h"
+#include "vt-tv/utility/log.h"
+#include "vt-tv/utility/summary_file.h"
+#include "vt-tv/utility/trace.h"
+
+#include <fmt-vt/format.h>
+
+#include <filesystem>
+#include <limits>
+#include <regex>
+#include <stdexcept>
+#include <vector>
+
+#if VT_TV_OPENMP_ENABLED
+#include <omp.h>
+#endif
+
+namespace vt::tv::utility {
+
+/*static*/ std::string InfoLoader::resolveDirectory(std::string const& dir) {
+  std::filesystem::path path(dir);
+
+  // If it's a relative path, prepend the SRC_DIR
+  if (path.is_relative()) {
+    path = std::filesystem::path(SRC_DIR) / path;
+  }
+  std::string resolved = path.string();
+
+  // append / to avoid problems with file stems
+  if (!resolved.empty() && resolved.back() != '/') {
+    resolved += '/';
+  }
+  return resolved;
+}
+
+/*static*/ void InfoLoader::selectPhase(Info& info, PhaseType selected_phase) {
+  TraceSpan span("normalize_edges");
+  info.setSelectedPhase(selected_phase);
+  if (selected_phase != std::numeric_limits<PhaseType>::max()) {
+    info.normalizeEdges(selected_phase);
+  } else {
+    auto const n_phases = info.getNumPhases();
+    for (PhaseType phase = 0; phase < n_phases; phase++) {
+      info.normalizeEdges(phase);
+    }
+  }
+}
+
+/*static*/ std::unique_ptr<Info> InfoLoader::loadFromConfig(
+  YAML::Node const& config, PhaseType selected_phase) {
+  std::string input_dir =
+    resolveDirectory(config["input"]["directory"].as<std::string>());
+  std::string data_file_stem =
+    config["input"]["file_stem"].as<std::string>("data");
+
+  // Collect all file paths into a vector
+  std::vector<std::filesystem::path> data_files;
+  std::regex pattern(data_file_stem + R"(\.\d+\.json(\.br)?)");
+
+  for (const auto& entry : std::filesystem::directory_iterator(input_dir)) {
+    if (entry.is_regular_file()) {
+      const std::string filename = entry.path().filename().string();
+      if (std::regex_match(filename, pattern)) {
+        data_files.push_back(entry.path());
+      }
+    }
+  }
+
+  std::size_t n_ranks = config["input"]["n_ranks"].as<std::size_t>();
+  std::size_t x_ranks = config["viz"]["x_ranks"].as<std::size_t>();
+  std::size_t y_ranks = config["viz"]["y_ranks"].as<std::size_t>();
+  std::size_t z_ranks = config["viz"]["z_ranks"].as<std::size_t>(1);
+
+  std::size_t expected_ranks = x_ranks * y_ranks * z_ranks;
+
+  // Validate the number of files matches n_ranks and expected_ranks
+  if (data_files.size() != n_ranks) {
+    throw std::runtime_error(
+      "Number of data files (" + std::to_string(data_files.size()) +
+      ") does not match the specified n_ranks (" + std::to_string(n_ranks) +
+      ").");
+  }
+
+  if (n_ranks != expected_ranks) {
+    throw std::runtime_error(
+      "n_ranks (" + std::to_string(n_ranks) +
+      ") does not match the product of x_ranks, y_ranks, and z_ranks (" +
+      std::to_string(expected_ranks) + ").");
+  }
+
+  bool const validate_schema =
+    config["input"]["validate_schema"].as<bool>(true);
+
+  auto info = std::make_unique<Info>();
+
+#if VT_TV_OPENMP_ENABLED
+  const int threads = VT_TV_N_THREADS;
+  omp_set_num_threads(threads);
+  VT_TV_LOG(Loader, Info, "vt-tv: Using {} threads", threads);
+#pragma omp parallel for
+#endif // VT_TV_OPENMP_ENABLED
+
+  for (uint64_t i = 0; i < data_files.size(); i++) {
+    auto filepath = data_files[i].string();
+    auto filename = data_files[i].filename().string();
+
+    int64_t rank;
+    auto first_dot = filename.find(".");
+    auto next_dot = filename.find(".", first_dot + 1);
+
+    rank = std::stoll(filename.substr(first_dot + 1, next_dot - first_dot - 1));
+
+    VT_TV_LOG(Loader, Debug, "Reading file for rank {}", rank);
+    JSONReader reader{static_cast<NodeType>(rank)};
+
+    // Validate the JSON data file
+    bool is_valid = true;
+    if (validate_schema) {
+      TraceSpan span("validate_data_file", {{"rank", rank}});
+      is_valid = reader.validate_datafile(filepath);
+    }
+    if (is_valid) {
+      {
+        TraceSpan span("read_data_file", {{"rank", rank}});
+        reader.readFile(filepath);
+        Trace::get().count(
+          "bytes_read",
+          static_cast<double>(std::filesystem::file_size(data_files[i])));
+      }
+      std::unique_ptr<Info> tmpInfo;
+      {
+        TraceSpan span("parse_data_file", {{"rank", rank}});
+        tmpInfo = reader.parse();
+      }
+
+#if VT_TV_OPENMP_ENABLED
+#pragma omp critical
+#endif
+      { info->addInfo(tmpInfo->getObjectInfo(), tmpInfo->getRank(rank)); }
+
+    } else {
+      throw std::runtime_error("JSON data file is invalid: " + filepath);
+    }
+  }
+
+  if (info->getNumRanks() != n_ranks) {
+    throw std::runtime_error("Number of ranks does not match expected value.");
+  }
+
+  VT_TV_LOG(Loader, Info, "Num ranks={}", info->getNumRanks());
+  selectPhase(*info, selected_phase);
+
+  // Catalog the QOI keys once, rather than scanning for them in each frame
+  {
+    TraceSpan span("qoi_catalog");
+    info->getQOICatalog();
+  }
+
+  // With the summary next to the data files, ranges and maxima are known
+  // without another pass over all frames
+  if (config["input"]["summary"].as<bool>(false)) {
+    TraceSpan span("phase_summary");
+    auto const summary_file = SummaryFile::getPath(input_dir, data_file_stem);
+    auto const stamps = SummaryFile::stamp(data_files);
+    auto summary = SummaryFile::read(summary_file, stamps);
+    if (summary != nullptr) {
+      VT_TV_LOG(Loader, Info, "Read the summary {}", summary_file);
+    } else {
+      // The summary describes the normalized edges of all phases, whichever
+      // is selected
+      auto const n_phases = info->getNumPhases();
+      for (PhaseType phase = 0; phase < n_phases; phase++) {
+        info->normalizeEdges(phase);
+      }
+      summary =
+        std::make_shared<PhaseSummary const>(info->computePhaseSummary());
+      try {
+        SummaryFile::write(summary_file, *summary, stamps);
+        VT_TV_LOG(Loader, Info, "Wrote the summary {}", summary_file);
+      } catch (std::exception const& e) {
+        VT_TV_LOG(
+          Loader, Warning, "Warning: could not write the summary: {}",
+          e.what());
+      }
+    }
+    info->setPhaseSummary(summary);
+  }
+  return info;
+}
+
+} /* end namespace vt::tv::utility */
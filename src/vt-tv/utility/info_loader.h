@@ -0,0 +1,108 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                info_loader.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_INFO_LOADER_H
+#define INCLUDED_VT_TV_UTILITY_INFO_LOADER_H
+
+#include "vt-tv/api/info.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct InfoLoader
+ *
+ * \brief Load the data of all ranks described by the input section of a YAML
+ * configuration, without any rendering dependency
+ */
+struct InfoLoader {
+  /**
+   * \brief Resolve a directory of the configuration
+   *
+   * \param[in] dir the directory, relative to the source directory if not
+   * absolute
+   *
+   * \return the resolved directory, ending with a separator
+   */
+  static std::string resolveDirectory(std::string const& dir);
+
+  /**
+   * \brief Select the phase of the data to visualize and normalize the
+   * communication edges of the phases visualized, the only changes made to
+   * the data before it is shared read-only
+   *
+   * \param[in] info the data of all ranks
+   * \param[in] selected_phase the phase, or all phases when set to the
+   * maximum phase value
+   */
+  static void selectPhase(Info& info, PhaseType selected_phase);
+
+  /**
+   * \brief Read the JSON data files of all ranks of a configuration
+   *
+   * The schema of each data file is validated unless
+   * \c input.validate_schema is false. When \c input.summary is set, the
+   * summary of all frames is read from its file next to the data files, or
+   * computed and written there when the file is missing or stale.
+   *
+   * \param[in] config the configuration, with \c input.directory,
+   * \c input.file_stem, \c input.n_ranks and the \c viz rank grid
+   * \param[in] selected_phase the phase to visualize, or all phases when set
+   * to the maximum phase value
+   *
+   * \return the data of all ranks for all phases, with its QOI catalog and
+   * summary, and the edges of the selected phases normalized
+   */
+  static std::unique_ptr<Info> loadFromConfig(
+    YAML::Node const& config,
+    PhaseType selected_phase = std::numeric_limits<PhaseType>::max());
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_INFO_LOADER_H*/
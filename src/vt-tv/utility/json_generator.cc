@@ -88,6 +88,8 @@ std::unique_ptr<nlohmann::json> JSONGenerator::generateJSON() const {
     }
 
     // @todo: add communications
+
+    task_index++;
   }
 
   return std::make_unique<json>(std::move(j));
@@ -45,6 +45,7 @@
 #include "vt-tv/utility/json_reader.h"
 #include "vt-tv/utility/decompression_input_container.h"
 #include "vt-tv/utility/input_iterator.h"
+#include "vt-tv/utility/log.h"
 #include "vt-tv/utility/qoi_serializer.h"
 
 #include <nlohmann/json.hpp>
@@ -64,8 +65,7 @@ bool JSONReader::isCompressed(std::string const& in_filename) const {
   // determine if the file is compressed or not
   std::ifstream is(in_filename);
   if (not is.good()) {
-    auto str = fmt::format("Filename is not valid: {}", in_filename);
-    fmt::print(str);
+    VT_TV_LOG(Loader, Error, "Filename is not valid: {}", in_filename);
     assert(false && "Invalid file");
     return false;
   }
@@ -227,7 +227,8 @@ std::unique_ptr<WorkDistribution> JSONReader::parsePhaseIter(
       auto type = comm["type"];
       if (type == "SendRecv") {
         auto bytes = comm["bytes"];
-        auto messages = comm["messages"];
+        // A record stands for a single message unless told otherwise
+        uint64_t const messages = comm.value("messages", uint64_t{1});
 
         auto from = comm["from"];
         auto to = comm["to"];
@@ -244,15 +245,17 @@ std::unique_ptr<WorkDistribution> JSONReader::parsePhaseIter(
         // Object on this rank sent data
         auto from_it = objects.find(from_id);
         if (from_it != objects.end()) {
-          from_it->second.addSentCommunications(to_id, bytes);
+          from_it->second.addSentCommunications(to_id, bytes, messages);
         } else {
           auto to_it = objects.find(to_id);
           if (to_it != objects.end()) {
-            to_it->second.addReceivedCommunications(from_id, bytes);
+            to_it->second.addReceivedCommunications(
+              from_id, bytes, messages);
           } else {
-            fmt::print(
+            VT_TV_LOG_LIMITED(
+              Loader, Warning, 10,
               "Warning: Communication {} -> {}: neither sender nor "
-              "recipient was found in objects.\n",
+              "recipient was found in objects.",
               from_id,
               to_id);
           }
@@ -0,0 +1,143 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                    log.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/log.h"
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace vt::tv::utility {
+
+std::array<std::atomic<LogLevel>, 4> Log::levels_ = {
+  LogLevel::Info, LogLevel::Info, LogLevel::Info, LogLevel::Info};
+std::atomic<uint64_t> Log::suppressed_ = 0;
+std::atomic<uint64_t> Log::run_ = 1;
+
+/*static*/ void Log::setLevel(LogModule module, LogLevel level) {
+  levels_[static_cast<std::size_t>(module)].store(
+    level, std::memory_order_relaxed);
+}
+
+/*static*/ void Log::setLevel(LogLevel level) {
+  for (auto& l : levels_) {
+    l.store(level, std::memory_order_relaxed);
+  }
+}
+
+/*static*/ void Log::configure(std::string const& spec) {
+  // Parse everything before changing any level
+  LogLevel all = LogLevel::Info;
+  std::vector<std::pair<LogModule, LogLevel>> modules;
+  std::istringstream is(spec);
+  std::string item;
+  while (std::getline(is, item, ',')) {
+    auto const equal = item.find('=');
+    if (equal == std::string::npos) {
+      all = getLevelType(item);
+    } else {
+      modules.emplace_back(
+        getModuleType(item.substr(0, equal)),
+        getLevelType(item.substr(equal + 1)));
+    }
+  }
+
+  setLevel(all);
+  for (auto const& [module, level] : modules) {
+    setLevel(module, level);
+  }
+}
+
+/*static*/ LogLevel Log::getLevelType(std::string const& name) {
+  if (name == "off") {
+    return LogLevel::Off;
+  } else if (name == "error") {
+    return LogLevel::Error;
+  } else if (name == "warning") {
+    return LogLevel::Warning;
+  } else if (name == "info") {
+    return LogLevel::Info;
+  } else if (name == "debug") {
+    return LogLevel::Debug;
+  }
+  throw std::runtime_error(
+    "Unknown log level \"" + name +
+    "\" (expected \"off\", \"error\", \"warning\", \"info\" or \"debug\").");
+}
+
+/*static*/ LogModule Log::getModuleType(std::string const& name) {
+  if (name == "general") {
+    return LogModule::General;
+  } else if (name == "loader") {
+    return LogModule::Loader;
+  } else if (name == "model") {
+    return LogModule::Model;
+  } else if (name == "render") {
+    return LogModule::Render;
+  }
+  throw std::runtime_error(
+    "Unknown log module \"" + name +
+    "\" (expected \"general\", \"loader\", \"model\" or \"render\").");
+}
+
+/*static*/ void Log::print(std::string const& message) {
+  // A single write keeps the lines of concurrent threads whole
+  std::string line = message;
+  line += '\n';
+  std::fwrite(line.data(), 1, line.size(), stdout);
+}
+
+/*static*/ void Log::finish() {
+  auto const suppressed = suppressed_.exchange(0);
+  if (suppressed > 0 and isEnabled(LogModule::General, LogLevel::Warning)) {
+    write(
+      "Warning: {} repeated messages were suppressed (see the log_level "
+      "option)",
+      suppressed);
+  }
+  run_++;
+  std::fflush(stdout);
+}
+
+} /* end namespace vt::tv::utility */
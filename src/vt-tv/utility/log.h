@@ -0,0 +1,282 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                    log.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_LOG_H
+#define INCLUDED_VT_TV_UTILITY_LOG_H
+
+#include <fmt-vt/format.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace vt::tv::utility {
+
+/**
+ * \enum LogLevel
+ *
+ * \brief The levels of diagnostics, each including the previous ones
+ */
+enum struct LogLevel : uint8_t {
+  Off = 0,     /**< Nothing is printed */
+  Error = 1,   /**< Failures of the run */
+  Warning = 2, /**< Suspicious data or configuration */
+  Info = 3,    /**< Progress of the run, a few lines per frame */
+  Debug = 4    /**< Details of every phase, mesh and file */
+};
+
+/**
+ * \enum LogModule
+ *
+ * \brief The parts of vt-tv whose diagnostics are switched independently
+ */
+enum struct LogModule : uint8_t {
+  General = 0, /**< Configuration and run summaries */
+  Loader = 1,  /**< Reading and parsing of the data files */
+  Model = 2,   /**< Consistency of the data model */
+  Render = 3   /**< Meshes, images and their writers */
+};
+
+/**
+ * \struct Log
+ *
+ * \brief Prints diagnostics to the standard output, by module and level
+ *
+ * Messages are printed as is, followed by a new line. Use the \c VT_TV_LOG
+ * macros rather than \c write: while a level is disabled, a message costs a
+ * relaxed atomic load and a branch, and its arguments are not evaluated.
+ * Every module logs at the \c Info level by default.
+ */
+struct Log {
+  /**
+   * \brief Whether messages of a module and level are printed
+   *
+   * \param[in] module the module
+   * \param[in] level the level of the message
+   *
+   * \return whether the message is printed
+   */
+  static bool isEnabled(LogModule module, LogLevel level) {
+    return level != LogLevel::Off and
+      level <= levels_[static_cast<std::size_t>(module)].load(
+                 std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Get the level of a module
+   *
+   * \param[in] module the module
+   *
+   * \return the most detailed level printed
+   */
+  static LogLevel getLevel(LogModule module) {
+    return levels_[static_cast<std::size_t>(module)].load(
+      std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Set the level of a module
+   *
+   * \param[in] module the module
+   * \param[in] level the most detailed level printed
+   */
+  static void setLevel(LogModule module, LogLevel level);
+
+  /**
+   * \brief Set the level of all modules
+   *
+   * \param[in] level the most detailed level printed
+   */
+  static void setLevel(LogLevel level);
+
+  /**
+   * \brief Set the levels of all modules from a specification, such as
+   * "warning" or "info,render=debug,model=off", starting from \c Info
+   *
+   * \param[in] spec comma-separated levels, of all modules when not preceded
+   * by a module name
+   */
+  static void configure(std::string const& spec);
+
+  /**
+   * \brief Get the level of a given name
+   *
+   * \param[in] name "off", "error", "warning", "info" or "debug"
+   *
+   * \return the level
+   */
+  static LogLevel getLevelType(std::string const& name);
+
+  /**
+   * \brief Get the module of a given name
+   *
+   * \param[in] name "general", "loader", "model" or "render"
+   *
+   * \return the module
+   */
+  static LogModule getModuleType(std::string const& name);
+
+  /**
+   * \brief Format and print a message, regardless of the levels
+   *
+   * \param[in] format the fmt format string
+   * \param[in] args the arguments
+   */
+  template <typename FormatT, typename... Args>
+  static void write(FormatT const& format, Args const&... args) {
+    print(fmt::format(format, args...));
+  }
+
+  /**
+   * \brief Print a message followed by a new line, regardless of the levels
+   *
+   * \param[in] message the message
+   */
+  static void print(std::string const& message);
+
+  /**
+   * \brief Count a message dropped by a rate limit
+   */
+  static void addSuppressed() {
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Get the number of messages dropped by rate limits in this run
+   *
+   * \return the number of messages
+   */
+  static uint64_t getNumSuppressed() {
+    return suppressed_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Get the run that rate limits count messages for
+   *
+   * \return the run number
+   */
+  static uint64_t getRun() { return run_.load(std::memory_order_relaxed); }
+
+  /**
+   * \brief End a run: print the number of messages dropped by rate limits,
+   * then reset the rate limits
+   */
+  static void finish();
+
+private:
+  static std::array<std::atomic<LogLevel>, 4> levels_;
+  static std::atomic<uint64_t> suppressed_;
+  static std::atomic<uint64_t> run_;
+};
+
+/**
+ * \struct LogLimit
+ *
+ * \brief Limits the number of messages printed from a call site in a run
+ */
+struct LogLimit {
+  /**
+   * \brief Construct the limit
+   *
+   * \param[in] in_max the number of messages printed per run
+   */
+  explicit LogLimit(uint64_t in_max) : max_(in_max) { }
+
+  /**
+   * \brief Count a message
+   *
+   * \return whether the message is printed
+   */
+  bool allow() {
+    // A stale count is only reset approximately by concurrent callers
+    auto const run = Log::getRun();
+    if (run_.load(std::memory_order_relaxed) != run) {
+      run_.store(run, std::memory_order_relaxed);
+      count_.store(0, std::memory_order_relaxed);
+    }
+    if (count_.fetch_add(1, std::memory_order_relaxed) < max_) {
+      return true;
+    }
+    Log::addSuppressed();
+    return false;
+  }
+
+private:
+  uint64_t const max_ = 0;
+  std::atomic<uint64_t> count_ = 0;
+  std::atomic<uint64_t> run_ = 0;
+};
+
+} /* end namespace vt::tv::utility */
+
+/**
+ * \brief Print a message of a module and level, such as
+ * \c VT_TV_LOG(Render, Debug, "Mesh of phase {}", phase)
+ */
+#define VT_TV_LOG(module, level, ...)                                        \
+  do {                                                                       \
+    if (::vt::tv::utility::Log::isEnabled(                                   \
+          ::vt::tv::utility::LogModule::module,                              \
+          ::vt::tv::utility::LogLevel::level)) {                             \
+      ::vt::tv::utility::Log::write(__VA_ARGS__);                            \
+    }                                                                        \
+  } while (0)
+
+/**
+ * \brief Print at most \c max messages of a module and level from this call
+ * site in a run, the others being counted by \c Log::finish
+ */
+#define VT_TV_LOG_LIMITED(module, level, max, ...)                           \
+  do {                                                                       \
+    if (::vt::tv::utility::Log::isEnabled(                                   \
+          ::vt::tv::utility::LogModule::module,                              \
+          ::vt::tv::utility::LogLevel::level)) {                             \
+      static ::vt::tv::utility::LogLimit vt_tv_log_limit(max);               \
+      if (vt_tv_log_limit.allow()) {                                         \
+        ::vt::tv::utility::Log::write(__VA_ARGS__);                          \
+      }                                                                      \
+    }                                                                        \
+  } while (0)
+
+#endif /*INCLUDED_VT_TV_UTILITY_LOG_H*/
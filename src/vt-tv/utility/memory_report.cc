@@ -0,0 +1,333 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               memory_report.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/memory_report.h"
+
+#include <fmt-vt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace vt::tv::utility {
+
+namespace {
+
+constexpr uint64_t word = sizeof(void*);
+
+/// The bytes taken by an allocation: glibc malloc adds a word of header to
+/// every chunk and rounds it up to 16 bytes, with 32 bytes at least
+uint64_t allocated(uint64_t n) {
+  if (n == 0) {
+    return 0;
+  }
+  return std::max<uint64_t>(4 * word, (n + word + 15) & ~uint64_t{15});
+}
+
+/// Strings of up to 15 characters are stored inline
+uint64_t heapBytes(std::string const& s) {
+  return s.capacity() > 15 ? allocated(s.capacity() + 1) : 0;
+}
+
+uint64_t heapBytes(QOIVariantTypes const& v) {
+  auto const* s = std::get_if<std::string>(&v);
+  return s != nullptr ? heapBytes(*s) : 0;
+}
+
+template <typename T>
+uint64_t heapBytes(std::vector<T> const& v) {
+  return allocated(v.capacity() * sizeof(T));
+}
+
+/// A hash node holds the next link and the value, preceded by the hash code
+/// unless the key is an integer; a single bucket is stored inline
+template <typename MapT>
+uint64_t hashMapBytes(MapT const& m) {
+  using KeyType = typename MapT::key_type;
+  uint64_t const node = word + sizeof(typename MapT::value_type) +
+    (std::is_integral_v<KeyType> ? 0 : sizeof(std::size_t));
+  uint64_t const buckets =
+    m.bucket_count() > 1 ? allocated(m.bucket_count() * word) : 0;
+  return m.size() * allocated(node) + buckets;
+}
+
+/// A tree node holds the color and three links, then the value
+template <typename MapT>
+uint64_t treeMapBytes(MapT const& m) {
+  return m.size() * allocated(4 * word + sizeof(typename MapT::value_type));
+}
+
+uint64_t qoiMapBytes(
+  std::unordered_map<std::string, QOIVariantTypes> const& m) {
+  uint64_t bytes = hashMapBytes(m);
+  for (auto const& [key, value] : m) {
+    bytes += heapBytes(key) + heapBytes(value);
+  }
+  return bytes;
+}
+
+/// Read a field of the status of the process, given in kB
+uint64_t readProcStatus(std::string const& field) {
+  std::ifstream is("/proc/self/status");
+  std::string line;
+  while (std::getline(is, line)) {
+    if (line.compare(0, field.size(), field) == 0) {
+      return std::stoull(line.substr(field.size())) * 1024;
+    }
+  }
+  return 0;
+}
+
+double toMiB(uint64_t bytes) {
+  return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} /* end anonymous namespace */
+
+/*static*/ MemoryReport& MemoryReport::get() {
+  static MemoryReport report;
+  return report;
+}
+
+void MemoryReport::enable() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  model_.clear();
+  buffers_.clear();
+  stages_.clear();
+  enabled_ = true;
+}
+
+/*static*/ std::vector<MemoryCategory>
+MemoryReport::estimate(Info const& info) {
+  MemoryCategory objects{"object_info"};
+  MemoryCategory ranks{"ranks"};
+  MemoryCategory phases{"phase_work"};
+  MemoryCategory works{"object_work"};
+  MemoryCategory qois{"object_qoi"};
+  MemoryCategory comms{"communications"};
+
+  auto const& object_info = info.getObjectInfo();
+  objects.count = object_info.size();
+  objects.bytes = hashMapBytes(object_info);
+  for (auto const& [id, obj_info] : object_info) {
+    objects.bytes += heapBytes(obj_info.getIndexArray());
+  }
+
+  // Phases and LB iterations hold their objects' work alike
+  auto addWork = [&](WorkDistribution const& work) {
+    auto const& object_work = work.getObjectWork();
+    phases.bytes += qoiMapBytes(work.getUserDefined());
+    works.count += object_work.size();
+    works.bytes += hashMapBytes(object_work);
+    for (auto const& [id, obj_work] : object_work) {
+      auto const& user_defined = obj_work.getUserDefined();
+      auto const& attributes = obj_work.getAttributes();
+      works.bytes += hashMapBytes(obj_work.getSubphaseLoads());
+      qois.count += user_defined.size() + attributes.size();
+      qois.bytes += qoiMapBytes(user_defined) + qoiMapBytes(attributes);
+      comms.count += obj_work.getSent().size() + obj_work.getReceived().size();
+      comms.bytes +=
+        treeMapBytes(obj_work.getSent()) + treeMapBytes(obj_work.getReceived());
+      // Message counts are kept per peer, besides the communication records
+      comms.bytes += treeMapBytes(obj_work.getSentMessages()) +
+        treeMapBytes(obj_work.getReceivedMessages());
+    }
+  };
+
+  auto const& all_ranks = info.getRanks();
+  ranks.count = all_ranks.size();
+  ranks.bytes = hashMapBytes(all_ranks);
+  for (auto const& [rank_id, rank] : all_ranks) {
+    auto const& phase_work = rank.getPhaseWork();
+    ranks.bytes += qoiMapBytes(rank.getAttributes());
+    phases.count += phase_work.size();
+    phases.bytes += hashMapBytes(phase_work);
+    for (auto const& [phase, pw] : phase_work) {
+      auto const& lb_iters = pw.getLBIterations();
+      addWork(pw);
+      phases.count += lb_iters.size();
+      phases.bytes += treeMapBytes(lb_iters);
+      for (auto const& [lb_iter_id, lb_iter] : lb_iters) {
+        addWork(lb_iter);
+      }
+    }
+  }
+
+  return {objects, ranks, phases, works, qois, comms};
+}
+
+void MemoryReport::addModel(Info const& info) {
+  if (not isEnabled()) {
+    return;
+  }
+  auto model = estimate(info);
+  std::lock_guard<std::mutex> lock(mutex_);
+  model_ = std::move(model);
+}
+
+void MemoryReport::addBuffer(std::string const& name, uint64_t bytes) {
+  if (not isEnabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto buffer = std::find_if(
+    buffers_.begin(), buffers_.end(),
+    [&](auto const& b) { return b.name == name; });
+  if (buffer == buffers_.end()) {
+    buffer = buffers_.insert(buffers_.end(), MemoryCategory{name});
+  }
+  buffer->count++;
+  buffer->bytes = std::max(buffer->bytes, bytes);
+}
+
+void MemoryReport::addStage(std::string const& name, bool stage_peak) {
+  StageMemory stage{name, getCurrentRSS(), getPeakRSS(), stage_peak};
+  std::lock_guard<std::mutex> lock(mutex_);
+  stages_.push_back(std::move(stage));
+}
+
+std::vector<MemoryCategory> MemoryReport::getModel() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return model_;
+}
+
+std::vector<MemoryCategory> MemoryReport::getBuffers() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return buffers_;
+}
+
+std::vector<StageMemory> MemoryReport::getStages() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stages_;
+}
+
+void MemoryReport::write(std::ostream& os) const {
+  auto writeCategories = [&](
+    std::string const& title, std::vector<MemoryCategory> const& categories,
+    bool with_total) {
+    os << fmt::format(
+      "{:<24} {:>12} {:>16} {:>12}\n", title, "count", "bytes", "MiB");
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    for (auto const& c : categories) {
+      os << fmt::format(
+        "{:<24} {:>12} {:>16} {:>12.3f}\n", c.name, c.count, c.bytes,
+        toMiB(c.bytes));
+      count += c.count;
+      bytes += c.bytes;
+    }
+    if (with_total) {
+      os << fmt::format(
+        "{:<24} {:>12} {:>16} {:>12.3f}\n", "total", count, bytes,
+        toMiB(bytes));
+    }
+  };
+
+  auto const model = getModel();
+  auto const buffers = getBuffers();
+  auto const stages = getStages();
+  if (not model.empty()) {
+    writeCategories("model", model, true);
+  }
+  if (not buffers.empty()) {
+    writeCategories("largest buffer", buffers, false);
+  }
+  if (not stages.empty()) {
+    os << fmt::format("{:<24} {:>12} {:>12}\n", "stage", "RSS MiB", "peak MiB");
+    for (auto const& s : stages) {
+      // The peak of the process so far is marked when it cannot be reset
+      os << fmt::format(
+        "{:<24} {:>12.3f} {:>12.3f}{}\n", s.name, toMiB(s.rss_bytes),
+        toMiB(s.peak_bytes), s.stage_peak ? "" : " *");
+    }
+  }
+}
+
+void MemoryReport::finish() {
+  if (not enabled_.exchange(false)) {
+    return;
+  }
+  std::cout << "== Memory report\n";
+  write(std::cout);
+  std::cout << std::flush;
+}
+
+/*static*/ uint64_t MemoryReport::getCurrentRSS() {
+  return readProcStatus("VmRSS:");
+}
+
+/*static*/ uint64_t MemoryReport::getPeakRSS() {
+  if (auto const peak = readProcStatus("VmHWM:"); peak > 0) {
+    return peak;
+  }
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  return 0;
+}
+
+/*static*/ bool MemoryReport::resetPeakRSS() {
+#if defined(__linux__)
+  // Writing 5 resets the peak to the current resident set size (Linux 4.0)
+  std::ofstream os("/proc/self/clear_refs");
+  os << "5";
+  os.close();
+  return not os.fail();
+#else
+  return false;
+#endif
+}
+
+} /* end namespace vt::tv::utility */
@@ -0,0 +1,250 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               memory_report.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_MEMORY_REPORT_H
+#define INCLUDED_VT_TV_UTILITY_MEMORY_REPORT_H
+
+#include "vt-tv/api/info.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct MemoryCategory
+ *
+ * \brief The estimated bytes held by a part of the data model, or the largest
+ * frame buffer of a kind
+ */
+struct MemoryCategory {
+  std::string name;   /**< The category name */
+  uint64_t count = 0; /**< The number of elements or buffers */
+  uint64_t bytes = 0; /**< Estimated bytes, or the largest buffer */
+};
+
+/**
+ * \struct StageMemory
+ *
+ * \brief The resident set size of the process over a stage of a run
+ */
+struct StageMemory {
+  std::string name;        /**< The stage name */
+  uint64_t rss_bytes = 0;  /**< Resident set size at the end of the stage */
+  uint64_t peak_bytes = 0; /**< Peak resident set size */
+  /** Whether the peak is that of the stage, or only of the process so far */
+  bool stage_peak = false;
+};
+
+/**
+ * \struct MemoryReport
+ *
+ * \brief Accounts for the memory of a run: the bytes held by the data model,
+ * the largest frame buffers and the peak resident set size of each stage
+ *
+ * Model bytes are estimated from the sizes of the containers, assuming the
+ * node layouts of libstdc++ and the chunk sizes of glibc malloc, so that they
+ * can be compared from run to run rather than to the byte. The peak of a stage
+ * is exact on Linux, where it is reset when the stage begins; elsewhere, it is
+ * the peak of the process so far. Like \c Trace, accounting is enabled at
+ * runtime and costs an atomic load while disabled.
+ */
+struct MemoryReport {
+  /**
+   * \brief Get the memory report of the process
+   *
+   * \return the memory report
+   */
+  static MemoryReport& get();
+
+  /**
+   * \brief Start accounting, dropping previous records
+   */
+  void enable();
+
+  /**
+   * \brief Whether memory is accounted for
+   *
+   * \return whether the report is enabled
+   */
+  bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * \brief Estimate the bytes held by the data model, by category
+   *
+   * \param[in] info the data model
+   *
+   * \return the categories, from objects to communications
+   */
+  static std::vector<MemoryCategory> estimate(Info const& info);
+
+  /**
+   * \brief Record the estimate of the data model, when enabled
+   *
+   * \param[in] info the data model
+   */
+  void addModel(Info const& info);
+
+  /**
+   * \brief Record a frame buffer, of which the largest of each kind is kept,
+   * when enabled
+   *
+   * \param[in] name the kind of buffer
+   * \param[in] bytes the size of the buffer
+   */
+  void addBuffer(std::string const& name, uint64_t bytes);
+
+  /**
+   * \brief Record the resident set size at the end of a stage
+   *
+   * \param[in] name the stage name
+   * \param[in] stage_peak whether the peak was reset when the stage began
+   */
+  void addStage(std::string const& name, bool stage_peak);
+
+  /**
+   * \brief Get the estimate of the data model
+   *
+   * \return the model categories
+   */
+  std::vector<MemoryCategory> getModel() const;
+
+  /**
+   * \brief Get the largest frame buffers, in order of first record
+   *
+   * \return the buffer categories
+   */
+  std::vector<MemoryCategory> getBuffers() const;
+
+  /**
+   * \brief Get the stages, in order of completion
+   *
+   * \return the stages
+   */
+  std::vector<StageMemory> getStages() const;
+
+  /**
+   * \brief Write the tables of the model, the buffers and the stages
+   *
+   * \param[in] os the output stream
+   */
+  void write(std::ostream& os) const;
+
+  /**
+   * \brief Stop accounting and print the report, which remains queryable
+   *
+   * Does nothing when the report is disabled.
+   */
+  void finish();
+
+  /**
+   * \brief Get the resident set size of the process
+   *
+   * \return the bytes, or 0 when unknown on this platform
+   */
+  static uint64_t getCurrentRSS();
+
+  /**
+   * \brief Get the peak resident set size of the process
+   *
+   * \return the bytes, or 0 when unknown on this platform
+   */
+  static uint64_t getPeakRSS();
+
+  /**
+   * \brief Reset the peak resident set size to the current one
+   *
+   * \return whether the peak could be reset
+   */
+  static bool resetPeakRSS();
+
+private:
+  std::atomic<bool> enabled_ = false;
+  mutable std::mutex mutex_;
+  std::vector<MemoryCategory> model_;
+  std::vector<MemoryCategory> buffers_;
+  std::vector<StageMemory> stages_;
+};
+
+/**
+ * \struct MemoryStage
+ *
+ * \brief Records the memory of a stage of the report from construction to
+ * destruction
+ *
+ * Stages are not nested, since the peak is reset when each one begins.
+ */
+struct MemoryStage {
+  /**
+   * \brief Start the stage, if the report is enabled
+   *
+   * \param[in] in_name the stage name, which must outlive the stage
+   */
+  explicit MemoryStage(char const* in_name)
+    : name_(MemoryReport::get().isEnabled() ? in_name : nullptr) {
+    if (name_ != nullptr) {
+      stage_peak_ = MemoryReport::resetPeakRSS();
+    }
+  }
+
+  MemoryStage(MemoryStage const&) = delete;
+  MemoryStage& operator=(MemoryStage const&) = delete;
+
+  ~MemoryStage() {
+    if (name_ != nullptr) {
+      MemoryReport::get().addStage(name_, stage_peak_);
+    }
+  }
+
+private:
+  char const* name_ = nullptr;
+  bool stage_peak_ = false;
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_MEMORY_REPORT_H*/
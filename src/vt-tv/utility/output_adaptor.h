@@ -48,6 +48,9 @@
 
 #include <nlohmann/json.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace vt::tv::utility {
 
 /**
@@ -63,10 +66,19 @@ struct OutputAdaptor : nlohmann::detail::output_adapter_protocol<CharType> {
    *
    * \param[in] in_os the stream
    * \param[in] compress whether to compress the output
+   * \param[in] quality the brotli quality when compressing
+   * \param[in] window_bits the brotli window bits when compressing
    */
-  OutputAdaptor(StreamLike& in_os, bool compress)
-    : c_((compress ? std::make_unique<compress::Compressor>(8, 20) : nullptr)),
-      os_(in_os) { }
+  OutputAdaptor(
+    StreamLike& in_os, bool compress, int quality = 8, int window_bits = 20)
+    : c_(
+        compress ? std::make_unique<Compressor>(quality, window_bits)
+                 : nullptr),
+      os_(in_os) {
+    if (c_) {
+      buf_.reserve(buf_capacity);
+    }
+  }
 
   /**
    * \brief Write a single character to the output
@@ -83,7 +95,16 @@ struct OutputAdaptor : nlohmann::detail::output_adapter_protocol<CharType> {
    */
   void write_characters(CharType const* s, std::size_t length) override {
     if (c_) {
-      c_->write(os_, reinterpret_cast<uint8_t const*>(s), length);
+      // Stage small writes: brotli compresses every write it is handed, and
+      // does it poorly for the single characters of the JSON serializer
+      if (buf_.size() + length > buf_capacity) {
+        flush();
+      }
+      if (length >= buf_capacity) {
+        c_->write(os_, reinterpret_cast<uint8_t const*>(s), length);
+      } else {
+        buf_.insert(buf_.end(), s, s + length);
+      }
     } else {
       os_.write(s, length);
     }
@@ -94,13 +115,28 @@ struct OutputAdaptor : nlohmann::detail::output_adapter_protocol<CharType> {
    */
   virtual ~OutputAdaptor() {
     if (c_) {
+      flush();
       c_->finish(os_);
     }
   }
 
 private:
+  /**
+   * \brief Compress the staged characters
+   */
+  void flush() {
+    if (not buf_.empty()) {
+      c_->write(
+        os_, reinterpret_cast<uint8_t const*>(buf_.data()), buf_.size());
+      buf_.clear();
+    }
+  }
+
+  static constexpr std::size_t buf_capacity = 1 << 16;
+
   std::unique_ptr<Compressor> c_ = nullptr; /**< The compressor */
   StreamLike& os_;                          /**< The output stream */
+  std::vector<CharType> buf_;               /**< The staged characters */
 };
 
 } /* end namespace vt::tv::utility */
@@ -0,0 +1,89 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                parallel_for.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_PARALLEL_FOR_H
+#define INCLUDED_VT_TV_UTILITY_PARALLEL_FOR_H
+
+#include <cstdint>
+#include <exception>
+
+namespace vt::tv::utility {
+
+/**
+ * \brief Call a function for every index in [0, n), concurrently when OpenMP
+ * is enabled
+ *
+ * Exceptions cannot leave an OpenMP region: the first one thrown by any
+ * iteration is captured and rethrown once all iterations are done.
+ *
+ * \param[in] n the number of indices
+ * \param[in] fn the function called with each index
+ */
+template <typename Callable>
+void parallelFor(uint64_t n, Callable&& fn) {
+  std::exception_ptr error = nullptr;
+#if VT_TV_OPENMP_ENABLED
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int64_t i = 0; i < static_cast<int64_t>(n); i++) {
+    try {
+      fn(static_cast<uint64_t>(i));
+    } catch (...) {
+#if VT_TV_OPENMP_ENABLED
+#pragma omp critical
+#endif
+      {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_PARALLEL_FOR_H*/
@@ -42,12 +42,16 @@
 */
 
 #include "vt-tv/utility/parse_render.h"
-#include "vt-tv/utility/json_reader.h"
+#include "vt-tv/utility/analytics.h"
+#include "vt-tv/utility/info_loader.h"
+#include "vt-tv/utility/log.h"
+#include "vt-tv/utility/memory_report.h"
+#include "vt-tv/utility/trace.h"
 #include "vt-tv/render/render.h"
 #include "vt-tv/api/info.h"
 
 #include <filesystem>
-#include <regex>
+#include <optional>
 
 namespace vt::tv::utility {
 
@@ -56,104 +60,32 @@ void ParseRender::parseAndRender(
   try {
     // Load the yaml file
     YAML::Node config = YAML::LoadFile(filename_);
-
-    if (info == nullptr) {
-      std::string input_dir = config["input"]["directory"].as<std::string>();
-      std::string data_file_stem = config["input"]["file_stem"].as<std::string>("data");
-      std::filesystem::path input_path(input_dir);
-
-      // If it's a relative path, prepend the SRC_DIR
-      if (input_path.is_relative()) {
-        input_path = std::filesystem::path(SRC_DIR) / input_path;
-      }
-      input_dir = input_path.string();
-
-      // append / to avoid problems with file stems
-      if (!input_dir.empty() && input_dir.back() != '/') {
-        input_dir += '/';
-      }
-
-      // Read JSON file and input data
-      std::filesystem::path p = input_dir;
-      std::string path = std::filesystem::absolute(p).string();
-
-      // Collect all file paths into a vector
-      std::vector<std::filesystem::path> data_files;
-      std::regex pattern(data_file_stem + R"(\.\d+\.json(\.br)?)");
-
-      for (const auto& entry : std::filesystem::directory_iterator(input_dir)) {
-        if (entry.is_regular_file()) {
-          const std::string filename = entry.path().filename().string();
-          if (std::regex_match(filename, pattern)) {
-            data_files.push_back(entry.path());
-          }
-        }
-      }
-
-      std::size_t n_ranks = config["input"]["n_ranks"].as<std::size_t>();
-      std::size_t x_ranks = config["viz"]["x_ranks"].as<std::size_t>();
-      std::size_t y_ranks = config["viz"]["y_ranks"].as<std::size_t>();
-      std::size_t z_ranks = config["viz"]["z_ranks"].as<std::size_t>(1);
-
-      std::size_t expected_ranks = x_ranks * y_ranks * z_ranks;
-
-      // Validate the number of files matches n_ranks and expected_ranks
-      if (data_files.size() != n_ranks) {
-        throw std::runtime_error(
-          "Number of data files (" + std::to_string(data_files.size()) +
-          ") does not match the specified n_ranks (" + std::to_string(n_ranks) + ").");
-      }
-
-      if (n_ranks != expected_ranks) {
-        throw std::runtime_error(
-          "n_ranks (" + std::to_string(n_ranks) + ") does not match the product of x_ranks, y_ranks, and z_ranks (" +
-          std::to_string(expected_ranks) + ").");
-      }
-
-      info = std::make_unique<Info>();
-
-#if VT_TV_OPENMP_ENABLED
-      const int threads = VT_TV_N_THREADS;
-      omp_set_num_threads(threads);
-      fmt::print("vt-tv: Using {} threads\n", threads);
-#pragma omp parallel for
-#endif // VT_TV_OPENMP_ENABLED
-
-      for (uint64_t i = 0; i < data_files.size(); i++) {
-        auto filepath = data_files[i].string();
-        auto filename = data_files[i].filename().string();
-
-        int64_t rank;
-        auto first_dot = filename.find(".");
-        auto next_dot = filename.find(".", first_dot + 1);
-
-        rank =
-          std::stoll(filename.substr(first_dot + 1, next_dot - first_dot - 1));
-
-        fmt::print("Reading file for rank {}\n", rank);
-        utility::JSONReader reader{static_cast<NodeType>(rank)};
-
-        // Validate the JSON data file
-        if (reader.validate_datafile(filepath)) {
-          reader.readFile(filepath);
-          auto tmpInfo = reader.parse();
-
-#if VT_TV_OPENMP_ENABLED
-#pragma omp critical
-#endif
-        { info->addInfo(tmpInfo->getObjectInfo(), tmpInfo->getRank(rank)); }
-
-        } else {
-          throw std::runtime_error("JSON data file is invalid: " + filepath);
-        }
-      }
-
-      if (info->getNumRanks() != n_ranks) {
-        throw std::runtime_error("Number of ranks does not match expected value.");
+    Log::configure(config["output"]["log_level"].as<std::string>("info"));
+
+    // Stages are traced when a trace file is requested, from loading on
+    if (config["output"]["trace_file"]) {
+      std::filesystem::path trace_file(
+        config["output"]["trace_file"].as<std::string>());
+      if (trace_file.is_relative()) {
+        trace_file = InfoLoader::resolveDirectory(
+          config["output"]["directory"].as<std::string>("output")) /
+          trace_file;
       }
+      std::filesystem::create_directories(trace_file.parent_path());
+      Trace::get().enable(trace_file.string());
+    }
+    if (config["output"]["memory_report"].as<bool>(false)) {
+      MemoryReport::get().enable();
+    }
 
-      fmt::print("Num ranks={}\n", info->getNumRanks());
+    if (info == nullptr) {
+      TraceSpan span("load_info");
+      MemoryStage stage("load_info");
+      info = InfoLoader::loadFromConfig(config, phase_id);
+    } else {
+      InfoLoader::selectPhase(*info, phase_id);
     }
+    MemoryReport::get().addModel(*info);
 
     std::array<std::string, 3> qoi_request = {
       config["viz"]["rank_qoi"].as<std::string>("load"),
@@ -161,7 +93,12 @@ void ParseRender::parseAndRender(
       config["viz"]["object_qoi"].as<std::string>("load")};
 
     bool save_meshes = config["viz"]["save_meshes"].as<bool>(true);
+    bool save_rank_communication =
+      config["viz"]["save_rank_communication"].as<bool>(false);
+    bool save_migrations =
+      config["viz"]["save_migration_mesh"].as<bool>(false);
     bool save_pngs = config["viz"]["save_pngs"].as<bool>(true);
+    bool save_exodus = config["viz"]["save_exodus"].as<bool>(false);
     bool continuous_object_qoi =
       config["viz"]["force_continuous_object_qoi"].as<bool>(true);
 
@@ -172,28 +109,42 @@ void ParseRender::parseAndRender(
 
     double object_jitter = config["viz"]["object_jitter"].as<double>(0.5);
 
+    EdgeSelection edge_selection;
+    edge_selection.top_k = config["viz"]["edge_top_k"].as<uint64_t>(0);
+    edge_selection.min_volume =
+      config["viz"]["edge_min_bytes"].as<double>(0.0);
+    edge_selection.inter_rank_only =
+      config["viz"]["edge_inter_rank_only"].as<bool>(false);
+
     std::string output_dir;
-    std::filesystem::path output_path;
     std::string output_file_stem;
     uint64_t win_size = 2000;
     // Use automatic font size if not defined by user
     // 0.025 is the factor of the window size determined to be ideal for the font size
     uint64_t font_size = 0.025 * win_size;
-
-    if (save_meshes || save_pngs) {
-      output_dir = config["output"]["directory"].as<std::string>("output");
-      output_path = output_dir;
-
-      // If it's a relative path, prepend the SRC_DIR
-      if (output_path.is_relative()) {
-        output_path = std::filesystem::path(SRC_DIR) / output_path;
-      }
-      output_dir = output_path.string();
-
-      // append / to avoid problems with file stems
-      if (!output_dir.empty() && output_dir.back() != '/') {
-        output_dir += '/';
-      }
+    std::string renderer = "vtk";
+    std::string png_encoder = "vtk";
+    int png_compression_level = 2;
+    uint64_t writer_threads = 1;
+    uint64_t writer_queue_size = 4;
+    std::string vtp_encoding = "base64";
+    std::string vtp_compressor = "zlib";
+    int vtp_compression_level = 5;
+    std::string mesh_collection = "none";
+    std::string animation = "none";
+    uint32_t animation_fps = 10;
+    uint64_t lod_tile_size = 1;
+
+    // Analytics are computed from the data alone: when no mesh or image is
+    // requested, no renderer is built
+    auto const analytics_format = Analytics::getFormat(
+      config["output"]["analytics"].as<std::string>("none"));
+    bool const write_analytics = analytics_format != AnalyticsFormat::None;
+    bool const render_output = save_meshes || save_pngs || save_exodus;
+
+    if (render_output || write_analytics) {
+      output_dir = InfoLoader::resolveDirectory(
+        config["output"]["directory"].as<std::string>("output"));
 
       output_file_stem = config["output"]["file_stem"].as<std::string>("vttv");
 
@@ -206,16 +157,57 @@ void ParseRender::parseAndRender(
       if (config["output"]["font_size"]) {
         font_size = config["output"]["font_size"].as<uint64_t>();
       }
+
+      renderer = config["output"]["renderer"].as<std::string>("vtk");
+      png_encoder = config["output"]["png_encoder"].as<std::string>("vtk");
+      png_compression_level =
+        config["output"]["png_compression_level"].as<int>(2);
+      writer_threads = config["output"]["writer_threads"].as<uint64_t>(1);
+      writer_queue_size =
+        config["output"]["writer_queue_size"].as<uint64_t>(4);
+      vtp_encoding = config["output"]["vtp_encoding"].as<std::string>("base64");
+      vtp_compressor =
+        config["output"]["vtp_compressor"].as<std::string>("zlib");
+      vtp_compression_level =
+        config["output"]["vtp_compression_level"].as<int>(5);
+      mesh_collection =
+        config["output"]["mesh_collection"].as<std::string>("none");
+      animation = config["output"]["animation"].as<std::string>("none");
+      animation_fps = config["output"]["animation_fps"].as<uint32_t>(10);
+      lod_tile_size = config["output"]["lod_tile_size"].as<uint64_t>(1);
     } else {
-      fmt::print("Warning: save_pngs and save_meshes are both False "
-                 "(no visualization will be generated).\n");
+      VT_TV_LOG(
+        General, Warning,
+        "Warning: save_pngs, save_meshes and save_exodus are all False and no "
+        "analytics are requested (nothing will be generated).");
+    }
+
+    if (write_analytics) {
+      std::string const analytics_file = output_dir + output_file_stem +
+        "_analytics" + Analytics::getExtension(analytics_format);
+      TraceSpan span("analytics");
+      MemoryStage stage("analytics");
+      Analytics analytics(*info, phase_id);
+      analytics.write(analytics_file, analytics_format);
+      VT_TV_LOG(
+        General, Info, "== Wrote statistics of {} frames to {}",
+        analytics.getFrames().size(), analytics_file);
     }
 
-    // Instantiate render
+    if (!render_output) {
+      Trace::get().finish();
+      MemoryReport::get().finish();
+      Log::finish();
+      return;
+    }
+
+    // Instantiate render, which takes over the data and computes the ranges
+    std::optional<TraceSpan> setup_span(std::in_place, "render_setup");
+    std::optional<MemoryStage> setup_stage(std::in_place, "render_setup");
     Render r(
       qoi_request,
       continuous_object_qoi,
-      *std::move(info),
+      std::move(info),
       grid_size,
       object_jitter,
       output_dir,
@@ -224,15 +216,35 @@ void ParseRender::parseAndRender(
       save_meshes,
       save_pngs,
       phase_id);
-
-    if (save_meshes || save_pngs) {
-      r.generate(font_size, win_size);
-    }
+    r.setEdgeSelection(edge_selection);
+    r.setRendererType(Render::getRendererType(renderer));
+    r.setPNGEncoder(
+      Render::getPNGEncoderType(png_encoder), png_compression_level);
+    r.setAsyncWriters(writer_threads, writer_queue_size);
+    r.setVTPOutput(
+      Render::getVTPEncodingType(vtp_encoding),
+      Render::getVTPCompressorType(vtp_compressor),
+      vtp_compression_level);
+    r.setMeshCollection(Render::getMeshCollectionType(mesh_collection));
+    r.setSaveRankCommunication(save_rank_communication);
+    r.setSaveMigrations(save_migrations);
+    r.setSaveExodus(save_exodus);
+    r.setLODTileSize(lod_tile_size);
+    r.setAnimation(Render::getAnimationFormat(animation), animation_fps);
+    setup_span.reset();
+    setup_stage.reset();
+    MemoryStage stage("generate");
+    r.generate(font_size, win_size);
 
   } catch (std::exception const& e) {
-    std::cout << "Error reading the configuration file: " << e.what()
-              << std::endl;
+    VT_TV_LOG(
+      General, Error, "Error reading the configuration file: {}", e.what());
   }
+
+  // Stages run so far are reported even when the run failed
+  Trace::get().finish();
+  MemoryReport::get().finish();
+  Log::finish();
 }
 
 
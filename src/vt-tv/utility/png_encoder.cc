@@ -0,0 +1,399 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                png_encoder.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/png_encoder.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <stdexcept>
+
+namespace vt::tv::utility {
+
+namespace {
+
+/// Size of the LZ77 sliding window allowed by deflate
+constexpr std::size_t lz_window_size = 32768;
+/// Number of bits of the LZ77 hash table index
+constexpr uint32_t lz_hash_bits = 15;
+/// Minimum and maximum match lengths allowed by deflate
+constexpr std::size_t lz_min_match = 3;
+constexpr std::size_t lz_max_match = 258;
+
+/// Base lengths and extra bits for length symbols 257 to 285
+constexpr std::array<uint16_t, 29> length_base = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+  31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+constexpr std::array<uint8_t, 29> length_extra = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+  2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+/// Base distances and extra bits for distance symbols 0 to 29
+constexpr std::array<uint16_t, 30> dist_base = {
+  1,   2,   3,   4,   5,   7,    9,    13,   17,   25,
+  33,  49,  65,  97,  129, 193,  257,  385,  513,  769,
+  1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+constexpr std::array<uint8_t, 30> dist_extra = {
+  0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+  6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+/// Maximum hash chain length searched for each compression level
+constexpr std::array<uint32_t, 10> max_chain_per_level = {
+  0, 4, 8, 16, 32, 64, 128, 256, 1024, 4096};
+
+/**
+ * \internal \struct BitWriter
+ *
+ * \brief Least-significant-bit first writer for the deflate bit stream
+ */
+struct BitWriter {
+  explicit BitWriter(std::vector<uint8_t>& in_out) : out_(in_out) { }
+
+  void put(uint32_t bits, uint32_t n) {
+    buf_ |= bits << count_;
+    count_ += n;
+    while (count_ >= 8) {
+      out_.push_back(static_cast<uint8_t>(buf_ & 0xFF));
+      buf_ >>= 8;
+      count_ -= 8;
+    }
+  }
+
+  void putHuffman(uint32_t code, uint32_t n) {
+    // Huffman codes are packed starting with their most significant bit
+    uint32_t reversed = 0;
+    for (uint32_t i = 0; i < n; i++) {
+      reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    put(reversed, n);
+  }
+
+  void flush() {
+    if (count_ > 0) {
+      out_.push_back(static_cast<uint8_t>(buf_ & 0xFF));
+      buf_ = 0;
+      count_ = 0;
+    }
+  }
+
+private:
+  std::vector<uint8_t>& out_;
+  uint32_t buf_ = 0;
+  uint32_t count_ = 0;
+};
+
+void putLiteral(BitWriter& bw, uint32_t sym) {
+  if (sym < 144) {
+    bw.putHuffman(0x30 + sym, 8);
+  } else if (sym < 256) {
+    bw.putHuffman(0x190 + sym - 144, 9);
+  } else if (sym < 280) {
+    bw.putHuffman(sym - 256, 7);
+  } else {
+    bw.putHuffman(0xC0 + sym - 280, 8);
+  }
+}
+
+void putMatch(BitWriter& bw, std::size_t length, std::size_t distance) {
+  auto const l_idx = static_cast<std::size_t>(
+    std::upper_bound(length_base.begin(), length_base.end(), length) -
+    length_base.begin() - 1);
+  putLiteral(bw, static_cast<uint32_t>(257 + l_idx));
+  bw.put(
+    static_cast<uint32_t>(length - length_base[l_idx]), length_extra[l_idx]);
+
+  auto const d_idx = static_cast<std::size_t>(
+    std::upper_bound(dist_base.begin(), dist_base.end(), distance) -
+    dist_base.begin() - 1);
+  bw.putHuffman(static_cast<uint32_t>(d_idx), 5);
+  bw.put(static_cast<uint32_t>(distance - dist_base[d_idx]), dist_extra[d_idx]);
+}
+
+inline uint32_t hashAt(uint8_t const* p) {
+  uint32_t const v = static_cast<uint32_t>(p[0]) |
+    (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16);
+  return (v * 2654435761u) >> (32 - lz_hash_bits);
+}
+
+std::array<uint32_t, 256> const& crcTable() {
+  static std::array<uint32_t, 256> const table = [] {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      t[n] = c;
+    }
+    return t;
+  }();
+  return table;
+}
+
+} /* end anonymous namespace */
+
+PNGEncoder::PNGEncoder(int in_compression_level)
+  : compression_level_(std::clamp(in_compression_level, 0, 9)) { }
+
+/*static*/ uint32_t
+PNGEncoder::crc32(uint8_t const* data, std::size_t size, uint32_t crc) {
+  auto const& table = crcTable();
+  uint32_t c = crc ^ 0xFFFFFFFFu;
+  for (std::size_t i = 0; i < size; i++) {
+    c = table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+  }
+  return c ^ 0xFFFFFFFFu;
+}
+
+/*static*/ uint32_t PNGEncoder::adler32(uint8_t const* data, std::size_t size) {
+  constexpr uint32_t mod_adler = 65521;
+  // 5552 is the largest block for which the sums cannot overflow 32 bits
+  constexpr std::size_t block = 5552;
+  uint32_t a = 1, b = 0;
+  while (size > 0) {
+    std::size_t const n = std::min(size, block);
+    for (std::size_t i = 0; i < n; i++) {
+      a += data[i];
+      b += a;
+    }
+    a %= mod_adler;
+    b %= mod_adler;
+    data += n;
+    size -= n;
+  }
+  return (b << 16) | a;
+}
+
+/*static*/ void PNGEncoder::appendU32(std::vector<uint8_t>& out, uint32_t value) {
+  out.push_back(static_cast<uint8_t>(value >> 24));
+  out.push_back(static_cast<uint8_t>(value >> 16));
+  out.push_back(static_cast<uint8_t>(value >> 8));
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+/*static*/ std::vector<uint8_t> PNGEncoder::signature() {
+  return {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+}
+
+/*static*/ void PNGEncoder::appendChunk(
+  std::vector<uint8_t>& out,
+  char const* type,
+  uint8_t const* data,
+  std::size_t size) {
+  appendU32(out, static_cast<uint32_t>(size));
+  auto const type_start = out.size();
+  out.insert(out.end(), type, type + 4);
+  if (size > 0) {
+    out.insert(out.end(), data, data + size);
+  }
+  appendU32(out, crc32(out.data() + type_start, size + 4));
+}
+
+/*static*/ std::vector<uint8_t>
+PNGEncoder::makeHeader(uint32_t width, uint32_t height, uint8_t channels) {
+  if (channels != 3 && channels != 4) {
+    throw std::runtime_error(
+      "PNG encoder only supports RGB and RGBA images, got " +
+      std::to_string(channels) + " channels.");
+  }
+  std::vector<uint8_t> ihdr;
+  appendU32(ihdr, width);
+  appendU32(ihdr, height);
+  ihdr.push_back(8);                      // bit depth
+  ihdr.push_back(channels == 4 ? 6 : 2);  // color type: RGBA or RGB
+  ihdr.push_back(0);                      // deflate compression
+  ihdr.push_back(0);                      // adaptive filtering
+  ihdr.push_back(0);                      // no interlace
+  return ihdr;
+}
+
+/*static*/ std::vector<uint8_t> PNGEncoder::filterScanlines(
+  uint8_t const* pixels, uint32_t width, uint32_t height, uint8_t channels) {
+  std::size_t const stride = static_cast<std::size_t>(width) * channels;
+  std::vector<uint8_t> raw;
+  raw.reserve((stride + 1) * height);
+  for (uint32_t y = 0; y < height; y++) {
+    // Filter type None: rendered frames are dominated by flat color runs that
+    // LZ77 already matches well
+    raw.push_back(0);
+    auto const row = pixels + y * stride;
+    raw.insert(raw.end(), row, row + stride);
+  }
+  return raw;
+}
+
+/*static*/ void PNGEncoder::deflateStored(
+  std::vector<uint8_t>& out, uint8_t const* data, std::size_t size) {
+  constexpr std::size_t max_block = 65535;
+  std::size_t offset = 0;
+  do {
+    std::size_t const n = std::min(max_block, size - offset);
+    bool const final_block = offset + n == size;
+    out.push_back(final_block ? 1 : 0); // BFINAL + BTYPE=00, byte aligned
+    out.push_back(static_cast<uint8_t>(n & 0xFF));
+    out.push_back(static_cast<uint8_t>(n >> 8));
+    out.push_back(static_cast<uint8_t>(~n & 0xFF));
+    out.push_back(static_cast<uint8_t>((~n >> 8) & 0xFF));
+    out.insert(out.end(), data + offset, data + offset + n);
+    offset += n;
+  } while (offset < size);
+}
+
+void PNGEncoder::deflateFixed(
+  std::vector<uint8_t>& out, uint8_t const* data, std::size_t size) const {
+  BitWriter bw{out};
+  bw.put(1, 1); // BFINAL
+  bw.put(1, 2); // BTYPE=01, fixed Huffman codes
+
+  uint32_t const max_chain = max_chain_per_level[compression_level_];
+  std::vector<int64_t> head(std::size_t{1} << lz_hash_bits, -1);
+  std::vector<int64_t> prev(lz_window_size, -1);
+
+  auto insert = [&](std::size_t pos) {
+    if (pos + lz_min_match <= size) {
+      auto const h = hashAt(data + pos);
+      prev[pos & (lz_window_size - 1)] = head[h];
+      head[h] = static_cast<int64_t>(pos);
+    }
+  };
+
+  std::size_t i = 0;
+  while (i < size) {
+    std::size_t best_len = 0;
+    std::size_t best_dist = 0;
+    if (i + lz_min_match <= size) {
+      std::size_t const max_len = std::min(lz_max_match, size - i);
+      int64_t cand = head[hashAt(data + i)];
+      uint32_t chain = max_chain;
+      while (cand >= 0 && chain-- > 0) {
+        auto const c = static_cast<std::size_t>(cand);
+        if (i - c > lz_window_size) {
+          break;
+        }
+        if (data[c + best_len] == data[i + best_len]) {
+          std::size_t len = 0;
+          while (len < max_len && data[c + len] == data[i + len]) {
+            len++;
+          }
+          if (len > best_len) {
+            best_len = len;
+            best_dist = i - c;
+            if (len == max_len) {
+              break;
+            }
+          }
+        }
+        int64_t const next = prev[c & (lz_window_size - 1)];
+        // Entries overwritten by the ring buffer point forward: stop there
+        if (next >= cand) {
+          break;
+        }
+        cand = next;
+      }
+    }
+
+    if (best_len >= lz_min_match) {
+      putMatch(bw, best_len, best_dist);
+      for (std::size_t k = 0; k < best_len; k++) {
+        insert(i + k);
+      }
+      i += best_len;
+    } else {
+      putLiteral(bw, data[i]);
+      insert(i);
+      i++;
+    }
+  }
+
+  putLiteral(bw, 256); // end of block
+  bw.flush();
+}
+
+std::vector<uint8_t>
+PNGEncoder::compress(uint8_t const* data, std::size_t size) const {
+  std::vector<uint8_t> out;
+  out.reserve(compression_level_ == 0 ? size + size / 65535 * 5 + 16 : size / 4);
+  // zlib header: deflate with a 32K window, check bits for (CMF, FLG)
+  out.push_back(0x78);
+  out.push_back(compression_level_ == 0 ? 0x01 : 0x9C);
+  if (compression_level_ == 0) {
+    deflateStored(out, data, size);
+  } else {
+    deflateFixed(out, data, size);
+  }
+  appendU32(out, adler32(data, size));
+  return out;
+}
+
+std::vector<uint8_t> PNGEncoder::encode(
+  uint8_t const* pixels,
+  uint32_t width,
+  uint32_t height,
+  uint8_t channels) const {
+  auto const ihdr = makeHeader(width, height, channels);
+  auto const raw = filterScanlines(pixels, width, height, channels);
+  auto const idat = compress(raw.data(), raw.size());
+
+  std::vector<uint8_t> png = signature();
+  png.reserve(png.size() + idat.size() + 64);
+  appendChunk(png, "IHDR", ihdr.data(), ihdr.size());
+  appendChunk(png, "IDAT", idat.data(), idat.size());
+  appendChunk(png, "IEND", nullptr, 0);
+  return png;
+}
+
+void PNGEncoder::write(
+  std::string const& filename,
+  uint8_t const* pixels,
+  uint32_t width,
+  uint32_t height,
+  uint8_t channels) const {
+  auto const png = encode(pixels, width, height, channels);
+  std::ofstream os(filename, std::ios::binary);
+  if (!os) {
+    throw std::runtime_error("Could not open PNG file for writing: " + filename);
+  }
+  os.write(reinterpret_cast<char const*>(png.data()), png.size());
+}
+
+} /* end namespace vt::tv::utility */
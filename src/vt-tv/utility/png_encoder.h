@@ -0,0 +1,216 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                png_encoder.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_PNG_ENCODER_H
+#define INCLUDED_VT_TV_UTILITY_PNG_ENCODER_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct PNGEncoder
+ *
+ * \brief A self-contained PNG encoder for 8-bit RGB and RGBA images
+ *
+ * Pixel data is compressed with a built-in deflate implementation (stored
+ * blocks at level 0, fixed Huffman codes with LZ77 matching otherwise) so
+ * that images can be written without going through VTK or zlib.
+ */
+struct PNGEncoder {
+  /**
+   * \brief Construct a PNG encoder
+   *
+   * \param[in] in_compression_level the compression level between 0 and 9
+   */
+  explicit PNGEncoder(int in_compression_level = 2);
+
+  /**
+   * \brief Encode an image into an in-memory PNG file
+   *
+   * \param[in] pixels interleaved pixel data, rows ordered top to bottom
+   * \param[in] width the image width in pixels
+   * \param[in] height the image height in pixels
+   * \param[in] channels the number of channels per pixel (3 or 4)
+   *
+   * \return the PNG file contents
+   */
+  std::vector<uint8_t> encode(
+    uint8_t const* pixels,
+    uint32_t width,
+    uint32_t height,
+    uint8_t channels) const;
+
+  /**
+   * \brief Encode an image and write it to a PNG file
+   *
+   * \param[in] filename the name of the file to write
+   * \param[in] pixels interleaved pixel data, rows ordered top to bottom
+   * \param[in] width the image width in pixels
+   * \param[in] height the image height in pixels
+   * \param[in] channels the number of channels per pixel (3 or 4)
+   */
+  void write(
+    std::string const& filename,
+    uint8_t const* pixels,
+    uint32_t width,
+    uint32_t height,
+    uint8_t channels) const;
+
+  /**
+   * \brief Build the filtered scanlines of an image as stored in IDAT
+   *
+   * \param[in] pixels interleaved pixel data, rows ordered top to bottom
+   * \param[in] width the image width in pixels
+   * \param[in] height the image height in pixels
+   * \param[in] channels the number of channels per pixel (3 or 4)
+   *
+   * \return the raw (uncompressed) image stream
+   */
+  static std::vector<uint8_t> filterScanlines(
+    uint8_t const* pixels, uint32_t width, uint32_t height, uint8_t channels);
+
+  /**
+   * \brief Compress a buffer into a zlib stream
+   *
+   * \param[in] data the buffer to compress
+   * \param[in] size the length of the buffer
+   *
+   * \return the zlib stream
+   */
+  std::vector<uint8_t> compress(uint8_t const* data, std::size_t size) const;
+
+  /**
+   * \brief Append a PNG chunk (length, type, data and CRC) to a buffer
+   *
+   * \param[in] out the buffer to append to
+   * \param[in] type the four-character chunk type
+   * \param[in] data the chunk payload
+   * \param[in] size the length of the payload
+   */
+  static void appendChunk(
+    std::vector<uint8_t>& out,
+    char const* type,
+    uint8_t const* data,
+    std::size_t size);
+
+  /**
+   * \brief Build the IHDR payload for an 8-bit image
+   *
+   * \param[in] width the image width in pixels
+   * \param[in] height the image height in pixels
+   * \param[in] channels the number of channels per pixel (3 or 4)
+   *
+   * \return the 13-byte IHDR payload
+   */
+  static std::vector<uint8_t>
+  makeHeader(uint32_t width, uint32_t height, uint8_t channels);
+
+  /**
+   * \brief Append a 32-bit big-endian integer to a buffer
+   *
+   * \param[in] out the buffer to append to
+   * \param[in] value the value to append
+   */
+  static void appendU32(std::vector<uint8_t>& out, uint32_t value);
+
+  /**
+   * \brief Update a CRC-32 checksum
+   *
+   * \param[in] data the buffer to checksum
+   * \param[in] size the length of the buffer
+   * \param[in] crc the running checksum
+   *
+   * \return the updated checksum
+   */
+  static uint32_t
+  crc32(uint8_t const* data, std::size_t size, uint32_t crc = 0);
+
+  /**
+   * \brief Compute the Adler-32 checksum of a buffer
+   *
+   * \param[in] data the buffer to checksum
+   * \param[in] size the length of the buffer
+   *
+   * \return the checksum
+   */
+  static uint32_t adler32(uint8_t const* data, std::size_t size);
+
+  /**
+   * \brief Get the PNG file signature
+   *
+   * \return the eight signature bytes
+   */
+  static std::vector<uint8_t> signature();
+
+private:
+  /**
+   * \internal \brief Deflate a buffer with stored (uncompressed) blocks
+   *
+   * \param[in] out the buffer to append to
+   * \param[in] data the buffer to deflate
+   * \param[in] size the length of the buffer
+   */
+  static void
+  deflateStored(std::vector<uint8_t>& out, uint8_t const* data, std::size_t size);
+
+  /**
+   * \internal \brief Deflate a buffer with fixed Huffman codes and LZ77
+   *
+   * \param[in] out the buffer to append to
+   * \param[in] data the buffer to deflate
+   * \param[in] size the length of the buffer
+   */
+  void deflateFixed(
+    std::vector<uint8_t>& out, uint8_t const* data, std::size_t size) const;
+
+private:
+  int compression_level_ = 2; /**< The compression level between 0 and 9 */
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_PNG_ENCODER_H*/
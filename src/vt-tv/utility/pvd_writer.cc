@@ -0,0 +1,129 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                pvd_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/pvd_writer.h"
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace vt::tv::utility {
+
+namespace {
+
+/**
+ * \internal \brief Escape a string for use in an XML attribute value
+ */
+std::string escapeAttribute(std::string const& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    switch (c) {
+    case '&':
+      escaped += "&amp;";
+      break;
+    case '<':
+      escaped += "&lt;";
+      break;
+    case '>':
+      escaped += "&gt;";
+      break;
+    case '"':
+      escaped += "&quot;";
+      break;
+    default:
+      escaped += c;
+    }
+  }
+  return escaped;
+}
+
+} /* end anonymous namespace */
+
+PVDWriter::PVDWriter(std::string in_filename)
+  : filename_(std::move(in_filename)) {
+  out_.open(
+    filename_,
+    std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!out_) {
+    throw std::runtime_error(
+      "Cannot open collection file \"" + filename_ + "\" for writing.");
+  }
+  out_ << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"Collection\" version=\"0.1\" "
+       << "byte_order=\"LittleEndian\">\n"
+       << "  <Collection>\n"
+       << footer;
+  out_.flush();
+}
+
+void PVDWriter::addDataSet(
+  double timestep,
+  uint64_t part,
+  std::string const& name,
+  std::string const& file) {
+  std::ostringstream entry;
+  entry.precision(17);
+  entry << "    <DataSet timestep=\"" << timestep << "\" group=\"\" part=\""
+        << part << "\" name=\"" << escapeAttribute(name) << "\" file=\""
+        << escapeAttribute(file) << "\"/>\n";
+
+  // Overwrite the closing tags with the new entry, then restore them
+  std::lock_guard<std::mutex> lock(mutex_);
+  out_.seekp(-static_cast<std::streamoff>(std::strlen(footer)), std::ios::end);
+  out_ << entry.str() << footer;
+  out_.flush();
+  if (!out_) {
+    throw std::runtime_error(
+      "Failed to write collection file \"" + filename_ + "\".");
+  }
+  n_data_sets_++;
+}
+
+uint64_t PVDWriter::getNumDataSets() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return n_data_sets_;
+}
+
+} /* end namespace vt::tv::utility */
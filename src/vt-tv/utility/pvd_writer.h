@@ -0,0 +1,116 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 pvd_writer.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_PVD_WRITER_H
+#define INCLUDED_VT_TV_UTILITY_PVD_WRITER_H
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct PVDWriter
+ *
+ * \brief Maintains a ParaView data (.pvd) collection of time-dependent files
+ *
+ * The collection indexes the files written for each frame by time step and
+ * part, so that readers can load any step from a single entry point. Data
+ * sets are appended as they are added and the file is kept well-formed after
+ * each addition, so that an interrupted run still leaves a valid collection.
+ * Data sets may be added concurrently.
+ */
+struct PVDWriter {
+  /**
+   * \brief Create an empty collection file
+   *
+   * \param[in] in_filename the name of the collection file
+   */
+  explicit PVDWriter(std::string in_filename);
+
+  PVDWriter(PVDWriter const&) = delete;
+  PVDWriter& operator=(PVDWriter const&) = delete;
+
+  /**
+   * \brief Append a data set to the collection
+   *
+   * \param[in] timestep the time step of the data set
+   * \param[in] part the part index of the data set within its time step
+   * \param[in] name the name of the part
+   * \param[in] file the data set file, relative to the collection file
+   */
+  void addDataSet(
+    double timestep,
+    uint64_t part,
+    std::string const& name,
+    std::string const& file);
+
+  /**
+   * \brief Get the number of data sets added so far
+   *
+   * \return the number of data sets
+   */
+  uint64_t getNumDataSets() const;
+
+  /**
+   * \brief Get the name of the collection file
+   *
+   * \return the file name
+   */
+  std::string const& getFilename() const { return filename_; }
+
+private:
+  /// The closing tags, rewritten after each data set
+  static constexpr char const* footer = "  </Collection>\n</VTKFile>\n";
+
+  std::string filename_;     /**< The name of the collection file */
+  std::fstream out_;         /**< The collection file */
+  uint64_t n_data_sets_ = 0; /**< The number of data sets added */
+  mutable std::mutex mutex_; /**< Serializes concurrent additions */
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_PVD_WRITER_H*/
@@ -0,0 +1,282 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               summary_file.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/summary_file.h"
+#include "vt-tv/utility/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace vt::tv::utility {
+
+namespace {
+
+/// The first bytes of a summary file
+constexpr char summary_magic[8] = {'V', 'T', 'T', 'V', 'S', 'U', 'M', '\0'};
+/// The version of the layout, incremented whenever it changes
+constexpr uint32_t summary_version = 1;
+/// Read back in another byte order as another value
+constexpr uint32_t summary_byte_order = 0x01020304;
+
+struct Writer {
+  std::ostream& os;
+
+  template <typename T>
+  void value(T const& v) {
+    static_assert(std::is_arithmetic_v<T>);
+    os.write(reinterpret_cast<char const*>(&v), sizeof(T));
+  }
+
+  void string(std::string const& s) {
+    value<uint64_t>(s.size());
+    os.write(s.data(), static_cast<std::streamsize>(s.size()));
+  }
+
+  void doubles(std::vector<double> const& values) {
+    value<uint64_t>(values.size());
+    os.write(
+      reinterpret_cast<char const*>(values.data()),
+      static_cast<std::streamsize>(values.size() * sizeof(double)));
+  }
+};
+
+struct Reader {
+  std::istream& is;
+  /// Bytes left in the file, which no length read may exceed
+  uint64_t remaining;
+
+  void bytes(char* data, uint64_t n) {
+    if (n > remaining or not is.read(data, static_cast<std::streamsize>(n))) {
+      throw std::runtime_error("truncated summary");
+    }
+    remaining -= n;
+  }
+
+  template <typename T>
+  T value() {
+    static_assert(std::is_arithmetic_v<T>);
+    T v;
+    bytes(reinterpret_cast<char*>(&v), sizeof(T));
+    return v;
+  }
+
+  /// Read a number of entries, each taking at least \c entry_bytes in the
+  /// rest of the file, before anything is allocated for them
+  uint64_t count(uint64_t entry_bytes) {
+    auto const n = value<uint64_t>();
+    if (n > remaining / entry_bytes) {
+      throw std::runtime_error("truncated summary");
+    }
+    return n;
+  }
+
+  std::string string() {
+    auto const n = count(1);
+    std::string s(n, '\0');
+    bytes(s.data(), n);
+    return s;
+  }
+
+  std::vector<double> doubles() {
+    auto const n = count(sizeof(double));
+    std::vector<double> values(n);
+    bytes(reinterpret_cast<char*>(values.data()), n * sizeof(double));
+    return values;
+  }
+};
+
+/// The smallest sizes of the entries of a summary: a stamp holds a string
+/// length, a size and a time; a frame four values and two counts; rank and
+/// object QOIs a key length, then values or a range, a flag and a support
+constexpr uint64_t min_stamp_bytes = 3 * sizeof(uint64_t);
+constexpr uint64_t min_frame_bytes = 6 * sizeof(uint64_t);
+constexpr uint64_t min_rank_qoi_bytes = 2 * sizeof(uint64_t);
+constexpr uint64_t min_object_qoi_bytes = 4 * sizeof(uint64_t) + 1;
+
+} /* end anonymous namespace */
+
+/*static*/ std::string SummaryFile::getPath(
+  std::string const& directory, std::string const& file_stem) {
+  return directory + file_stem + ".summary.bin";
+}
+
+/*static*/ std::vector<DataFileStamp>
+SummaryFile::stamp(std::vector<std::filesystem::path> const& data_files) {
+  std::vector<DataFileStamp> stamps;
+  for (auto const& path : data_files) {
+    stamps.push_back(DataFileStamp{
+      path.filename().string(), std::filesystem::file_size(path),
+      static_cast<int64_t>(
+        std::filesystem::last_write_time(path).time_since_epoch().count())});
+  }
+  std::sort(stamps.begin(), stamps.end(), [](auto const& a, auto const& b) {
+    return a.name < b.name;
+  });
+  return stamps;
+}
+
+/*static*/ void SummaryFile::write(
+  std::string const& filename, PhaseSummary const& summary,
+  std::vector<DataFileStamp> const& stamps) {
+  std::string const tmp_filename = filename + ".tmp";
+  {
+    std::ofstream os(tmp_filename, std::ios::binary);
+    if (!os) {
+      throw std::runtime_error("Cannot open summary file " + tmp_filename);
+    }
+    Writer w{os};
+    os.write(summary_magic, sizeof(summary_magic));
+    w.value(summary_version);
+    w.value(summary_byte_order);
+
+    w.value<uint64_t>(stamps.size());
+    for (auto const& s : stamps) {
+      w.string(s.name);
+      w.value(s.size);
+      w.value(s.mtime);
+    }
+
+    w.value<uint64_t>(summary.n_ranks);
+    w.value<uint64_t>(summary.n_phases);
+    w.value<uint64_t>(summary.frames.size());
+    for (auto const& frame : summary.frames) {
+      w.value<uint64_t>(frame.phase);
+      w.value<uint64_t>(frame.lb_iter);
+      w.value(frame.max_object_load);
+      w.value(frame.max_object_volume);
+      w.value<uint64_t>(frame.rank_qois.size());
+      for (auto const& [key, values] : frame.rank_qois) {
+        w.string(key);
+        w.doubles(values);
+      }
+      w.value<uint64_t>(frame.object_qois.size());
+      for (auto const& [key, range] : frame.object_qois) {
+        w.string(key);
+        w.value(range.min);
+        w.value(range.max);
+        w.value<uint8_t>(range.continuous);
+        w.doubles(
+          std::vector<double>(range.support.begin(), range.support.end()));
+      }
+    }
+    if (!os.flush()) {
+      throw std::runtime_error("Cannot write summary file " + tmp_filename);
+    }
+  }
+  std::filesystem::rename(tmp_filename, filename);
+}
+
+/*static*/ std::shared_ptr<PhaseSummary const> SummaryFile::read(
+  std::string const& filename, std::vector<DataFileStamp> const& stamps) {
+  std::ifstream is(filename, std::ios::binary);
+  if (!is) {
+    return nullptr;
+  }
+
+  try {
+    Reader r{is, std::filesystem::file_size(filename)};
+    char magic[sizeof(summary_magic)];
+    r.bytes(magic, sizeof(magic));
+    if (
+      std::memcmp(magic, summary_magic, sizeof(magic)) != 0 or
+      r.value<uint32_t>() != summary_version or
+      r.value<uint32_t>() != summary_byte_order) {
+      VT_TV_LOG(
+        Loader, Info, "Ignoring summary {} of another version", filename);
+      return nullptr;
+    }
+
+    std::vector<DataFileStamp> file_stamps(r.count(min_stamp_bytes));
+    for (auto& s : file_stamps) {
+      s.name = r.string();
+      s.size = r.value<uint64_t>();
+      s.mtime = r.value<int64_t>();
+    }
+    if (file_stamps != stamps) {
+      VT_TV_LOG(
+        Loader, Info, "Ignoring summary {} of other data files", filename);
+      return nullptr;
+    }
+
+    auto summary = std::make_shared<PhaseSummary>();
+    summary->n_ranks = r.value<uint64_t>();
+    summary->n_phases = r.value<uint64_t>();
+    auto const n_frames = r.count(min_frame_bytes);
+    for (uint64_t f = 0; f < n_frames; f++) {
+      FrameSummary frame;
+      frame.phase = r.value<uint64_t>();
+      frame.lb_iter = r.value<uint64_t>();
+      frame.max_object_load = r.value<double>();
+      frame.max_object_volume = r.value<double>();
+      auto const n_rank_qois = r.count(min_rank_qoi_bytes);
+      for (uint64_t q = 0; q < n_rank_qois; q++) {
+        auto key = r.string();
+        auto values = r.doubles();
+        if (values.size() != summary->n_ranks) {
+          throw std::runtime_error("inconsistent number of ranks");
+        }
+        frame.rank_qois[key] = std::move(values);
+      }
+      auto const n_object_qois = r.count(min_object_qoi_bytes);
+      for (uint64_t q = 0; q < n_object_qois; q++) {
+        auto& range = frame.object_qois[r.string()];
+        range.min = r.value<double>();
+        range.max = r.value<double>();
+        range.continuous = r.value<uint8_t>() != 0;
+        auto const support = r.doubles();
+        range.support.insert(support.begin(), support.end());
+      }
+      summary->frames.push_back(std::move(frame));
+    }
+    return summary;
+  } catch (std::exception const& e) {
+    VT_TV_LOG(Loader, Info, "Ignoring summary {}: {}", filename, e.what());
+    return nullptr;
+  }
+}
+
+} /* end namespace vt::tv::utility */
@@ -0,0 +1,133 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                summary_file.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_SUMMARY_FILE_H
+#define INCLUDED_VT_TV_UTILITY_SUMMARY_FILE_H
+
+#include "vt-tv/api/phase_summary.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct DataFileStamp
+ *
+ * \brief The name, size and modification time of a data file, which tell
+ * whether a summary still describes it
+ */
+struct DataFileStamp {
+  std::string name;  /**< The file name, without directory */
+  uint64_t size = 0; /**< The size in bytes */
+  int64_t mtime = 0; /**< The modification time, in file clock ticks */
+
+  bool operator==(DataFileStamp const& other) const {
+    return name == other.name and size == other.size and mtime == other.mtime;
+  }
+};
+
+/**
+ * \struct SummaryFile
+ *
+ * \brief Binary sidecar of the data files holding the summary of all their
+ * frames, so that ranges and maxima are known without a pass over the data
+ *
+ * The file starts with the stamps of the data files it was computed from: it
+ * is ignored as soon as one of them is modified, added or removed. Values are
+ * stored in the byte order of the host, which is checked when reading.
+ */
+struct SummaryFile {
+  /**
+   * \brief Get the path of the summary of data files
+   *
+   * \param[in] directory the directory of the data files, ending with a
+   * separator
+   * \param[in] file_stem the stem of the data file names
+   *
+   * \return the path of the summary
+   */
+  static std::string
+  getPath(std::string const& directory, std::string const& file_stem);
+
+  /**
+   * \brief Stamp data files
+   *
+   * \param[in] data_files the paths of the data files
+   *
+   * \return the stamps, in order of file names
+   */
+  static std::vector<DataFileStamp>
+  stamp(std::vector<std::filesystem::path> const& data_files);
+
+  /**
+   * \brief Write a summary, replacing the file at once so that concurrent
+   * readers never see a partial file
+   *
+   * \param[in] filename the name of the file
+   * \param[in] summary the summary
+   * \param[in] stamps the stamps of the data files summarized
+   */
+  static void write(
+    std::string const& filename, PhaseSummary const& summary,
+    std::vector<DataFileStamp> const& stamps);
+
+  /**
+   * \brief Read a summary
+   *
+   * \param[in] filename the name of the file
+   * \param[in] stamps the stamps of the current data files
+   *
+   * \return the summary, or \c nullptr when the file is missing, truncated,
+   * of another version or byte order, or computed from other data files
+   */
+  static std::shared_ptr<PhaseSummary const> read(
+    std::string const& filename, std::vector<DataFileStamp> const& stamps);
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_SUMMARY_FILE_H*/
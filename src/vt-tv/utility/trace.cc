@@ -0,0 +1,227 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                   trace.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt-tv/utility/trace.h"
+#include "vt-tv/utility/log.h"
+
+#include <nlohmann/json.hpp>
+#include <fmt-vt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+namespace vt::tv::utility {
+
+/*static*/ Trace& Trace::get() {
+  static Trace trace;
+  return trace;
+}
+
+/*static*/ uint64_t Trace::getThreadID() {
+  static std::atomic<uint64_t> next_id = 0;
+  thread_local uint64_t const id = next_id++;
+  return id;
+}
+
+double Trace::sinceStart(ClockType::time_point t) const {
+  return std::chrono::duration<double, std::micro>(t - start_).count();
+}
+
+void Trace::enable(std::string const& filename) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  filename_ = filename;
+  events_.clear();
+  counters_.clear();
+  start_ = ClockType::now();
+  enabled_ = true;
+}
+
+void Trace::addSpan(
+  std::string name, ClockType::time_point begin, ClockType::time_point end,
+  std::vector<TraceArg> args) {
+  TraceEvent event;
+  event.name = std::move(name);
+  event.thread = getThreadID();
+  event.args = std::move(args);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  event.begin_us = sinceStart(begin);
+  event.duration_us = std::chrono::duration<double, std::micro>(
+    end - begin).count();
+  events_.push_back(std::move(event));
+}
+
+void Trace::count(std::string const& name, double delta) {
+  if (not isEnabled()) {
+    return;
+  }
+  TraceEvent event;
+  event.name = name;
+  event.thread = getThreadID();
+  event.is_counter = true;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto counter = std::find_if(
+    counters_.begin(), counters_.end(),
+    [&](auto const& c) { return c.first == name; });
+  if (counter == counters_.end()) {
+    counter = counters_.insert(counters_.end(), {name, 0.0});
+  }
+  counter->second += delta;
+  event.value = counter->second;
+  event.begin_us = sinceStart(ClockType::now());
+  events_.push_back(std::move(event));
+}
+
+std::vector<TraceEvent> Trace::getEvents() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return events_;
+}
+
+std::vector<TraceSummary> Trace::summarize() const {
+  std::map<std::pair<bool, std::string>, TraceSummary> by_name;
+  for (auto const& event : getEvents()) {
+    auto& s = by_name[{event.is_counter, event.name}];
+    s.name = event.name;
+    s.is_counter = event.is_counter;
+    s.count++;
+    if (event.is_counter) {
+      s.total_ms = event.value;
+    } else {
+      s.total_ms += event.duration_us / 1000.0;
+      s.max_ms = std::max(s.max_ms, event.duration_us / 1000.0);
+    }
+  }
+
+  std::vector<TraceSummary> summaries;
+  for (auto& [key, s] : by_name) {
+    summaries.push_back(std::move(s));
+  }
+  std::stable_sort(
+    summaries.begin(), summaries.end(), [](auto const& a, auto const& b) {
+      if (a.is_counter != b.is_counter) {
+        return b.is_counter;
+      }
+      return not a.is_counter and a.total_ms > b.total_ms;
+    });
+  return summaries;
+}
+
+void Trace::writeChromeJSON(std::ostream& os) const {
+  using json = nlohmann::json;
+
+  json events = json::array();
+  for (auto const& event : getEvents()) {
+    json e = {
+      {"name", event.name},
+      {"cat", "vt-tv"},
+      {"pid", 0},
+      {"tid", event.thread},
+      {"ts", event.begin_us}};
+    if (event.is_counter) {
+      e["ph"] = "C";
+      e["args"] = {{"value", event.value}};
+    } else {
+      e["ph"] = "X";
+      e["dur"] = event.duration_us;
+      e["args"] = json::object();
+      for (auto const& arg : event.args) {
+        e["args"][arg.key] = arg.value;
+      }
+    }
+    events.push_back(std::move(e));
+  }
+
+  json j = {{"traceEvents", std::move(events)}, {"displayTimeUnit", "ms"}};
+  os << j.dump() << '\n';
+}
+
+void Trace::writeSummary(std::ostream& os) const {
+  auto const events = getEvents();
+  double run_ms = 0.0;
+  for (auto const& event : events) {
+    run_ms =
+      std::max(run_ms, (event.begin_us + event.duration_us) / 1000.0);
+  }
+
+  os << fmt::format(
+    "{:<32} {:>8} {:>12} {:>10} {:>10} {:>7}\n", "stage", "count", "total ms",
+    "mean ms", "max ms", "% run");
+  for (auto const& s : summarize()) {
+    if (s.is_counter) {
+      os << fmt::format("{:<32} {:>8} {:>12}\n", s.name, s.count, s.total_ms);
+    } else {
+      os << fmt::format(
+        "{:<32} {:>8} {:>12.3f} {:>10.3f} {:>10.3f} {:>7.1f}\n", s.name,
+        s.count, s.total_ms, s.total_ms / static_cast<double>(s.count),
+        s.max_ms, run_ms > 0.0 ? 100.0 * s.total_ms / run_ms : 0.0);
+    }
+  }
+}
+
+void Trace::finish() {
+  if (not enabled_.exchange(false)) {
+    return;
+  }
+
+  if (not filename_.empty()) {
+    std::ofstream os(filename_);
+    writeChromeJSON(os);
+    if (os.good()) {
+      VT_TV_LOG(
+        General, Info, "== Wrote trace of {} events to {}",
+        getEvents().size(), filename_);
+    } else {
+      VT_TV_LOG(
+        General, Warning, "Warning: could not write the trace to {}",
+        filename_);
+    }
+  }
+
+  writeSummary(std::cout);
+  std::cout << std::flush;
+}
+
+} /* end namespace vt::tv::utility */
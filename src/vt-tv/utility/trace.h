@@ -0,0 +1,258 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                   trace.h
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_TV_UTILITY_TRACE_H
+#define INCLUDED_VT_TV_UTILITY_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace vt::tv::utility {
+
+/**
+ * \struct TraceArg
+ *
+ * \brief A named integer attached to a span, such as a phase or a rank
+ */
+struct TraceArg {
+  char const* key = ""; /**< The name of the argument */
+  int64_t value = 0;    /**< The value of the argument */
+};
+
+/**
+ * \struct TraceEvent
+ *
+ * \brief A recorded span or counter update
+ */
+struct TraceEvent {
+  std::string name;           /**< The span or counter name */
+  uint64_t thread = 0;        /**< The thread that recorded it */
+  double begin_us = 0.0;      /**< Start, in us since tracing was enabled */
+  double duration_us = 0.0;   /**< Duration in us; 0 for counters */
+  double value = 0.0;         /**< Running total of a counter */
+  bool is_counter = false;    /**< Whether this is a counter update */
+  std::vector<TraceArg> args; /**< The arguments of a span */
+};
+
+/**
+ * \struct TraceSummary
+ *
+ * \brief The spans of a given name, or the updates of a counter, aggregated
+ */
+struct TraceSummary {
+  std::string name;      /**< The span or counter name */
+  uint64_t count = 0;    /**< The number of spans or counter updates */
+  double total_ms = 0.0; /**< Total duration, or final counter value */
+  double max_ms = 0.0;   /**< Longest span */
+  bool is_counter = false; /**< Whether this is a counter */
+};
+
+/**
+ * \struct Trace
+ *
+ * \brief Records timed spans and counters of the stages of a run
+ *
+ * Tracing is always compiled in and enabled at runtime; while disabled, a span
+ * costs a relaxed atomic load. Events are exported in the Chrome trace event
+ * format, which chrome://tracing and https://ui.perfetto.dev display, along
+ * with a table of the time spent in each stage.
+ */
+struct Trace {
+  using ClockType = std::chrono::steady_clock;
+
+  /**
+   * \brief Get the trace of the process
+   *
+   * \return the trace
+   */
+  static Trace& get();
+
+  /**
+   * \brief Start recording, dropping previous events
+   *
+   * \param[in] filename the Chrome trace file written by \c finish, or empty
+   * to only print the summary
+   */
+  void enable(std::string const& filename);
+
+  /**
+   * \brief Whether events are recorded
+   *
+   * \return whether tracing is enabled
+   */
+  bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  /**
+   * \brief Record a span
+   *
+   * \param[in] name the span name
+   * \param[in] begin the start time
+   * \param[in] end the end time
+   * \param[in] args the span arguments
+   */
+  void addSpan(
+    std::string name, ClockType::time_point begin, ClockType::time_point end,
+    std::vector<TraceArg> args = {});
+
+  /**
+   * \brief Add to a counter, when tracing is enabled
+   *
+   * \param[in] name the counter name
+   * \param[in] delta the amount added
+   */
+  void count(std::string const& name, double delta);
+
+  /**
+   * \brief Get a copy of the recorded events, in recording order
+   *
+   * \return the events
+   */
+  std::vector<TraceEvent> getEvents() const;
+
+  /**
+   * \brief Aggregate the events by name: spans first, longest total first,
+   * then counters by name
+   *
+   * \return the summaries
+   */
+  std::vector<TraceSummary> summarize() const;
+
+  /**
+   * \brief Write the events as a Chrome trace JSON object
+   *
+   * \param[in] os the output stream
+   */
+  void writeChromeJSON(std::ostream& os) const;
+
+  /**
+   * \brief Write the summary table
+   *
+   * The share of the run of a stage sums its spans over all threads, hence
+   * exceeds 100% for stages run concurrently.
+   *
+   * \param[in] os the output stream
+   */
+  void writeSummary(std::ostream& os) const;
+
+  /**
+   * \brief Stop recording, write the Chrome trace file and print the summary
+   *
+   * Does nothing when tracing is disabled.
+   */
+  void finish();
+
+  /**
+   * \brief Get a small id of the calling thread, numbered in order of first
+   * use
+   *
+   * \return the thread id
+   */
+  static uint64_t getThreadID();
+
+private:
+  /**
+   * \internal \brief Get the microseconds elapsed since tracing was enabled
+   */
+  double sinceStart(ClockType::time_point t) const;
+
+  std::atomic<bool> enabled_ = false;
+  mutable std::mutex mutex_;
+  ClockType::time_point start_ = ClockType::now();
+  std::string filename_;
+  std::vector<TraceEvent> events_;
+  std::vector<std::pair<std::string, double>> counters_;
+};
+
+/**
+ * \struct TraceSpan
+ *
+ * \brief Records a span of the process trace from construction to destruction
+ *
+ * \code{.cpp}
+ * {
+ *   TraceSpan span("render_png", {{"phase", phase}});
+ *   ...
+ * }
+ * \endcode
+ */
+struct TraceSpan {
+  /**
+   * \brief Start the span, if tracing is enabled
+   *
+   * \param[in] in_name the span name, which must outlive the span
+   * \param[in] in_args the span arguments
+   */
+  explicit TraceSpan(
+    char const* in_name, std::initializer_list<TraceArg> in_args = {})
+    : name_(Trace::get().isEnabled() ? in_name : nullptr) {
+    if (name_ != nullptr) {
+      args_.assign(in_args.begin(), in_args.end());
+      begin_ = Trace::ClockType::now();
+    }
+  }
+
+  TraceSpan(TraceSpan const&) = delete;
+  TraceSpan& operator=(TraceSpan const&) = delete;
+
+  ~TraceSpan() {
+    if (name_ != nullptr) {
+      Trace::get().addSpan(
+        name_, begin_, Trace::ClockType::now(), std::move(args_));
+    }
+  }
+
+private:
+  char const* name_ = nullptr;
+  Trace::ClockType::time_point begin_;
+  std::vector<TraceArg> args_;
+};
+
+} /* end namespace vt::tv::utility */
+
+#endif /*INCLUDED_VT_TV_UTILITY_TRACE_H*/
@@ -0,0 +1,239 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              bench_hot_paths.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/render/render.h>
+
+#include "../unit/generator.h"
+
+#include <fmt-vt/format.h>
+#include <nlohmann/json.hpp>
+#include <CLI/CLI11.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace vt::tv;
+
+using Clock = std::chrono::steady_clock;
+using Generator = tests::unit::Generator;
+
+/**
+ * \brief Lay ranks out on the most square 2D grid
+ *
+ * \param[in] n_ranks the number of ranks
+ *
+ * \return the grid sizes
+ */
+std::array<uint64_t, 3> getGridSize(uint64_t n_ranks) {
+  uint64_t x = static_cast<uint64_t>(std::sqrt(static_cast<double>(n_ranks)));
+  while (x > 1 && n_ranks % x != 0) {
+    x--;
+  }
+  return {x, n_ranks / x, 1};
+}
+
+/**
+ * \brief Timings of one benchmark over all repetitions
+ */
+struct Timings {
+  double min_ms = std::numeric_limits<double>::max();
+  double total_ms = 0.0;
+  uint64_t n = 0;
+
+  void add(double ms) {
+    min_ms = std::min(min_ms, ms);
+    total_ms += ms;
+    n++;
+  }
+
+  double meanMs() const { return n == 0 ? 0.0 : total_ms / n; }
+};
+
+/**
+ * \brief Time a callable in milliseconds
+ */
+template <typename Callable>
+double timeMs(Callable&& fn) {
+  auto const start = Clock::now();
+  fn();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+    .count();
+}
+
+} /* end anonymous namespace */
+
+int main(int argc, char** argv) {
+  CLI::App app{"Benchmark of the data model, QOI getters and mesh builders"};
+
+  std::vector<uint64_t> ranks = {4, 64};
+  app.add_option("--ranks", ranks, "Numbers of ranks");
+  std::vector<uint64_t> objects = {16, 256};
+  app.add_option("--objects", objects, "Numbers of objects per rank");
+  std::vector<uint64_t> phases = {2};
+  app.add_option("--phases", phases, "Numbers of phases");
+  std::vector<uint64_t> edges = {0, 4};
+  app.add_option("--edges", edges, "Numbers of messages sent per object");
+  uint64_t repeat = 5;
+  app.add_option("-r,--repeat", repeat, "Number of repetitions");
+  uint64_t qoi_samples = 64;
+  app.add_option(
+    "--qoi-samples", qoi_samples, "Number of objects whose QOI is queried");
+  std::string output_file = std::string(BUILD_DIR) + "/bench_hot_paths.json";
+  app.add_option("-o,--output", output_file, "JSON results file");
+
+  CLI11_PARSE(app, argc, argv);
+
+  nlohmann::json results = nlohmann::json::array();
+  std::vector<std::string> lines;
+
+  for (auto const n_ranks : ranks) {
+    for (auto const n_objects : objects) {
+      for (auto const n_phases : phases) {
+        for (auto const n_edges : edges) {
+          Info const info = Generator::makeCommunicatingInfo(
+            n_ranks, n_objects, n_phases, n_edges);
+
+          // Objects whose QOI is queried, spread over all ranks
+          std::vector<ElementIDType> sampled_objects;
+          uint64_t const n_all_objects = n_ranks * n_objects;
+          uint64_t const n_samples = std::min(qoi_samples, n_all_objects);
+          for (uint64_t i = 0; i < n_samples; i++) {
+            sampled_objects.push_back(i * n_all_objects / n_samples);
+          }
+
+          std::vector<std::pair<std::string, Timings>> timings = {
+            {"Info::getPhaseObjects", {}},
+            {"Info::getObjectQOIAtPhase", {}},
+            {"Info::normalizeEdges", {}},
+            {"Info::getImbalance", {}},
+            {"Render::computeObjectQOIRange_", {}},
+            {"Render::createObjectMesh_", {}},
+            {"Render::createRankMesh_", {}}};
+
+          for (uint64_t r = 0; r < repeat; r++) {
+            timings[0].second.add(timeMs([&] {
+              for (PhaseType p = 0; p < n_phases; p++) {
+                auto const objects_at_phase =
+                  info.getPhaseObjects(p, no_lb_iter);
+              }
+            }));
+            timings[1].second.add(timeMs([&] {
+              for (auto const object_id : sampled_objects) {
+                info.getObjectQOIAtPhase<double>(
+                  object_id, 0, no_lb_iter, "load");
+              }
+            }));
+
+            // Edges are normalized in place, hence on a fresh copy
+            auto normalized = std::make_shared<Info>(info);
+            timings[2].second.add(timeMs([&] {
+              for (PhaseType p = 0; p < n_phases; p++) {
+                normalized->normalizeEdges(p);
+              }
+            }));
+            timings[3].second.add(timeMs([&] {
+              for (PhaseType p = 0; p < n_phases; p++) {
+                info.getImbalance(p, no_lb_iter);
+              }
+            }));
+
+            Render render(
+              {"load", "", "load"}, true, normalized, getGridSize(n_ranks),
+              0.5, std::string(BUILD_DIR) + "/", "bench_hot_paths", 1.0,
+              false, false);
+            timings[4].second.add(
+              timeMs([&] { render.computeObjectQOIRange_(); }));
+            timings[5].second.add(timeMs([&] {
+              for (PhaseType p = 0; p < n_phases; p++) {
+                render.createObjectMesh_(p, no_lb_iter);
+              }
+            }));
+            timings[6].second.add(timeMs([&] {
+              for (PhaseType p = 0; p < n_phases; p++) {
+                render.createRankMesh_(p, no_lb_iter);
+              }
+            }));
+          }
+
+          for (auto const& [name, t] : timings) {
+            results.push_back(
+              {{"name", name},
+               {"ranks", n_ranks},
+               {"objects_per_rank", n_objects},
+               {"phases", n_phases},
+               {"edges_per_object", n_edges},
+               {"repetitions", t.n},
+               {"min_ms", t.min_ms},
+               {"mean_ms", t.meanMs()}});
+            lines.push_back(fmt::format(
+              "{:<32} {:>6} {:>8} {:>6} {:>6} {:>12.3f} {:>12.3f}", name,
+              n_ranks, n_objects, n_phases, n_edges, t.min_ms, t.meanMs()));
+          }
+        }
+      }
+    }
+  }
+
+  // The data model prints while working: report once everything has run
+  fmt::print(
+    "\n{:<32} {:>6} {:>8} {:>6} {:>6} {:>12} {:>12}\n", "benchmark", "ranks",
+    "objects", "phases", "edges", "min (ms)", "mean (ms)");
+  for (auto const& line : lines) {
+    fmt::print("{}\n", line);
+  }
+
+  std::ofstream os(output_file);
+  os << results.dump(2) << "\n";
+  fmt::print("Results written to {}\n", output_file);
+
+  return 0;
+}
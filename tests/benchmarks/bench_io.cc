@@ -0,0 +1,321 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 bench_io.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/decompression_input_container.h>
+#include <vt-tv/utility/json_generator.h>
+#include <vt-tv/utility/json_reader.h>
+#include <vt-tv/utility/output_adaptor.h>
+
+#include "../unit/generator.h"
+
+#include <fmt-vt/format.h>
+#include <nlohmann/json.hpp>
+#include <CLI/CLI11.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::atomic<uint64_t> n_allocations{0};
+
+} /* end anonymous namespace */
+
+// Count the allocations of everything benchmarked here. The replacements are
+// not inlined, which would pair new expressions with malloc and free
+[[gnu::noinline]] void* operator new(std::size_t size) {
+  n_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+[[gnu::noinline]] void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+using namespace vt::tv;
+
+using Clock = std::chrono::steady_clock;
+using Generator = tests::unit::Generator;
+
+/**
+ * \brief Best time and allocations of a callable over repetitions
+ */
+struct Measure {
+  double min_ms = std::numeric_limits<double>::max();
+  uint64_t allocations = 0;
+};
+
+/**
+ * \brief Run a callable several times
+ *
+ * \param[in] repeat the number of runs
+ * \param[in] fn the callable
+ *
+ * \return the best time in milliseconds and the allocations of one run
+ */
+template <typename Callable>
+Measure measure(uint64_t repeat, Callable&& fn) {
+  Measure m;
+  for (uint64_t r = 0; r < repeat; r++) {
+    auto const allocations = n_allocations.load();
+    auto const start = Clock::now();
+    fn();
+    auto const ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    m.min_ms = std::min(m.min_ms, ms);
+    m.allocations = n_allocations.load() - allocations;
+  }
+  return m;
+}
+
+/**
+ * \brief Collects the results of all benchmarks
+ */
+struct Report {
+  /**
+   * \brief Add a result
+   *
+   * \param[in] section the benchmark section
+   * \param[in] input the input name
+   * \param[in] setting the varied setting, as displayed
+   * \param[in] bytes the uncompressed bytes processed by one run
+   * \param[in] m the measure
+   * \param[in] extra additional fields of the JSON entry
+   */
+  void add(
+    std::string const& section, std::string const& input,
+    std::string const& setting, std::uintmax_t bytes, Measure const& m,
+    nlohmann::json extra = nlohmann::json::object()) {
+    double const mb = static_cast<double>(bytes) / (1024.0 * 1024.0);
+    double const mb_per_s = mb / (m.min_ms / 1000.0);
+    double const allocations_per_mb = m.allocations / mb;
+    extra["section"] = section;
+    extra["input"] = input;
+    extra["bytes"] = bytes;
+    extra["min_ms"] = m.min_ms;
+    extra["mb_per_s"] = mb_per_s;
+    extra["allocations_per_mb"] = allocations_per_mb;
+    results.push_back(std::move(extra));
+    fmt::print(
+      "{:<8} {:<24} {:<20} {:>12} {:>12.2f} {:>14.1f}\n", section, input,
+      setting, bytes, mb_per_s, allocations_per_mb);
+  }
+
+  nlohmann::json results = nlohmann::json::array();
+};
+
+/**
+ * \brief Serialize JSON through an \c OutputAdaptor
+ *
+ * \param[in] j the JSON
+ * \param[in] os the output stream
+ * \param[in] compress whether to compress
+ * \param[in] quality the brotli quality
+ * \param[in] window_bits the brotli window bits
+ */
+template <typename StreamLike>
+void dumpJSON(
+  nlohmann::json const& j, StreamLike& os, bool compress, int quality = 8,
+  int window_bits = 20) {
+  // The adaptor finishes compressing when the serializer releases it
+  using Adaptor = utility::OutputAdaptor<StreamLike>;
+  nlohmann::detail::serializer<nlohmann::json> s(
+    std::make_shared<Adaptor>(os, compress, quality, window_bits), ' ');
+  s.dump(j, false, false, 0);
+}
+
+} /* end anonymous namespace */
+
+int main(int argc, char** argv) {
+  CLI::App app{"Benchmark of the decompression, parsing and JSON output"};
+
+  std::vector<std::string> data_files = {
+    "data/lb_test_data/data.0.json",
+    "data/lb_test_data_compressed/data.0.json.br"};
+  app.add_option("-d,--data", data_files, "Additional data files");
+  uint64_t n_objects = 20000;
+  app.add_option("--objects", n_objects, "Objects of the synthetic data");
+  uint64_t n_phases = 4;
+  app.add_option("--phases", n_phases, "Phases of the synthetic data");
+  std::vector<std::size_t> chunk_sizes = {
+    1 << 12, 1 << 14, 1 << 16, 1 << 18, 1 << 20};
+  app.add_option("--chunk-sizes", chunk_sizes, "Input chunk sizes in bytes");
+  std::vector<int> qualities = {1, 5, 8, 11};
+  app.add_option("--qualities", qualities, "Brotli qualities of the output");
+  std::vector<int> windows = {18, 20, 22, 24};
+  app.add_option("--windows", windows, "Brotli window bits of the output");
+  uint64_t repeat = 5;
+  app.add_option("-r,--repeat", repeat, "Number of repetitions");
+  std::string output_dir = std::string(BUILD_DIR) + "/bench_io";
+  app.add_option("-o,--output", output_dir, "Scratch and results directory");
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::filesystem::create_directories(output_dir);
+
+  // Synthetic data file of a single rank, written plain and compressed
+  Info const info =
+    Generator::makeCommunicatingInfo(1, n_objects, n_phases, 0);
+  nlohmann::json synthetic;
+  for (PhaseType phase = 0; phase < n_phases; phase++) {
+    synthetic["phases"][phase] =
+      *utility::JSONGenerator(info, 0, phase).generateJSON();
+  }
+  std::string const synthetic_plain = output_dir + "/synthetic.0.json";
+  std::string const synthetic_brotli = output_dir + "/synthetic.0.json.br";
+  {
+    std::ofstream os(synthetic_plain, std::ios::binary);
+    dumpJSON(synthetic, os, false);
+  }
+  {
+    std::ofstream os(synthetic_brotli, std::ios::binary);
+    dumpJSON(synthetic, os, true);
+  }
+
+  std::vector<std::string> inputs = {synthetic_plain, synthetic_brotli};
+  for (auto const& data_file : data_files) {
+    std::filesystem::path path(data_file);
+    if (path.is_relative()) {
+      path = std::filesystem::path(SRC_DIR) / path;
+    }
+    inputs.push_back(path.string());
+  }
+
+  Report report;
+  fmt::print(
+    "{:<8} {:<24} {:<20} {:>12} {:>12} {:>14}\n", "section", "input",
+    "setting", "bytes", "MB/s", "allocs/MB");
+
+  for (auto const& input : inputs) {
+    std::string const name = std::filesystem::path(input).filename().string();
+    bool const compressed = utility::JSONReader{0}.isCompressed(input);
+
+    // Read the whole input, decompressing it when needed
+    std::uintmax_t bytes = 0;
+    for (auto const chunk_size : chunk_sizes) {
+      auto const m = measure(repeat, [&] {
+        bytes = 0;
+        if (compressed) {
+          utility::DecompressionInputContainer c(input, chunk_size);
+          do {
+            bytes++;
+          } while (c.advance());
+        } else {
+          std::ifstream is(input, std::ios::binary);
+          std::vector<char> buffer(chunk_size);
+          while (is.read(buffer.data(), chunk_size) || is.gcount() > 0) {
+            bytes += is.gcount();
+          }
+        }
+      });
+      report.add(
+        "read", name, fmt::format("chunk={}", chunk_size), bytes, m,
+        {{"compressed", compressed}, {"chunk_size", chunk_size}});
+    }
+
+    // Read and parse into Info
+    auto const m = measure(repeat, [&] {
+      utility::JSONReader reader{0};
+      reader.readFile(input);
+      auto const parsed = reader.parse();
+    });
+    report.add("parse", name, "", bytes, m, {{"compressed", compressed}});
+  }
+
+  // Output of the synthetic data at all compression settings
+  std::uintmax_t const synthetic_bytes =
+    std::filesystem::file_size(synthetic_plain);
+  {
+    auto const m = measure(repeat, [&] {
+      std::ostringstream os;
+      dumpJSON(synthetic, os, false);
+    });
+    report.add(
+      "write", "synthetic", "plain", synthetic_bytes, m,
+      {{"compressed", false}, {"output_bytes", synthetic_bytes}});
+  }
+  for (auto const quality : qualities) {
+    for (auto const window_bits : windows) {
+      std::uintmax_t output_bytes = 0;
+      auto const m = measure(repeat, [&] {
+        std::ostringstream os;
+        dumpJSON(synthetic, os, true, quality, window_bits);
+        output_bytes = os.tellp();
+      });
+      report.add(
+        "write", "synthetic",
+        fmt::format("q={} w={} ratio={:.1f}", quality, window_bits,
+          static_cast<double>(synthetic_bytes) / output_bytes),
+        synthetic_bytes, m,
+        {{"compressed", true},
+         {"quality", quality},
+         {"window_bits", window_bits},
+         {"output_bytes", output_bytes}});
+    }
+  }
+
+  std::string const results_file = output_dir + "/bench_io.json";
+  std::ofstream os(results_file);
+  os << report.results.dump(2) << "\n";
+  fmt::print("Results written to {}\n", results_file);
+
+  return 0;
+}
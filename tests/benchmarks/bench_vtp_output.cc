@@ -0,0 +1,225 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             bench_vtp_output.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/render/render.h>
+#include <vt-tv/utility/info_loader.h>
+#include <vt-tv/utility/json_reader.h>
+
+#include <fmt-vt/format.h>
+#include <CLI/CLI11.hpp>
+
+#include <vtkXMLPolyDataReader.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <regex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using namespace vt::tv;
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * \brief Load all the per-rank JSON data files of a data set directory
+ *
+ * \param[in] dir the data set directory
+ *
+ * \return the info holding all ranks
+ */
+Info loadDataSet(std::filesystem::path const& dir) {
+  std::regex const pattern(R"(data\.(\d+)\.json(\.br)?)");
+  Info info;
+  for (auto const& entry : std::filesystem::directory_iterator(dir)) {
+    std::smatch match;
+    std::string const filename = entry.path().filename().string();
+    if (std::regex_match(filename, match, pattern)) {
+      auto const rank = static_cast<NodeType>(std::stoi(match[1].str()));
+      utility::JSONReader reader{rank};
+      reader.readFile(entry.path().string());
+      auto rank_info = reader.parse();
+      info.addInfo(rank_info->getObjectInfo(), rank_info->getRank(rank));
+    }
+  }
+  utility::InfoLoader::selectPhase(
+    info, std::numeric_limits<PhaseType>::max());
+  return info;
+}
+
+/**
+ * \brief Lay ranks out on the most square 2D grid
+ *
+ * \param[in] n_ranks the number of ranks
+ *
+ * \return the grid sizes
+ */
+std::array<uint64_t, 3> getGridSize(uint64_t n_ranks) {
+  uint64_t x = static_cast<uint64_t>(std::sqrt(static_cast<double>(n_ranks)));
+  while (x > 1 && n_ranks % x != 0) {
+    x--;
+  }
+  return {x, n_ranks / x, 1};
+}
+
+/**
+ * \brief Time a callable in milliseconds
+ */
+template <typename Callable>
+double timeMs(Callable&& fn) {
+  auto const start = Clock::now();
+  fn();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+    .count();
+}
+
+} /* end anonymous namespace */
+
+int main(int argc, char** argv) {
+  CLI::App app{"Benchmark of the VTP mesh output modes"};
+
+  std::vector<std::string> data_sets = {
+    "data/lb_test_data", "data/lb_test_data_compressed", "data/ccm_example",
+    "data/synthetic_attributes"};
+  app.add_option("-d,--data", data_sets, "Data set directories");
+  uint64_t repeat = 100;
+  app.add_option("-r,--repeat", repeat, "Number of writes and reads per mesh");
+  std::string output_dir = std::string(BUILD_DIR) + "/bench_vtp_output";
+  app.add_option("-o,--output", output_dir, "Scratch output directory");
+
+  CLI11_PARSE(app, argc, argv);
+
+  std::vector<std::tuple<VTPEncodingType, VTPCompressorType, int>> const modes =
+    {{VTPEncodingType::Base64, VTPCompressorType::ZLib, 5},
+     {VTPEncodingType::Raw, VTPCompressorType::None, 5},
+     {VTPEncodingType::Raw, VTPCompressorType::LZ4, 1},
+     {VTPEncodingType::Raw, VTPCompressorType::LZ4, 9},
+     {VTPEncodingType::Raw, VTPCompressorType::ZLib, 1},
+     {VTPEncodingType::Raw, VTPCompressorType::ZLib, 5},
+     {VTPEncodingType::Raw, VTPCompressorType::ZLib, 9}};
+  char const* encoding_names[] = {"base64", "raw"};
+  char const* compressor_names[] = {"none", "zlib", "lz4"};
+
+  fmt::print(
+    "{:<32} {:>8} {:>6} {:>5} {:>12} {:>12} {:>12}\n", "data set",
+    "encoding", "comp", "level", "size (B)", "write (MB/s)", "read (MB/s)");
+
+  for (auto const& data_set : data_sets) {
+    std::filesystem::path data_path(data_set);
+    if (data_path.is_relative()) {
+      data_path = std::filesystem::path(SRC_DIR) / data_path;
+    }
+    auto info = std::make_shared<Info>(loadDataSet(data_path));
+    if (info->getNumRanks() == 0) {
+      fmt::print("{}: no data files found, skipped\n", data_set);
+      continue;
+    }
+
+    // Produce the meshes of all phases with the default output mode
+    std::string const stem = data_path.filename().string();
+    std::string const set_dir = output_dir + "/" + stem + "/";
+    std::filesystem::create_directories(set_dir);
+    {
+      Render render(
+        {"load", "", "load"}, true, info, getGridSize(info->getNumRanks()), 0.5,
+        set_dir, stem, 1.0, true, false);
+      render.generate();
+    }
+
+    std::vector<vtkSmartPointer<vtkPolyData>> meshes;
+    double in_memory_mb = 0.0;
+    for (auto const& entry : std::filesystem::directory_iterator(set_dir)) {
+      if (entry.path().extension() != ".vtp") {
+        continue;
+      }
+      vtkNew<vtkXMLPolyDataReader> reader;
+      reader->SetFileName(entry.path().string().c_str());
+      reader->Update();
+      auto mesh = vtkSmartPointer<vtkPolyData>::New();
+      mesh->DeepCopy(reader->GetOutput());
+      in_memory_mb += mesh->GetActualMemorySize() / 1024.0;
+      meshes.push_back(mesh);
+    }
+
+    // Throughputs are relative to the in-memory size of the meshes
+    for (auto const& [encoding, compressor, level] : modes) {
+      std::uintmax_t size = 0;
+      double write_ms = 0.0;
+      double read_ms = 0.0;
+      for (std::size_t m = 0; m < meshes.size(); m++) {
+        std::string const filename =
+          fmt::format("{}bench_{}.vtp", set_dir, m);
+        write_ms += timeMs([&] {
+          for (uint64_t r = 0; r < repeat; r++) {
+            Render::writeVTP(meshes[m], filename, encoding, compressor, level);
+          }
+        });
+        read_ms += timeMs([&] {
+          for (uint64_t r = 0; r < repeat; r++) {
+            vtkNew<vtkXMLPolyDataReader> reader;
+            reader->SetFileName(filename.c_str());
+            reader->Update();
+          }
+        });
+        size += std::filesystem::file_size(filename);
+        std::filesystem::remove(filename);
+      }
+
+      double const total_mb = in_memory_mb * repeat;
+      fmt::print(
+        "{:<32} {:>8} {:>6} {:>5} {:>12} {:>12.2f} {:>12.2f}\n", data_set,
+        encoding_names[static_cast<int>(encoding)],
+        compressor_names[static_cast<int>(compressor)],
+        compressor == VTPCompressorType::None ? 0 : level, size,
+        total_mb / (write_ms / 1000.0), total_mb / (read_ms / 1000.0));
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,390 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               perf_pipeline.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/analytics.h>
+#include <vt-tv/utility/dataset_generator.h>
+#include <vt-tv/utility/info_loader.h>
+#include <vt-tv/utility/log.h>
+#include <vt-tv/utility/memory_report.h>
+
+#if VT_TV_RENDER_ENABLED
+#include <vt-tv/render/render.h>
+#endif
+
+#include <fmt-vt/format.h>
+#include <nlohmann/json.hpp>
+#include <CLI/CLI11.hpp>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace vt::tv;
+
+using Clock = std::chrono::steady_clock;
+using MemoryReport = utility::MemoryReport;
+
+double toMiB(uint64_t bytes) {
+  return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+double elapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+    .count();
+}
+
+/**
+ * \brief Best time and peak resident set size of a stage over repetitions,
+ * with the best time of the calibration run next to it
+ */
+struct StageMeasure {
+  std::string name;
+  double ms = std::numeric_limits<double>::max();
+  double calibration_ms = std::numeric_limits<double>::max();
+  double peak_mib = std::numeric_limits<double>::max();
+
+  /// The time of the stage in calibration runs, which holds across machines
+  double getRelativeTime() const { return ms / calibration_ms; }
+};
+
+/**
+ * \brief A fixed workload of the same nature as the stages, parsing JSON
+ * into maps, timed before each run of a stage so that both are slowed alike
+ * by the machine and its load
+ */
+struct Calibration {
+  Calibration() {
+    nlohmann::json records = nlohmann::json::array();
+    for (uint64_t i = 0; i < 20000; i++) {
+      records.push_back(
+        {{"id", i}, {"load", 0.5 * static_cast<double>(i % 97)},
+         {"to", {i % 13, i % 31, i % 71}}});
+    }
+    text_ = records.dump();
+  }
+
+  /**
+   * \brief Run the workload
+   *
+   * \return the time of the run in ms
+   */
+  double run() const {
+    auto const start = Clock::now();
+    std::map<uint64_t, std::vector<uint64_t>> edges;
+    double total = 0.0;
+    for (auto const& record : nlohmann::json::parse(text_)) {
+      total += record["load"].get<double>();
+      edges[record["id"]] = record["to"].get<std::vector<uint64_t>>();
+    }
+    if (edges.size() != 20000 or total < 0.0) {
+      throw std::runtime_error("Calibration failed");
+    }
+    return elapsedMs(start);
+  }
+
+private:
+  std::string text_;
+};
+
+/**
+ * \brief Run a stage several times, each run after a calibration run,
+ * keeping the best of each measure
+ *
+ * \param[in] name the stage name
+ * \param[in] repeat the number of runs
+ * \param[in] calibration the calibration workload
+ * \param[in] fn the stage
+ * \param[in] reset releases the results of the previous run, untimed
+ *
+ * \return the measure
+ */
+StageMeasure measure(
+  std::string const& name, uint64_t repeat, Calibration const& calibration,
+  std::function<void()> const& fn,
+  std::function<void()> const& reset = [] {}) {
+  StageMeasure m{name};
+  for (uint64_t r = 0; r < repeat; r++) {
+    reset();
+    m.calibration_ms = std::min(m.calibration_ms, calibration.run());
+    MemoryReport::resetPeakRSS();
+    auto const start = Clock::now();
+    fn();
+    m.ms = std::min(m.ms, elapsedMs(start));
+    m.peak_mib = std::min(m.peak_mib, toMiB(MemoryReport::getPeakRSS()));
+  }
+  return m;
+}
+
+/**
+ * \brief The tolerances of the comparison with the baseline: a stage
+ * regresses when it exceeds its baseline by the relative tolerance plus the
+ * absolute slack, which absorbs the noise of short stages. Baseline times are
+ * first scaled by the calibration runs of both machines.
+ */
+struct Tolerance {
+  double time = 0.5;
+  double time_slack_ms = 20.0;
+  double memory = 0.2;
+  double memory_slack_mib = 16.0;
+};
+
+/**
+ * \brief Make the configuration \c InfoLoader reads the data files with,
+ * without the validation of their schema, which runs an external interpreter
+ *
+ * \param[in] directory the directory of the data files
+ * \param[in] grid_size the rank grid
+ *
+ * \return the configuration
+ */
+YAML::Node makeConfig(
+  std::string const& directory, std::array<uint64_t, 3> const& grid_size) {
+  YAML::Node config;
+  config["input"]["directory"] = directory;
+  config["input"]["file_stem"] = "data";
+  config["input"]["n_ranks"] = grid_size[0] * grid_size[1] * grid_size[2];
+  config["input"]["validate_schema"] = false;
+  config["viz"]["x_ranks"] = grid_size[0];
+  config["viz"]["y_ranks"] = grid_size[1];
+  config["viz"]["z_ranks"] = grid_size[2];
+  return config;
+}
+
+} /* end anonymous namespace */
+
+int main(int argc, char** argv) {
+  CLI::App app{
+    "Performance regression test of the ingest, analytics and mesh stages"};
+
+  std::string baseline_file =
+    std::string(SRC_DIR) + "/tests/expected/perf/perf_pipeline.json";
+  app.add_option("-b,--baseline", baseline_file, "Baseline JSON file");
+  bool update_baseline = false;
+  app.add_flag(
+    "-u,--update-baseline", update_baseline,
+    "Write the measures to the baseline instead of comparing with it");
+  Tolerance tolerance;
+  app
+    .add_option(
+      "--time-tolerance", tolerance.time,
+      "Relative increase of the time of a stage that fails the test")
+    ->envname("VT_TV_PERF_TIME_TOLERANCE");
+  app
+    .add_option(
+      "--time-slack", tolerance.time_slack_ms,
+      "Additional increase of the time of a stage allowed, in ms")
+    ->envname("VT_TV_PERF_TIME_SLACK");
+  app
+    .add_option(
+      "--memory-tolerance", tolerance.memory,
+      "Relative increase of the peak memory of a stage that fails the test")
+    ->envname("VT_TV_PERF_MEMORY_TOLERANCE");
+  app
+    .add_option(
+      "--memory-slack", tolerance.memory_slack_mib,
+      "Additional increase of the peak memory of a stage allowed, in MiB")
+    ->envname("VT_TV_PERF_MEMORY_SLACK");
+  uint64_t repeat = 3;
+  app.add_option("-r,--repeat", repeat, "Number of runs of each stage");
+  std::string output_dir = std::string(BUILD_DIR) + "/perf_pipeline";
+  app.add_option("-o,--output", output_dir, "Scratch directory");
+
+  CLI11_PARSE(app, argc, argv);
+
+  // The workload is fixed: a baseline only holds for the workload it was
+  // measured with
+  utility::DatasetSpec spec;
+  spec.num_ranks = 8;
+  spec.num_objects_per_rank = 250;
+  spec.num_phases = 2;
+  spec.num_lb_iterations = 1;
+  spec.comm_degree = 4;
+  spec.migration_fraction = 0.1;
+  spec.seed = 0;
+  nlohmann::json const workload = {
+    {"ranks", spec.num_ranks},
+    {"objects_per_rank", spec.num_objects_per_rank},
+    {"phases", spec.num_phases},
+    {"lb_iterations", spec.num_lb_iterations},
+    {"comm_degree", spec.comm_degree},
+    {"migration_fraction", spec.migration_fraction},
+    {"seed", spec.seed}};
+
+  utility::Log::setLevel(utility::LogLevel::Warning);
+  // Files of another workload would be read along with the generated ones
+  std::filesystem::remove_all(output_dir);
+  std::filesystem::create_directories(output_dir);
+  utility::DatasetGenerator(spec).write(output_dir, "data");
+
+  // Data files are read, cataloged and normalized as by the applications
+  std::array<uint64_t, 3> const grid_size = {4, spec.num_ranks / 4, 1};
+  auto const config = makeConfig(output_dir, grid_size);
+  Calibration const calibration;
+  std::vector<StageMeasure> measures;
+  std::shared_ptr<Info> info;
+  measures.push_back(measure(
+    "ingest", repeat, calibration,
+    [&] { info = utility::InfoLoader::loadFromConfig(config); },
+    [&] { info.reset(); }));
+  measures.push_back(measure("analytics", repeat, calibration, [&] {
+    utility::Analytics analytics(*info);
+  }));
+
+#if VT_TV_RENDER_ENABLED
+  // Meshes are built for every frame but neither written nor drawn
+  std::unique_ptr<Render> render;
+  measures.push_back(measure(
+    "render_setup", repeat, calibration,
+    [&] {
+      render = std::make_unique<Render>(
+        std::array<std::string, 3>{"load", "", "load"}, true, info, grid_size,
+        0.5,
+        output_dir + "/", "perf", 1.0, false, false);
+    },
+    [&] { render.reset(); }));
+  measures.push_back(
+    measure("meshes", repeat, calibration, [&] { render->generate(); }));
+  render.reset();
+#endif
+
+  nlohmann::json baseline = nlohmann::json::object();
+  if (std::ifstream is(baseline_file); is.good()) {
+    baseline = nlohmann::json::parse(is);
+  }
+
+  if (update_baseline) {
+    // Stages measured by other builds are kept
+    if (baseline.value("workload", nlohmann::json()) != workload) {
+      baseline = nlohmann::json::object();
+    }
+    baseline["workload"] = workload;
+    for (auto const& m : measures) {
+      baseline["stages"][m.name] = {
+        {"ms", m.ms},
+        {"relative_time", m.getRelativeTime()},
+        {"peak_mib", m.peak_mib}};
+    }
+    std::filesystem::create_directories(
+      std::filesystem::path(baseline_file).parent_path());
+    std::ofstream os(baseline_file);
+    os << baseline.dump(2) << "\n";
+    fmt::print("Baseline written to {}\n", baseline_file);
+    return 0;
+  }
+
+  if (baseline.empty()) {
+    fmt::print(
+      "No baseline found at {} (run with --update-baseline). FAILED\n",
+      baseline_file);
+    return 1;
+  }
+  if (baseline.value("workload", nlohmann::json()) != workload) {
+    fmt::print(
+      "The baseline {} was measured with another workload (run with "
+      "--update-baseline). FAILED\n",
+      baseline_file);
+    return 1;
+  }
+
+  fmt::print(
+    "{:<14} {:>12} {:>12} {:>12} {:>12} {:>12} {:>12} {}\n", "stage",
+    "base ms", "ms", "limit ms", "base MiB", "MiB", "limit MiB", "status");
+  auto const stages = baseline.value("stages", nlohmann::json::object());
+  bool regressed = false;
+  for (auto const& m : measures) {
+    // A stage of this build without baseline is reported, not compared,
+    // until the baseline is updated from a build measuring it
+    if (not stages.contains(m.name) or
+        not stages[m.name].contains("relative_time")) {
+      fmt::print(
+        "{:<14} {:>12} {:>12.2f} {:>12} {:>12} {:>12.1f} {:>12} "
+        "no baseline\n",
+        m.name, "-", m.ms, "-", "-", m.peak_mib, "-");
+      continue;
+    }
+    // The time the baseline stage would take on this machine now
+    double const base_ms =
+      stages[m.name]["relative_time"].get<double>() * m.calibration_ms;
+    double const base_mib = stages[m.name]["peak_mib"];
+    double const limit_ms =
+      base_ms * (1.0 + tolerance.time) + tolerance.time_slack_ms;
+    double const limit_mib =
+      base_mib * (1.0 + tolerance.memory) + tolerance.memory_slack_mib;
+    std::string status;
+    if (m.ms > limit_ms) {
+      status += " time";
+    }
+    if (m.peak_mib > limit_mib) {
+      status += " memory";
+    }
+    regressed = regressed or not status.empty();
+    fmt::print(
+      "{:<14} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.1f} {:>12.1f} {:>12.1f} {}\n",
+      m.name, base_ms, m.ms, limit_ms, base_mib, m.peak_mib, limit_mib,
+      status.empty() ? "OK" : "regressed:" + status);
+  }
+
+  fmt::print(
+    "Base times are scaled by a calibration run of {:.2f} ms.\n",
+    measures.front().calibration_ms);
+  fmt::print(
+    "Time tolerance = {} + {} ms. Memory tolerance = {} + {} MiB. {}\n",
+    tolerance.time, tolerance.time_slack_ms, tolerance.memory,
+    tolerance.memory_slack_mib, regressed ? "FAILED" : "OK");
+  return regressed ? 2 : 0;
+}
@@ -422,6 +422,32 @@ TEST_F(InfoTest, test_get_object_qoi) {
   }
 }
 
+/**
+ * Test Info:getObjectQOI matches getObjectQOIAtPhase, user-defined first
+ */
+TEST_F(InfoTest, test_get_object_qoi_from_object_work) {
+  ObjectWork object_0 = ObjectWork(
+    0, 2.0, {}, {{"task_size", 3}, {"load", 7.5}}, {{"color", 1.25}});
+
+  Info info = Info(
+    Generator::makeObjectInfoMap({{0, object_0}}), // 1 object
+    Generator::makeRanks({{0, object_0}}, 1, 1)    // 1 phase 1 rank
+  );
+  for (std::string qoi : {"load", "task_size", "color", "id", "max_volume"}) {
+    EXPECT_EQ(
+      info.getObjectQOI<double>(object_0, qoi),
+      info.getObjectQOIAtPhase<double>(0, 0, no_lb_iter, qoi)
+    ) << qoi;
+  }
+  // User-defined values take precedence over computed QOIs
+  EXPECT_EQ(info.getObjectQOI<double>(object_0, "load"), 7.5);
+  EXPECT_EQ(info.getObjectQOI<int>(object_0, "task_size"), 3);
+  EXPECT_EQ(info.getObjectQOI<double>(object_0, "color"), 1.25);
+  EXPECT_THROW(
+    info.getObjectQOI<double>(object_0, "non-existent"), std::runtime_error
+  );
+}
+
 TEST_F(InfoTest, test_get_rank_qoi) {
   auto objects_15 = Generator::makeObjects(2, 1.5, 0);
   auto objects_18 = Generator::makeObjects(2, 1.8, 2);
@@ -503,6 +529,133 @@ TEST_F(InfoTest, test_get_rank_qoi) {
   ASSERT_EQ(info.getRankQOIAtPhase(0, 0, no_lb_iter, "attr1"), 12.0);
 }
 
+/**
+ * Test Info:getMigrationDiff finds the objects moved since the previous frame
+ */
+TEST_F(InfoTest, test_get_migration_diff) {
+  auto objects = [](std::vector<std::pair<ElementIDType, TimeType>> loads) {
+    std::unordered_map<ElementIDType, ObjectWork> work;
+    for (auto const& [id, load] : loads) {
+      auto const object = Generator::makeObjects(1, load, static_cast<int>(id));
+      work.insert(object.begin(), object.end());
+    }
+    return work;
+  };
+
+  // Phase 0 is rebalanced by swapping objects 1 and 2, then object 1 moves
+  // back to rank 0 in phase 1 while object 4 is created on rank 1
+  PhaseWork phase_0_rank_0(0, objects({{0, 1.0}, {1, 1.5}}));
+  phase_0_rank_0.addLBIteration(
+    0, LBIteration(0, 0, objects({{0, 1.0}, {2, 1.8}})));
+  PhaseWork phase_0_rank_1(0, objects({{2, 1.8}, {3, 2.0}}));
+  phase_0_rank_1.addLBIteration(
+    0, LBIteration(0, 0, objects({{1, 1.5}, {3, 2.0}})));
+  Rank rank_0(
+    0,
+    {{0, phase_0_rank_0},
+     {1, PhaseWork(1, objects({{0, 1.0}, {1, 1.5}, {2, 1.8}}))}});
+  Rank rank_1(
+    1,
+    {{0, phase_0_rank_1}, {1, PhaseWork(1, objects({{3, 2.0}, {4, 0.5}}))}});
+
+  Info info(
+    Generator::makeObjectInfoMap(objects({{0, 1.0}, {1, 1.5}, {2, 1.8},
+                                          {3, 2.0}, {4, 0.5}})),
+    {{0, rank_0}, {1, rank_1}});
+
+  EXPECT_FALSE(info.getPreviousFrame(0, no_lb_iter).has_value());
+  EXPECT_EQ(info.getPreviousFrame(0, 0), std::make_pair(0ul, no_lb_iter));
+  EXPECT_EQ(info.getPreviousFrame(1, no_lb_iter), std::make_pair(0ul, 0ul));
+  EXPECT_THROW(info.getPreviousFrame(0, 1), std::runtime_error);
+
+  auto first = info.getMigrationDiff(0, no_lb_iter);
+  EXPECT_TRUE(first->migrations.empty());
+  EXPECT_THAT(first->n_in, ::testing::ElementsAre(0, 0));
+
+  auto lb_diff = info.getMigrationDiff(0, 0);
+  ASSERT_EQ(lb_diff->migrations.size(), 2);
+  EXPECT_EQ(lb_diff->migrations[0].object, 2);
+  EXPECT_EQ(lb_diff->migrations[0].from_rank, 1);
+  EXPECT_EQ(lb_diff->migrations[0].to_rank, 0);
+  EXPECT_EQ(lb_diff->migrations[0].load, 1.8);
+  EXPECT_EQ(lb_diff->migrations[1].object, 1);
+  EXPECT_THAT(lb_diff->n_in, ::testing::ElementsAre(1, 1));
+  EXPECT_THAT(lb_diff->n_out, ::testing::ElementsAre(1, 1));
+  EXPECT_THAT(lb_diff->load_in, ::testing::ElementsAre(1.8, 1.5));
+  EXPECT_THAT(lb_diff->load_out, ::testing::ElementsAre(1.5, 1.8));
+  EXPECT_EQ(info.getMigrationDiff(0, 0), lb_diff);
+
+  // Created objects have not migrated
+  auto phase_diff = info.getMigrationDiff(1, no_lb_iter);
+  ASSERT_EQ(phase_diff->migrations.size(), 1);
+  EXPECT_EQ(phase_diff->migrations[0].object, 1);
+  EXPECT_EQ(phase_diff->migrations[0].from_rank, 1);
+
+  auto direct_diff = info.computeMigrationDiff(0, no_lb_iter, 1, no_lb_iter);
+  ASSERT_EQ(direct_diff.migrations.size(), 1);
+  EXPECT_EQ(direct_diff.migrations[0].object, 2);
+
+  EXPECT_EQ(info.getRankQOIAtPhase(0, 1, no_lb_iter, "migrations_in"), 1.0);
+  EXPECT_EQ(info.getRankQOIAtPhase(1, 1, no_lb_iter, "migrations_out"), 1.0);
+  EXPECT_EQ(info.getRankQOIAtPhase(0, 0, 0, "migrated_load_in"), 1.8);
+  EXPECT_EQ(info.getRankQOIAtPhase(0, 0, 0, "migrated_load_out"), 1.5);
+  EXPECT_EQ(
+    info.getRankQOIAtPhase(1, 0, no_lb_iter, "migrated_load_out"), 0.0);
+}
+
+/**
+ * Test Info:normalizeEdges adds the missing sides of communications once, and
+ * again when ranks are added
+ */
+TEST_F(InfoTest, test_normalize_edges) {
+  auto sender = [](ElementIDType id, ElementIDType to) {
+    ObjectWork work(id, 1.0, {});
+    work.addSentCommunications(to, 10.0, 3);
+    return std::unordered_map<ElementIDType, ObjectWork>{{id, work}};
+  };
+  std::vector<UniqueIndexBitType> idx = {0};
+  auto object_info = [&](ElementIDType id, NodeType home) {
+    return std::unordered_map<ElementIDType, ObjectInfo>{
+      {id, ObjectInfo(id, home, true, idx)}};
+  };
+  auto received = [](Info const& info, NodeType rank, ElementIDType id) {
+    return info.getRank(rank)
+      .getPhaseWork()
+      .at(0)
+      .getObjectWork()
+      .at(id)
+      .getReceived();
+  };
+
+  Info info;
+  info.addInfo(object_info(0, 0), Rank(0, {{0, PhaseWork(0, sender(0, 1))}}));
+  info.addInfo(
+    object_info(1, 1),
+    Rank(1, {{0, PhaseWork(0, Generator::makeObjects(1, 1.0, 1))}}));
+
+  info.normalizeEdges(0);
+  info.normalizeEdges(0);
+  ASSERT_EQ(received(info, 1, 1).size(), 1);
+  EXPECT_EQ(received(info, 1, 1).begin()->first, 0);
+  EXPECT_EQ(received(info, 1, 1).begin()->second, 10.0);
+  EXPECT_TRUE(received(info, 0, 0).empty());
+  EXPECT_EQ(
+    info.getRank(1)
+      .getPhaseWork()
+      .at(0)
+      .getObjectWork()
+      .at(1)
+      .getReceivedMessages(),
+    (std::map<ElementIDType, uint64_t>{{0, 3}}));
+
+  // A new rank sending to object 0 requires normalizing the phase again
+  info.addInfo(object_info(2, 2), Rank(2, {{0, PhaseWork(0, sender(2, 0))}}));
+  info.normalizeEdges(0);
+  ASSERT_EQ(received(info, 0, 0).size(), 1);
+  EXPECT_EQ(received(info, 0, 0).begin()->first, 2);
+  EXPECT_EQ(received(info, 1, 1).size(), 1);
+}
+
 TEST_F(
   InfoTest,
   test_convert_qoi_variant_type_to_double_throws_runtime_error_for_string) {
@@ -89,6 +89,28 @@ TEST_F(ObjectCommunicatorTest, test_sample_communicator_and_getters) {
   EXPECT_EQ(comm_1.getTotalSentVolume(), 50.0);
 }
 
+/**
+ * Test ObjectCommunicator counts the messages of its edges for each peer
+ */
+TEST_F(ObjectCommunicatorTest, test_message_counts) {
+  // Edges given at construction are one message each
+  EXPECT_EQ(comm_1.getTotalReceivedMessages(), 2);
+  EXPECT_EQ(comm_1.getTotalSentMessages(), 3);
+
+  comm_0.addSent(1, 100.0, 4);
+  comm_0.addSent(1, 50.0, 2);
+  comm_0.addSent(2, 10.0);
+  comm_0.addReceived(3, 5.0, 7);
+  EXPECT_EQ(comm_0.getSent().size(), 3);
+  EXPECT_EQ(
+    comm_0.getSentMessages(),
+    (std::map<ElementIDType, uint64_t>{{1, 6}, {2, 1}}));
+  EXPECT_EQ(comm_0.getTotalSentMessages(), 7);
+  EXPECT_EQ(
+    comm_0.getReceivedMessages(), (std::map<ElementIDType, uint64_t>{{3, 7}}));
+  EXPECT_EQ(comm_0.getTotalReceivedMessages(), 7);
+}
+
 /**
  * Test ObjectCommunicator initial state
  */
@@ -111,13 +133,17 @@ TEST_F(ObjectCommunicatorTest, test_initial_state) {
 }
 
 TEST_F(ObjectCommunicatorTest, test_serialization) {
-  BasicSerializer<
-    std::variant<ElementIDType, std::multimap<ElementIDType, double>>>
-    s = BasicSerializer<
-      std::variant<ElementIDType, std::multimap<ElementIDType, double>>>();
+  using Item = std::variant<
+    ElementIDType, std::multimap<ElementIDType, double>,
+    std::map<ElementIDType, uint64_t>>;
+  BasicSerializer<Item> s = BasicSerializer<Item>();
 
   comm_1.serialize(s);
-  EXPECT_EQ(s.items.size(), 3); // object_id_, received_, sent_
+  // object_id_, received_, sent_, received_messages_, sent_messages_
+  EXPECT_EQ(s.items.size(), 5);
+  using MessageCounts = std::map<ElementIDType, uint64_t>;
+  EXPECT_EQ(std::get<MessageCounts>(s.items[3]), comm_1.getReceivedMessages());
+  EXPECT_EQ(std::get<MessageCounts>(s.items[4]), comm_1.getSentMessages());
 
   auto actual_object_id = std::get<PhaseType>(s.items[0]);
   EXPECT_EQ(actual_object_id, comm_1.getObjectId()); // object id
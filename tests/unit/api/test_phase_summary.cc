@@ -0,0 +1,216 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_phase_summary.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/api/phase_summary.h>
+
+#include "../generator.h"
+
+#include <cmath>
+#include <limits>
+
+namespace vt::tv::tests::unit::api {
+
+/**
+ * Provides unit tests for the vt::tv::api::PhaseSummary class
+ */
+struct PhaseSummaryTest : public ::testing::Test {
+  static constexpr PhaseType all_phases = std::numeric_limits<PhaseType>::max();
+
+  /**
+   * Make two ranks of two phases, phase 0 having an LB iteration; objects
+   * have a "color" everywhere but a "weight" only in phase 1, and ranks a
+   * "memory" everywhere
+   */
+  static Info makeInfo() {
+    auto object = [](ElementIDType id, TimeType load, double weight) {
+      std::unordered_map<std::string, QOIVariantTypes> user_defined = {
+        {"color", static_cast<int>(id % 2)}};
+      if (weight > 0) {
+        user_defined["weight"] = weight;
+      }
+      return std::make_pair(id, ObjectWork(id, load, {}, user_defined, {}));
+    };
+    auto o_0 = object(0, 3.0, 0.0);
+    o_0.second.addSentCommunications(1, 10.0);
+    auto const o_1 = object(1, 1.0, 0.0);
+    auto const o_2 = object(2, 2.0, 0.0);
+
+    PhaseWork phase_0_rank_0(0, {o_0, o_1}, {{"memory", 8}});
+    phase_0_rank_0.addLBIteration(
+      0, LBIteration(0, 0, {o_0}, {{"memory", 4}}));
+    PhaseWork phase_0_rank_1(0, {o_2}, {{"memory", 2}});
+    phase_0_rank_1.addLBIteration(
+      0, LBIteration(0, 0, {o_1, o_2}, {{"memory", 6}}));
+
+    std::vector<UniqueIndexBitType> idx;
+    return Info(
+      {{0, ObjectInfo(0, 0, true, idx)},
+       {1, ObjectInfo(1, 0, true, idx)},
+       {2, ObjectInfo(2, 1, false, idx)}},
+      {{0,
+        Rank(
+          0,
+          {{0, phase_0_rank_0},
+           {1,
+            PhaseWork(
+              1, {object(0, 5.0, 0.5), object(1, 1.0, 1.5)},
+              {{"memory", 1}})}})},
+       {1,
+        Rank(
+          1,
+          {{0, phase_0_rank_1},
+           {1, PhaseWork(1, {object(2, 2.0, 2.5)}, {{"memory", 3}})}})}});
+  }
+};
+
+TEST_F(PhaseSummaryTest, test_qoi_range_summary) {
+  QOIRangeSummary range;
+  EXPECT_TRUE(std::isinf(range.min));
+  range.add(2.0);
+  range.add(-1.0);
+  range.add(2.0);
+  EXPECT_EQ(range.min, -1.0);
+  EXPECT_EQ(range.max, 2.0);
+  EXPECT_EQ(range.support, (std::set<double>{-1.0, 2.0}));
+  EXPECT_FALSE(range.continuous);
+
+  // Beyond the largest support, values are continuous
+  QOIRangeSummary many;
+  for (std::size_t i = 0; i < QOIRangeSummary::max_support; i++) {
+    many.add(static_cast<double>(i));
+  }
+  EXPECT_FALSE(many.continuous);
+  range.merge(many);
+  EXPECT_TRUE(range.continuous);
+  EXPECT_TRUE(range.support.empty());
+  EXPECT_EQ(range.max, static_cast<double>(QOIRangeSummary::max_support - 1));
+  EXPECT_EQ(range.min, -1.0);
+}
+
+TEST_F(PhaseSummaryTest, test_phase_summary_of_info) {
+  Info info = makeInfo();
+  auto const raw = info.computePhaseSummary();
+  for (PhaseType phase = 0; phase < 2; phase++) {
+    info.normalizeEdges(phase);
+  }
+  auto const summary = info.computePhaseSummary();
+
+  EXPECT_EQ(summary.n_ranks, 2u);
+  EXPECT_EQ(summary.n_phases, 2u);
+  ASSERT_EQ(summary.frames.size(), 3u);
+  EXPECT_EQ(summary.frames[1].phase, 0u);
+  EXPECT_EQ(summary.frames[1].lb_iter, 0u);
+  EXPECT_EQ(summary.frames[2].lb_iter, no_lb_iter);
+  EXPECT_EQ(summary.getFrames(1).size(), 1u);
+
+  // Ranks hold loads of 4 and 2 in phase 0, then 3 and 3 after LB
+  auto const& frame = summary.frames[0];
+  EXPECT_EQ(frame.rank_qois.at("load"), (std::vector<double>{4.0, 2.0}));
+  EXPECT_EQ(
+    frame.rank_qois.at("number_of_migratable_objects"),
+    (std::vector<double>{2.0, 0.0}));
+  EXPECT_EQ(frame.rank_qois.at("sentinel_load"), (std::vector<double>{0, 2}));
+  EXPECT_EQ(frame.rank_qois.at("sent_volume"), (std::vector<double>{10, 0}));
+  EXPECT_EQ(frame.rank_qois.at("memory"), (std::vector<double>{8.0, 2.0}));
+  EXPECT_EQ(
+    summary.frames[1].rank_qois.at("load"), (std::vector<double>{3.0, 3.0}));
+
+  // Volumes are summarized from the edges as they are, here normalized as
+  // they are rendered
+  EXPECT_EQ(
+    frame.rank_qois.at("received_volume"), (std::vector<double>{10, 0}));
+  EXPECT_EQ(
+    raw.frames[0].rank_qois.at("received_volume"),
+    (std::vector<double>{0, 0}));
+
+  // Rank ranges span all frames, as computed from the data
+  for (std::string qoi :
+       {"load", "memory", "number_of_objects", "sentinel_load", "id"}) {
+    auto const range = summary.getRankQOIRange(qoi);
+    ASSERT_TRUE(range.has_value()) << qoi;
+    for (NodeType rank_id = 0; rank_id < 2; rank_id++) {
+      for (double value : info.getAllQOIAtRank(rank_id, qoi)) {
+        EXPECT_LE(range->first, value) << qoi;
+        EXPECT_GE(range->second, value) << qoi;
+      }
+    }
+  }
+  EXPECT_EQ(summary.getRankQOIRange("memory"), std::make_pair(1.0, 8.0));
+  EXPECT_FALSE(summary.getRankQOIRange("migrations_in").has_value());
+
+  // Object ranges and maxima of all or selected phases
+  auto const load = summary.getObjectQOIRange("load", all_phases);
+  ASSERT_TRUE(load.has_value());
+  EXPECT_EQ(load->min, 1.0);
+  EXPECT_EQ(load->max, 5.0);
+  EXPECT_EQ(load->support, (std::set<double>{1.0, 2.0, 3.0, 5.0}));
+  EXPECT_EQ(summary.getObjectQOIRange("load", 0)->max, 3.0);
+  EXPECT_EQ(summary.getObjectQOIRange("color", 0)->support.size(), 2u);
+  EXPECT_EQ(summary.getObjectQOIRange("rank_id", 1)->max, 1.0);
+  EXPECT_EQ(summary.getMaxObjectLoad(all_phases), info.getMaxLoad());
+  EXPECT_EQ(summary.getMaxObjectLoad(0), 3.0);
+  EXPECT_EQ(summary.getMaxObjectVolume(all_phases), info.getMaxVolume());
+  EXPECT_EQ(summary.getMaxObjectVolume(1), 0.0);
+
+  // A QOI missing from some objects is only summarized where all have it
+  EXPECT_FALSE(summary.getObjectQOIRange("weight", all_phases).has_value());
+  EXPECT_EQ(summary.getObjectQOIRange("weight", 1)->max, 2.5);
+  EXPECT_FALSE(summary.getObjectQOIRange("missing", all_phases).has_value());
+}
+
+TEST_F(PhaseSummaryTest, test_phase_summary_attached_to_info) {
+  Info info = makeInfo();
+  EXPECT_EQ(info.getPhaseSummary(), nullptr);
+
+  auto const summary =
+    std::make_shared<PhaseSummary const>(info.computePhaseSummary());
+  info.setPhaseSummary(summary);
+  EXPECT_EQ(info.getPhaseSummary(), summary);
+
+  // Adding a rank drops the summary, which no longer describes the data
+  info.addInfo({}, Rank(2, {{0, PhaseWork(0, {})}, {1, PhaseWork(1, {})}}));
+  EXPECT_EQ(info.getPhaseSummary(), nullptr);
+}
+
+} // namespace vt::tv::tests::unit::api
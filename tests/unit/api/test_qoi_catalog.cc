@@ -0,0 +1,184 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_qoi_catalog.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/api/qoi_catalog.h>
+
+#include "../generator.h"
+
+#include <cmath>
+
+namespace vt::tv::tests::unit::api {
+
+/**
+ * Provides unit tests for the vt::tv::api::QOICatalog class
+ */
+struct QOICatalogTest : public ::testing::Test {
+  /**
+   * Make an object with user-defined and attribute QOIs
+   */
+  static std::pair<ElementIDType, ObjectWork> object(
+    ElementIDType id,
+    std::unordered_map<std::string, QOIVariantTypes> user_defined,
+    std::unordered_map<std::string, QOIVariantTypes> attributes = {}) {
+    return {id, ObjectWork(id, 1.0, {}, user_defined, attributes)};
+  }
+
+  /**
+   * Make two ranks of two phases, phase 0 of rank 0 having an LB iteration
+   */
+  static Info makeInfo() {
+    PhaseWork phase_0_rank_0(
+      0, {object(0, {{"count", 1}, {"label", std::string("a")}})},
+      {{"memory", 8.0}});
+    phase_0_rank_0.addLBIteration(
+      0, LBIteration(0, 0, {object(0, {{"count", 3}})}, {{"memory", 2.0}}));
+    Rank rank_0(
+      0,
+      {{0, phase_0_rank_0},
+       {1, PhaseWork(1, {object(0, {{"count", 2}, {"weight", 0.5}})})}},
+      {{"node", 0}});
+    Rank rank_1(
+      1,
+      {{0, PhaseWork(0, {object(1, {{"count", 4.5}}, {{"color", 1}})})},
+       {1, PhaseWork(1, {object(1, {{"label", 7}})}, {{"memory", 4}})}},
+      {{"node", std::string("n1")}});
+
+    std::vector<UniqueIndexBitType> idx = {0};
+    return Info(
+      {{0, ObjectInfo(0, 0, true, idx)}, {1, ObjectInfo(1, 1, true, idx)}},
+      {{0, rank_0}, {1, rank_1}});
+  }
+};
+
+TEST_F(QOICatalogTest, test_qoi_key_info_types) {
+  QOIKeyInfo ints;
+  EXPECT_EQ(ints.count, 0u);
+  EXPECT_TRUE(std::isinf(ints.min));
+  ints.add(3);
+  ints.add(-1);
+  EXPECT_EQ(ints.type, QOIValueType::Int);
+  EXPECT_EQ(ints.count, 2u);
+  EXPECT_EQ(ints.min, -1.0);
+  EXPECT_EQ(ints.max, 3.0);
+  EXPECT_TRUE(ints.isNumeric());
+
+  // Integers and doubles are doubles, numbers and strings are mixed
+  QOIKeyInfo numbers = ints;
+  numbers.add(0.5);
+  EXPECT_EQ(numbers.type, QOIValueType::Double);
+  QOIKeyInfo strings;
+  strings.add(std::string("x"));
+  EXPECT_EQ(strings.type, QOIValueType::String);
+  EXPECT_FALSE(strings.isNumeric());
+  EXPECT_TRUE(std::isinf(strings.max));
+
+  QOIKeyInfo merged;
+  merged.merge(strings);
+  EXPECT_EQ(merged.type, QOIValueType::String);
+  merged.merge(numbers);
+  EXPECT_EQ(merged.type, QOIValueType::Mixed);
+  EXPECT_EQ(merged.count, 4u);
+  EXPECT_EQ(merged.min, -1.0);
+  EXPECT_EQ(merged.max, 3.0);
+  EXPECT_EQ(QOIKeyInfo::getTypeName(merged.type), "mixed");
+}
+
+TEST_F(QOICatalogTest, test_qoi_catalog_of_info) {
+  Info const info = makeInfo();
+  auto const catalog = info.getQOICatalog();
+
+  // Rank user-defined QOIs of phases and LB iterations
+  ASSERT_EQ(catalog->rank_user_defined.size(), 1u);
+  auto const& memory = catalog->rank_user_defined.at("memory");
+  EXPECT_EQ(memory.type, QOIValueType::Double);
+  EXPECT_EQ(memory.count, 3u);
+  EXPECT_EQ(memory.min, 2.0);
+  EXPECT_EQ(memory.max, 8.0);
+  EXPECT_TRUE(memory.hasFrame(0, no_lb_iter));
+  EXPECT_TRUE(memory.hasFrame(0, 0));
+  EXPECT_TRUE(memory.hasFrame(1, no_lb_iter));
+  EXPECT_EQ(memory.getPhases(), (std::set<PhaseType>{0, 1}));
+
+  // Rank attributes do not depend on the phase
+  auto const& node = catalog->rank_attributes.at("node");
+  EXPECT_EQ(node.type, QOIValueType::Mixed);
+  EXPECT_TRUE(node.frames.empty());
+
+  auto const& objects = catalog->object_user_defined;
+  ASSERT_EQ(objects.size(), 3u);
+  EXPECT_EQ(objects.at("count").type, QOIValueType::Double);
+  EXPECT_EQ(objects.at("count").count, 4u);
+  EXPECT_EQ(objects.at("count").max, 4.5);
+  EXPECT_EQ(objects.at("label").type, QOIValueType::Mixed);
+  EXPECT_EQ(objects.at("weight").type, QOIValueType::Double);
+  EXPECT_EQ(objects.at("weight").getPhases(), (std::set<PhaseType>{1}));
+  EXPECT_FALSE(objects.at("weight").hasFrame(0, no_lb_iter));
+  EXPECT_EQ(catalog->object_attributes.at("color").type, QOIValueType::Int);
+
+  EXPECT_NE(QOICatalog::find(objects, "count"), nullptr);
+  EXPECT_EQ(QOICatalog::find(objects, "missing"), nullptr);
+  EXPECT_TRUE(info.hasRankUserDefined("memory"));
+  EXPECT_FALSE(info.hasRankUserDefined("count"));
+}
+
+TEST_F(QOICatalogTest, test_qoi_catalog_is_computed_once) {
+  Info info = makeInfo();
+  auto const catalog = info.getQOICatalog();
+  EXPECT_EQ(info.getQOICatalog(), catalog);
+
+  // Copies compute their own catalog
+  Info const copy = info;
+  EXPECT_NE(copy.getQOICatalog(), catalog);
+
+  // Adding a rank invalidates the catalog
+  info.addInfo(
+    {}, Rank(2, {{0, PhaseWork(0, {object(2, {})}, {{"cores", 48}})}}));
+  auto const updated = info.getQOICatalog();
+  EXPECT_NE(updated, catalog);
+  EXPECT_EQ(updated->rank_user_defined.size(), 2u);
+  EXPECT_EQ(updated->rank_user_defined.at("cores").type, QOIValueType::Int);
+  EXPECT_EQ(catalog->rank_user_defined.size(), 1u);
+}
+
+} // namespace vt::tv::tests::unit::api
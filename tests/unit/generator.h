@@ -52,6 +52,8 @@
 #include <vt-tv/utility/json_reader.h>
 #include <yaml-cpp/yaml.h>
 
+#include <random>
+
 #include "util.h"
 
 namespace vt::tv::tests::unit {
@@ -160,6 +162,54 @@ public:
     return Info(makeObjectInfoMap(objects), ranks);
   }
 
+  /**
+   * Make an Info instance with distinct objects on each rank, each sending
+   * messages to objects drawn at random among all ranks
+   */
+  static Info makeCommunicatingInfo(
+    uint64_t num_ranks,
+    uint64_t num_objects_per_rank,
+    uint64_t num_phases,
+    uint64_t num_edges_per_object,
+    unsigned int seed = 0) {
+    uint64_t const num_objects = num_ranks * num_objects_per_rank;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint64_t> receiver(
+      0, num_objects == 0 ? 0 : num_objects - 1);
+    std::uniform_real_distribution<double> bytes(1.0, 1024.0);
+
+    auto object_info_map = std::unordered_map<ElementIDType, ObjectInfo>();
+    auto rank_map = std::unordered_map<NodeType, Rank>();
+    std::vector<UniqueIndexBitType> idx;
+    for (uint64_t rank_id = 0; rank_id < num_ranks; rank_id++) {
+      auto phase_map = std::unordered_map<PhaseType, PhaseWork>();
+      for (uint64_t phase_id = 0; phase_id < num_phases; phase_id++) {
+        auto object_work_map = std::unordered_map<ElementIDType, ObjectWork>();
+        for (uint64_t i = 0; i < num_objects_per_rank; i++) {
+          ElementIDType const object_id = rank_id * num_objects_per_rank + i;
+          // Loads depend on the rank so that phases are imbalanced
+          auto object_work = ObjectWork(
+            object_id, 1.0 + static_cast<double>(rank_id % 4) + 0.01 * i, {});
+          for (uint64_t e = 0; num_objects > 1 && e < num_edges_per_object;
+               e++) {
+            ElementIDType to_id = receiver(gen);
+            while (to_id == object_id) {
+              to_id = receiver(gen);
+            }
+            object_work.addSentCommunications(to_id, bytes(gen));
+          }
+          object_work_map.insert(std::make_pair(object_id, object_work));
+          object_info_map.insert(std::make_pair(
+            object_id, ObjectInfo(object_id, rank_id, true, idx)));
+        }
+        phase_map.insert(
+          std::make_pair(phase_id, makePhase(phase_id, object_work_map)));
+      }
+      rank_map.insert(std::make_pair(rank_id, Rank(rank_id, phase_map)));
+    }
+    return Info(object_info_map, rank_map);
+  }
+
   static Info loadInfoFromConfig(YAML::Node config) {
     using JSONReader = ::vt::tv::utility::JSONReader;
 
@@ -45,6 +45,7 @@
 
 #include <vt-tv/utility/parse_render.h>
 
+#include <fstream>
 #include <regex>
 
 #include <vtkCellData.h>
@@ -106,6 +107,57 @@ TEST_P(ParseRenderTest, test_parse_render_no_png_generates_mesh_files_only) {
   } // end phases loop
 }
 
+/**
+ * Test ParseRender:parseAndRender only writes the analytics report when no
+ * mesh or image is requested
+ */
+TEST_P(ParseRenderTest, test_parse_render_analytics_only) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  auto output_dir = Util::resolveDir(
+    SRC_DIR, config["output"]["directory"].as<std::string>(), true);
+  std::filesystem::create_directories(output_dir);
+
+  auto output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_analytics_only";
+  config["output"]["file_stem"] = output_file_stem;
+  config["output"]["analytics"] = "csv";
+  config["viz"]["save_meshes"] = false;
+  config["viz"]["save_pngs"] = false;
+
+  auto const analytics_config = output_dir + output_file_stem + ".yaml";
+  {
+    std::ofstream os(analytics_config);
+    os << config;
+  }
+  auto parse_render = ParseRender(analytics_config);
+  ASSERT_NO_THROW(parse_render.parseAndRender());
+
+  auto const report_file = output_dir + output_file_stem + "_analytics.csv";
+  ASSERT_TRUE(std::filesystem::exists(report_file))
+    << fmt::format("Error: report not generated at {}", report_file);
+
+  // A header, then one line per phase and LB iteration
+  uint64_t n_frames = 0;
+  for (PhaseType phase = 0; phase < info.getNumPhases(); phase++) {
+    n_frames += 1 +
+      info.getRank(0).getPhaseWork().at(phase).getLBIterations().size();
+  }
+  std::ifstream report(report_file);
+  uint64_t n_lines = 0;
+  for (std::string line; std::getline(report, line);) {
+    n_lines++;
+  }
+  EXPECT_EQ(n_lines, n_frames + 1);
+
+  auto rank_mesh_file =
+    fmt::format("{}{}_rank_mesh_0.vtp", output_dir, output_file_stem);
+  EXPECT_FALSE(std::filesystem::exists(rank_mesh_file));
+}
+
 /* Run with different configuration files */
 INSTANTIATE_TEST_SUITE_P(
   ParseRenderTests,
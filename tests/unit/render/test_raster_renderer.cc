@@ -0,0 +1,146 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_raster_renderer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/render/color_map.h>
+#include <vt-tv/render/raster_renderer.h>
+
+#include "../util.h"
+
+#include <set>
+#include <variant>
+
+namespace vt::tv::tests::unit::render {
+
+/**
+ * Provides unit tests for the vt::tv::RasterRenderer and vt::tv::ColorMap
+ * classes
+ */
+struct RasterRendererTest : public ::testing::Test {
+  static std::array<uint8_t, 3>
+  pixelAt(RasterRenderer const& r, uint32_t x, uint32_t y) {
+    auto const& px = r.getPixels();
+    auto const i = (static_cast<std::size_t>(y) * r.getWidth() + x) *
+      RasterRenderer::getChannels();
+    return {px[i], px[i + 1], px[i + 2]};
+  }
+};
+
+TEST_F(RasterRendererTest, test_color_map_continuous) {
+  ColorMap cm(std::make_pair(0.0, 2.0));
+  EXPECT_FALSE(cm.isIndexed());
+  EXPECT_EQ(cm.getControlPoints().size(), 3u);
+
+  auto const mid = cm.getColor(1.0);
+  EXPECT_DOUBLE_EQ(mid[0], .98);
+  EXPECT_DOUBLE_EQ(mid[1], .992);
+  EXPECT_DOUBLE_EQ(mid[2], .059);
+
+  auto const below = cm.getColor(-1.0);
+  EXPECT_DOUBLE_EQ(below[0], 0.8);
+  auto const above = cm.getColor(3.0);
+  EXPECT_DOUBLE_EQ(above[0], 1.0);
+  EXPECT_DOUBLE_EQ(above[1], 0.0);
+
+  // Diverging interpolation reaches the end points exactly
+  ColorMap diverging(std::make_pair(0.0, 1.0), ColorType::BlueToRed);
+  EXPECT_TRUE(diverging.isDiverging());
+  auto const low = diverging.getColor(0.0);
+  EXPECT_NEAR(low[0], .231, 1e-3);
+  EXPECT_NEAR(low[1], .298, 1e-3);
+  EXPECT_NEAR(low[2], .753, 1e-3);
+}
+
+TEST_F(RasterRendererTest, test_color_map_indexed) {
+  std::set<std::variant<double, int>> values = {0, 1, 2};
+  ColorMap cm(values);
+  EXPECT_TRUE(cm.isIndexed());
+
+  auto const c1 = cm.getColor(1.0);
+  auto const tab1 = ColorMap::getTab20Color(1);
+  EXPECT_DOUBLE_EQ(c1[0], tab1[0]);
+  EXPECT_DOUBLE_EQ(c1[3], 1.0);
+
+  // Values outside the support are transparent
+  EXPECT_DOUBLE_EQ(cm.getColor(7.0)[3], 0.0);
+  EXPECT_THROW(ColorMap::getTab20Color(20), std::runtime_error);
+}
+
+TEST_F(RasterRendererTest, test_primitives) {
+  RasterRenderer r(100, 100);
+  // One world unit per pixel, world origin at the image center
+  r.setView(0.0, 0.0, 100.0);
+  r.addRect(-10.0, -10.0, 10.0, 10.0, {1.0, 0.0, 0.0, 1.0});
+  r.addCircle(30.0, 30.0, 5.0, {0.0, 1.0, 0.0, 1.0});
+  r.addLine(-40.0, -40.0, -20.0, -40.0, 3.0, {0.0, 0.0, 1.0, 1.0});
+  r.render();
+
+  EXPECT_EQ(pixelAt(r, 50, 50), (std::array<uint8_t, 3>{255, 0, 0}));
+  EXPECT_EQ(pixelAt(r, 39, 50), (std::array<uint8_t, 3>{255, 255, 255}));
+  // World Y axis points up in the image
+  EXPECT_EQ(pixelAt(r, 80, 20), (std::array<uint8_t, 3>{0, 255, 0}));
+  EXPECT_EQ(pixelAt(r, 80, 80), (std::array<uint8_t, 3>{255, 255, 255}));
+  EXPECT_EQ(pixelAt(r, 20, 90), (std::array<uint8_t, 3>{0, 0, 255}));
+  EXPECT_EQ(pixelAt(r, 20, 93), (std::array<uint8_t, 3>{255, 255, 255}));
+}
+
+TEST_F(RasterRendererTest, test_painter_order_and_legends) {
+  RasterRenderer r(200, 200);
+  r.setView(0.0, 0.0, 2.0);
+  r.addRect(-1.0, -1.0, 1.0, 1.0, {0.0, 0.0, 0.0, 1.0});
+  r.addRect(-0.5, -0.5, 0.5, 0.5, {1.0, 1.0, 0.0, 1.0});
+  r.addText("Phase: 0/1", 0.04, 0.91, 20, {0.0, 1.0, 1.0, 1.0});
+  r.addColorBar(
+    ColorMap(std::make_pair(0.0, 1.0)), "Rank load", 0.5, 0.9, 0.42, 0.08, 20);
+  r.render();
+
+  // Later primitives are drawn over earlier ones
+  EXPECT_EQ(pixelAt(r, 100, 100), (std::array<uint8_t, 3>{255, 255, 0}));
+  EXPECT_EQ(pixelAt(r, 10, 190), (std::array<uint8_t, 3>{0, 0, 0}));
+
+  auto const [w, h] = RasterRenderer::getTextSize("Phase: 0/1", 20);
+  EXPECT_GT(w, 0u);
+  EXPECT_GT(h, 0u);
+  EXPECT_EQ(RasterRenderer::getTextSize("ab\ncd", 20).second, 2u * (11 + 7));
+}
+
+} // namespace vt::tv::tests::unit::render
@@ -48,8 +48,10 @@
 #include <vtkPolyData.h>
 #include <vtkPolyDataReader.h>
 #include <vtkXMLPolyDataReader.h>
+#include <vtk_exodusII.h>
 
 #include <vt-tv/render/render.h>
+#include <vt-tv/utility/info_loader.h>
 #include <vt-tv/utility/json_reader.h>
 #include <vt-tv/utility/parse_render.h>
 
@@ -74,12 +76,14 @@ protected:
     output_dir = Util::resolveDir(
       SRC_DIR, config["output"]["directory"].as<std::string>(), true);
     // Logic copied from the ParseRender class here
+    utility::InfoLoader::selectPhase(
+      info, std::numeric_limits<PhaseType>::max());
     return Render(
       {config["viz"]["rank_qoi"].as<std::string>(),
        "",
        config["viz"]["object_qoi"].as<std::string>()},
       config["viz"]["force_continuous_object_qoi"].as<bool>(),
-      info,
+      std::make_shared<Info const>(std::move(info)),
       {config["viz"]["x_ranks"].as<uint64_t>(),
        config["viz"]["y_ranks"].as<uint64_t>(),
        config["viz"]["z_ranks"].as<uint64_t>()},
@@ -333,6 +337,570 @@ TEST_P(RenderTest, test_render_from_config_with_png) {
 }
 
 /* Run with different configuration files */
+/**
+ * Test Render:generate with the raster renderer and the built-in encoder,
+ * written by background threads, produces valid PNG images
+ */
+TEST_P(RenderTest, test_render_from_config_with_raster_png) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  // Do not overwrite the images of the VTK renderer
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_raster";
+  config["output"]["file_stem"] = output_file_stem;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+  render.setRendererType(Render::getRendererType("raster"));
+  render.setPNGEncoder(Render::getPNGEncoderType("builtin"), 2);
+  render.setAsyncWriters(2, 1);
+  std::filesystem::create_directories(output_dir);
+
+  render.generate(50, 2000);
+
+  auto const signature = utility::PNGEncoder::signature();
+  for (uint64_t i = 0; i < info.getNumPhases(); i++) {
+    auto png_file = fmt::format("{}{}{}.png", output_dir, output_file_stem, i);
+    ASSERT_TRUE(std::filesystem::exists(png_file))
+      << fmt::format("Error: PNG image not generated at {}", png_file);
+
+    std::ifstream png(png_file, std::ios::binary);
+    std::vector<uint8_t> header(signature.size());
+    png.read(reinterpret_cast<char*>(header.data()), header.size());
+    EXPECT_EQ(header, signature) << "Invalid PNG signature in " << png_file;
+  }
+
+  EXPECT_THROW(Render::getRendererType("opengl"), std::runtime_error);
+  EXPECT_THROW(Render::getPNGEncoderType("lodepng"), std::runtime_error);
+  EXPECT_THROW(
+    render.setPNGEncoder(PNGEncoderType::VTK, 10), std::runtime_error);
+}
+
+/**
+ * Test Render:generate streams all frames into a single animation file
+ */
+TEST_P(RenderTest, test_render_from_config_with_animation) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_animation";
+  config["output"]["file_stem"] = output_file_stem;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+  render.setRendererType(RendererType::Raster);
+  render.setAnimation(Render::getAnimationFormat("apng"), 5);
+  std::filesystem::create_directories(output_dir);
+  std::filesystem::remove(output_dir + output_file_stem + "0.png");
+
+  render.generate(50, 500);
+
+  // No per-frame image is written
+  EXPECT_FALSE(
+    std::filesystem::exists(output_dir + output_file_stem + "0.png"));
+
+  auto apng_file = output_dir + output_file_stem + ".apng";
+  ASSERT_TRUE(std::filesystem::exists(apng_file))
+    << fmt::format("Error: animation not generated at {}", apng_file);
+
+  // The acTL chunk directly follows IHDR and holds the number of frames
+  std::ifstream apng(apng_file, std::ios::binary);
+  std::vector<uint8_t> header(49);
+  apng.read(reinterpret_cast<char*>(header.data()), header.size());
+  EXPECT_EQ(std::string(header.begin() + 37, header.begin() + 41), "acTL");
+  uint32_t n_frames = (header[41] << 24) | (header[42] << 16) |
+    (header[43] << 8) | header[44];
+  EXPECT_GE(n_frames, info.getNumPhases());
+
+  EXPECT_THROW(Render::getAnimationFormat("gif"), std::runtime_error);
+}
+
+/**
+ * Test Render:generate writes raw binary, LZ4-compressed meshes holding the
+ * same data as the expected meshes
+ */
+TEST_P(RenderTest, test_render_from_config_with_raw_vtp) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>();
+  config["output"]["file_stem"] = output_file_stem + "_raw";
+  config["viz"]["save_pngs"] = false;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+  render.setVTPOutput(
+    Render::getVTPEncodingType("raw"), Render::getVTPCompressorType("lz4"), 9);
+  std::filesystem::create_directories(output_dir);
+
+  render.generate(50, 2000);
+
+  for (uint64_t i = 0; i < info.getNumPhases(); i++) {
+    for (std::string mesh : {"rank_mesh", "object_mesh"}) {
+      auto mesh_file = fmt::format(
+        "{}{}_raw_{}_{}.vtp", output_dir, output_file_stem, mesh, i);
+      auto expected_mesh_file = fmt::format(
+        "{}/tests/expected/{}/{}_{}_{}.vtp",
+        SRC_DIR,
+        output_file_stem,
+        output_file_stem,
+        mesh,
+        i);
+      ASSERT_TRUE(std::filesystem::exists(mesh_file))
+        << fmt::format("Error: mesh not generated at {}", mesh_file);
+
+      auto content = Util::getFileContent(mesh_file);
+      EXPECT_NE(
+        content.find("compressor=\"vtkLZ4DataCompressor\""), std::string::npos);
+      EXPECT_NE(content.find("encoding=\"raw\""), std::string::npos);
+
+      vtkNew<vtkXMLPolyDataReader> expected_reader;
+      expected_reader->SetFileName(expected_mesh_file.c_str());
+      expected_reader->Update();
+
+      vtkNew<vtkXMLPolyDataReader> reader;
+      reader->SetFileName(mesh_file.c_str());
+      reader->Update();
+
+      this->assertPolyEquals(reader->GetOutput(), expected_reader->GetOutput());
+    }
+  }
+
+  EXPECT_THROW(Render::getVTPEncodingType("ascii"), std::runtime_error);
+  EXPECT_THROW(Render::getVTPCompressorType("lzma"), std::runtime_error);
+  EXPECT_THROW(
+    render.setVTPOutput(VTPEncodingType::Raw, VTPCompressorType::ZLib, 0),
+    std::runtime_error);
+}
+
+/**
+ * Test Render:generate indexes the meshes of all frames in a PVD collection
+ */
+TEST_P(RenderTest, test_render_from_config_with_pvd_collection) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_series";
+  config["output"]["file_stem"] = output_file_stem;
+  config["viz"]["save_pngs"] = false;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+  render.setMeshCollection(Render::getMeshCollectionType("pvd"));
+  render.setAsyncWriters(2, 2);
+  std::filesystem::create_directories(output_dir);
+
+  render.generate(50, 2000);
+
+  auto pvd_file = output_dir + output_file_stem + ".pvd";
+  ASSERT_TRUE(std::filesystem::exists(pvd_file))
+    << fmt::format("Error: collection not generated at {}", pvd_file);
+
+  // Every frame has an object mesh and a rank mesh, referenced relatively
+  auto const content = Util::getFileContent(pvd_file);
+  std::regex const data_set(
+    R"re(<DataSet timestep="(\d+)" group="" part="([01])" )re"
+    R"re(name="(\w+)" file="([^"]+)"/>)re");
+  std::set<std::string> files;
+  for (auto it = std::sregex_iterator(content.begin(), content.end(), data_set);
+       it != std::sregex_iterator(); ++it) {
+    auto const& match = *it;
+    auto const name = match[2].str() == "0" ? "object_mesh" : "rank_mesh";
+    EXPECT_EQ(match[3].str(), name);
+    EXPECT_EQ(
+      match[4].str(),
+      fmt::format("{}_{}_{}.vtp", output_file_stem, name, match[1].str()));
+    EXPECT_TRUE(std::filesystem::exists(output_dir + match[4].str()));
+    files.insert(match[4].str());
+  }
+  EXPECT_GE(files.size(), 2 * info.getNumPhases());
+
+  EXPECT_THROW(Render::getMeshCollectionType("hdf"), std::runtime_error);
+}
+
+TEST_P(RenderTest, test_render_from_config_with_exodus) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_exodus";
+  config["output"]["file_stem"] = output_file_stem;
+  config["viz"]["save_meshes"] = false;
+  config["viz"]["save_pngs"] = false;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+  render.setSaveExodus(true);
+  std::filesystem::create_directories(output_dir);
+
+  render.generate(50, 2000);
+
+  auto exodus_file = output_dir + output_file_stem + ".exo";
+  ASSERT_TRUE(std::filesystem::exists(exodus_file))
+    << fmt::format("Error: Exodus file not generated at {}", exodus_file);
+
+  // Each phase and LB iteration is a time step
+  int64_t n_frames = 0;
+  for (PhaseType phase = 0; phase < info.getNumPhases(); phase++) {
+    n_frames += 1 +
+      info.getRank(0).getPhaseWork().at(phase).getLBIterations().size();
+  }
+  int const n_objects = static_cast<int>(info.getAllObjectIDs().size());
+  int const n_ranks = static_cast<int>(info.getNumRanks());
+
+  int comp_ws = sizeof(double);
+  int io_ws = 0;
+  float version = 0;
+  int const exoid =
+    ex_open(exodus_file.c_str(), EX_READ, &comp_ws, &io_ws, &version);
+  ASSERT_GE(exoid, 0);
+
+  char title[MAX_LINE_LENGTH + 1] = {};
+  int n_dim = 0, n_nodes = 0, n_elements = 0, n_blocks = 0, n_ns = 0, n_ss = 0;
+  ex_get_init(
+    exoid, title, &n_dim, &n_nodes, &n_elements, &n_blocks, &n_ns, &n_ss);
+  EXPECT_EQ(n_nodes, n_ranks + n_objects);
+  EXPECT_EQ(n_blocks, 2);
+  EXPECT_EQ(ex_inquire_int(exoid, EX_INQ_TIME), n_frames);
+
+  std::vector<double> globals(3);
+  ex_get_var(exoid, n_frames, EX_GLOBAL, 1, 1, 3, globals.data());
+  EXPECT_EQ(globals[0], info.getNumPhases() - 1.0);
+  ex_close(exoid);
+}
+
+/**
+ * Test tile meshes aggregate the ranks, objects and communications of the
+ * rank and object meshes
+ */
+TEST_P(RenderTest, test_render_tile_meshes) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+
+  auto sum = [](vtkDataArray* array) {
+    double total = 0.0;
+    for (vtkIdType i = 0; i < array->GetNumberOfTuples(); i++) {
+      total += array->GetTuple1(i);
+    }
+    return total;
+  };
+
+  for (PhaseType phase = 0; phase < info.getNumPhases(); phase++) {
+    auto object_mesh = render.createObjectMesh_(phase, no_lb_iter);
+    double const object_load =
+      sum(object_mesh->GetPointData()->GetArray("load"));
+    double const object_volume =
+      sum(object_mesh->GetCellData()->GetScalars());
+
+    // A tile per rank keeps the rank QOI, a single tile holds everything
+    for (uint64_t tile_size : {1, 2}) {
+      auto [tile_mesh, tile_object_mesh] =
+        render.createTileMeshes_(phase, no_lb_iter, tile_size);
+      vtkIdType const n_tiles =
+        tile_size == 1 ? static_cast<vtkIdType>(info.getNumRanks()) : 1;
+      ASSERT_EQ(tile_mesh->GetNumberOfPoints(), n_tiles);
+      ASSERT_EQ(tile_object_mesh->GetNumberOfPoints(), n_tiles);
+
+      auto tile_data = tile_mesh->GetPointData();
+      auto object_data = tile_object_mesh->GetPointData();
+      EXPECT_EQ(sum(tile_data->GetArray("n_ranks")), info.getNumRanks());
+      EXPECT_EQ(
+        sum(object_data->GetArray("n_objects")),
+        object_mesh->GetNumberOfPoints());
+      EXPECT_NEAR(
+        sum(object_data->GetArray("total_load")), object_load,
+        1e-9 * std::max(1.0, object_load));
+
+      // Volumes are either internal to a tile or carried by tile edges
+      double const tile_volume =
+        sum(object_data->GetArray("internal_volume")) +
+        sum(tile_object_mesh->GetCellData()->GetScalars());
+      EXPECT_NEAR(
+        tile_volume, object_volume, 1e-9 * std::max(1.0, object_volume));
+      if (n_tiles == 1) {
+        EXPECT_EQ(tile_object_mesh->GetNumberOfLines(), 0);
+      }
+
+      double rank_qoi_max = 0.0;
+      for (uint64_t rank_id = 0; rank_id < info.getNumRanks(); rank_id++) {
+        double const qoi = info.getRankQOIAtPhase<double>(
+          rank_id, phase, no_lb_iter,
+          config["viz"]["rank_qoi"].as<std::string>());
+        rank_qoi_max = std::max(rank_qoi_max, qoi);
+        if (tile_size == 1) {
+          EXPECT_EQ(tile_data->GetScalars()->GetTuple1(rank_id), qoi);
+        }
+      }
+      if (tile_size == 2) {
+        EXPECT_EQ(tile_data->GetScalars()->GetTuple1(0), rank_qoi_max);
+      }
+    }
+  }
+
+  EXPECT_THROW(
+    render.createTileMeshes_(0, no_lb_iter, 0), std::runtime_error);
+}
+
+/**
+ * Test the edge budget keeps the largest communication edges
+ */
+TEST_P(RenderTest, test_render_object_mesh_edge_selection) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+  auto getVolumes = [](vtkPolyData* mesh) {
+    std::vector<double> volumes;
+    auto bytes = mesh->GetCellData()->GetScalars();
+    for (vtkIdType e = 0; e < bytes->GetNumberOfTuples(); e++) {
+      volumes.push_back(bytes->GetTuple1(e));
+    }
+    return volumes;
+  };
+
+  for (PhaseType phase = 0; phase < info.getNumPhases(); phase++) {
+    auto const all = getVolumes(render.createObjectMesh_(phase, no_lb_iter));
+    if (all.empty()) {
+      continue;
+    }
+
+    utility::EdgeSelection selection;
+    selection.top_k = 1;
+    render.setEdgeSelection(selection);
+    auto const top = getVolumes(render.createObjectMesh_(phase, no_lb_iter));
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0], *std::max_element(all.begin(), all.end()));
+
+    selection.top_k = 0;
+    selection.min_volume = top[0];
+    render.setEdgeSelection(selection);
+    auto const above =
+      getVolumes(render.createObjectMesh_(phase, no_lb_iter));
+    EXPECT_EQ(
+      above.size(),
+      static_cast<std::size_t>(
+        std::count_if(all.begin(), all.end(), [&](double v) {
+          return v >= top[0];
+        })));
+
+    selection.min_volume = 0.0;
+    selection.inter_rank_only = true;
+    render.setEdgeSelection(selection);
+    EXPECT_LE(
+      getVolumes(render.createObjectMesh_(phase, no_lb_iter)).size(),
+      all.size());
+    render.setEdgeSelection({});
+  }
+
+  utility::EdgeSelection negative;
+  negative.min_volume = -1.0;
+  EXPECT_THROW(render.setEdgeSelection(negative), std::runtime_error);
+}
+
+/**
+ * Test the rank communication mesh folds all object communications over
+ * pairs of ranks
+ */
+TEST_P(RenderTest, test_render_rank_communication_mesh) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_rank_comm";
+  config["output"]["file_stem"] = output_file_stem;
+  config["viz"]["save_pngs"] = false;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+
+  auto sum = [](vtkDataArray* array) {
+    double total = 0.0;
+    for (vtkIdType i = 0; i < array->GetNumberOfTuples(); i++) {
+      total += array->GetTuple1(i);
+    }
+    return total;
+  };
+
+  // Messages are counted in the data as rendered, with normalized edges
+  Info const& rendered = *render.getInfo();
+  for (PhaseType phase = 0; phase < info.getNumPhases(); phase++) {
+    double n_messages = 0;
+    for (auto const& [rank_id, rank] : rendered.getRanks()) {
+      for (auto const& [obj_id, obj_work] :
+           rendered.getWorkDistribution(rank, phase, no_lb_iter)
+             .getObjectWork()) {
+        n_messages += obj_work.getNumSentMessages();
+      }
+    }
+    auto object_mesh = render.createObjectMesh_(phase, no_lb_iter);
+    double const volume = sum(object_mesh->GetCellData()->GetScalars());
+
+    auto mesh = render.createRankCommunicationMesh_(phase, no_lb_iter);
+    ASSERT_EQ(
+      mesh->GetNumberOfPoints(), static_cast<vtkIdType>(info.getNumRanks()));
+    vtkCellData* cell_data = mesh->GetCellData();
+    vtkPointData* point_data = mesh->GetPointData();
+    EXPECT_DOUBLE_EQ(
+      sum(cell_data->GetArray("bytes")) +
+        sum(point_data->GetArray("internal_bytes")),
+      volume);
+    EXPECT_EQ(
+      sum(cell_data->GetArray("messages")) +
+        sum(point_data->GetArray("internal_messages")),
+      n_messages);
+
+    // Lines join distinct ranks, each pair at most once
+    std::set<std::pair<vtkIdType, vtkIdType>> pairs;
+    for (vtkIdType l = 0; l < mesh->GetNumberOfCells(); l++) {
+      vtkNew<vtkIdList> ids;
+      mesh->GetCellPoints(l, ids);
+      ASSERT_EQ(ids->GetNumberOfIds(), 2);
+      EXPECT_LT(ids->GetId(0), ids->GetId(1));
+      EXPECT_TRUE(pairs.emplace(ids->GetId(0), ids->GetId(1)).second);
+    }
+
+    // The directed matrix holds the same totals, rows in rank order
+    vtkFieldData* field_data = mesh->GetFieldData();
+    EXPECT_DOUBLE_EQ(sum(field_data->GetArray("sent_bytes")), volume);
+    EXPECT_EQ(sum(field_data->GetArray("sent_messages")), n_messages);
+    vtkDataArray* senders = field_data->GetArray("sender");
+    for (vtkIdType e = 1; e < senders->GetNumberOfTuples(); e++) {
+      EXPECT_LE(senders->GetTuple1(e - 1), senders->GetTuple1(e));
+    }
+  }
+
+  // The mesh is written along with the rank and object meshes
+  render.setSaveRankCommunication(true);
+  std::filesystem::create_directories(output_dir);
+  render.generate(50, 2000);
+  for (uint64_t i = 0; i < info.getNumPhases(); i++) {
+    auto mesh_file = fmt::format(
+      "{}{}_rank_comm_mesh_{}.vtp", output_dir, output_file_stem, i);
+    EXPECT_TRUE(std::filesystem::exists(mesh_file))
+      << fmt::format("Error: mesh not generated at {}", mesh_file);
+  }
+}
+
+/**
+ * Test the migration mesh draws the migrations from the previous frame
+ */
+TEST_P(RenderTest, test_render_migration_mesh) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_migration";
+  config["output"]["file_stem"] = output_file_stem;
+  config["viz"]["save_pngs"] = false;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+
+  for (PhaseType phase = 0; phase < info.getNumPhases(); phase++) {
+    auto const diff = info.getMigrationDiff(phase, no_lb_iter);
+    auto mesh = render.createMigrationMesh_(phase, no_lb_iter);
+    ASSERT_EQ(
+      mesh->GetNumberOfCells(),
+      static_cast<vtkIdType>(diff->migrations.size()));
+    ASSERT_EQ(mesh->GetNumberOfPoints(), 2 * mesh->GetNumberOfCells());
+
+    // Arrows go from the former rank to the new one
+    vtkDataArray* vectors = mesh->GetPointData()->GetVectors();
+    vtkDataArray* loads = mesh->GetCellData()->GetScalars();
+    for (vtkIdType m = 0; m < mesh->GetNumberOfCells(); m++) {
+      double from[3], to[3], vector[3];
+      mesh->GetPoint(2 * m, from);
+      mesh->GetPoint(2 * m + 1, to);
+      vectors->GetTuple(2 * m, vector);
+      for (int d = 0; d < 3; d++) {
+        EXPECT_DOUBLE_EQ(vector[d], to[d] - from[d]);
+      }
+      EXPECT_EQ(loads->GetTuple1(m), diff->migrations[m].load);
+    }
+
+    // Every migration leaves one rank for another
+    int n_in = 0, n_out = 0;
+    for (uint64_t rank_id = 0; rank_id < info.getNumRanks(); rank_id++) {
+      n_in += info.getRankQOIAtPhase<int>(
+        rank_id, phase, no_lb_iter, "migrations_in");
+      n_out += info.getRankQOIAtPhase<int>(
+        rank_id, phase, no_lb_iter, "migrations_out");
+    }
+    EXPECT_EQ(n_in, mesh->GetNumberOfCells());
+    EXPECT_EQ(n_out, mesh->GetNumberOfCells());
+  }
+
+  render.setSaveMigrations(true);
+  std::filesystem::create_directories(output_dir);
+  render.generate(50, 2000);
+  for (uint64_t i = 0; i < info.getNumPhases(); i++) {
+    auto mesh_file = fmt::format(
+      "{}{}_migration_mesh_{}.vtp", output_dir, output_file_stem, i);
+    EXPECT_TRUE(std::filesystem::exists(mesh_file))
+      << fmt::format("Error: mesh not generated at {}", mesh_file);
+  }
+}
+
+/**
+ * Test Render:generate renders images from rank tiles
+ */
+TEST_P(RenderTest, test_render_from_config_with_lod_tiles) {
+  std::string const& config_file = GetParam();
+  YAML::Node config =
+    YAML::LoadFile(fmt::format("{}/tests/config/{}", SRC_DIR, config_file));
+  Info info = Generator::loadInfoFromConfig(config);
+
+  std::string output_file_stem =
+    config["output"]["file_stem"].as<std::string>() + "_lod";
+  config["output"]["file_stem"] = output_file_stem;
+  config["viz"]["save_meshes"] = false;
+
+  std::string output_dir;
+  Render render = createRender(config, info, output_dir);
+  render.setRendererType(RendererType::Raster);
+  render.setLODTileSize(2);
+  std::filesystem::create_directories(output_dir);
+
+  render.generate(50, 500);
+
+  for (uint64_t i = 0; i < info.getNumPhases(); i++) {
+    auto png_file = fmt::format("{}{}{}.png", output_dir, output_file_stem, i);
+    EXPECT_TRUE(std::filesystem::exists(png_file))
+      << fmt::format("Error: PNG image not generated at {}", png_file);
+  }
+
+  // Automatic tiles are at least 16 pixels wide
+  render.setLODTileSize(0);
+  EXPECT_EQ(render.getLODTileSize(2000), 1u);
+  EXPECT_EQ(render.getLODTileSize(16), 2u);
+}
+
 INSTANTIATE_TEST_SUITE_P(
   RenderTests,
   RenderTest,
@@ -377,10 +945,64 @@ TEST_F(RenderTest, test_render_construct_from_info) {
   fmt::print("Num ranks={}\n", info->getNumRanks());
 
   // Instantiate render
-  auto r = Render(*info);
+  utility::InfoLoader::selectPhase(
+    *info, std::numeric_limits<PhaseType>::max());
+  auto r = Render(std::move(info));
   r.generate();
 
   SUCCEED();
 }
 
+/**
+ * Test Render shares the data it is given instead of copying it
+ */
+TEST_F(RenderTest, test_render_shares_info) {
+  auto info =
+    std::make_shared<Info>(Generator::makeCommunicatingInfo(4, 8, 2, 2));
+  Info const* data = info.get();
+
+  Render render(
+    {"load", "", "load"}, true, info, {2, 2, 1}, 0.0,
+    Util::resolveDir(SRC_DIR, "output/tests", true), "shared", 1.0, false,
+    false);
+  EXPECT_EQ(render.getInfo().get(), data);
+  EXPECT_EQ(info.use_count(), 2);
+
+  // The data outlives the caller's handle
+  info.reset();
+  EXPECT_EQ(render.getInfo().use_count(), 1);
+  EXPECT_EQ(render.getInfo()->getNumRanks(), 4u);
+}
+
+/**
+ * Test Render takes the same ranges from the summary of the data as from the
+ * data itself
+ */
+TEST_F(RenderTest, test_render_ranges_from_summary) {
+  auto const data = Generator::makeCommunicatingInfo(4, 8, 2, 2);
+  auto const summary =
+    std::make_shared<PhaseSummary const>(data.computePhaseSummary());
+  std::string const output_dir =
+    Util::resolveDir(SRC_DIR, "output/tests", true);
+
+  for (bool continuous : {true, false}) {
+    for (PhaseType phase :
+         {PhaseType{1}, std::numeric_limits<PhaseType>::max()}) {
+      auto makeRender = [&](bool with_summary) {
+        auto info = std::make_shared<Info>(data);
+        if (with_summary) {
+          info->setPhaseSummary(summary);
+        }
+        return Render(
+          {"load", "", "load"}, continuous, info, {2, 2, 1}, 0.0, output_dir,
+          "summary", 1.0, false, false, phase);
+      };
+      auto scanned = makeRender(false);
+      auto summarized = makeRender(true);
+      EXPECT_EQ(
+        summarized.computeObjectQOIRange_(), scanned.computeObjectQOIRange_());
+    }
+  }
+}
+
 } // namespace vt::tv::tests::unit::render
@@ -129,6 +129,21 @@ public:
     return abs_path_string;
   }
 
+  /**
+   * \brief Resolves the output directory of the test being run, under
+   * "output/tests" of the source directory, so that tests run in parallel
+   * never share files
+   */
+  static std::string resolveTestDir() {
+    auto const* test_info =
+      ::testing::UnitTest::GetInstance()->current_test_info();
+    return resolveDir(
+      SRC_DIR,
+      fmt::format(
+        "output/tests/{}/{}", test_info->test_suite_name(), test_info->name()),
+      true);
+  }
+
   /**
    * \brief Reads file content and returns it as a string
    */
@@ -0,0 +1,175 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              test_analytics.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/analytics.h>
+#include <vt-tv/utility/info_loader.h>
+
+#include <nlohmann/json.hpp>
+
+#include "../util.h"
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace vt::tv::tests::unit::utility {
+
+using Analytics = vt::tv::utility::Analytics;
+using AnalyticsFormat = vt::tv::utility::AnalyticsFormat;
+using InfoLoader = vt::tv::utility::InfoLoader;
+
+/**
+ * Provides unit tests for the vt::tv::utility::Analytics class
+ */
+struct AnalyticsTest : public ::testing::Test {
+  /**
+   * Make two ranks: rank 0 holds objects 0 (load 3, sending 2 messages to
+   * object 1) and 1 (load 1), rank 1 holds non-migratable object 2 (load 2);
+   * an LB iteration moves object 1 to rank 1
+   */
+  static Info makeInfo() {
+    auto object = [](ElementIDType id, TimeType load) {
+      return std::make_pair(id, ObjectWork(id, load, {}));
+    };
+    auto o_0 = object(0, 3.0);
+    o_0.second.addSentCommunications(1, 10.0);
+    o_0.second.addSentCommunications(1, 5.0);
+    auto const o_1 = object(1, 1.0);
+    auto const o_2 = object(2, 2.0);
+
+    PhaseWork phase_0_rank_0(0, {o_0, o_1});
+    phase_0_rank_0.addLBIteration(0, LBIteration(0, 0, {o_0}));
+    PhaseWork phase_0_rank_1(0, {o_2});
+    phase_0_rank_1.addLBIteration(0, LBIteration(0, 0, {o_1, o_2}));
+
+    std::vector<UniqueIndexBitType> idx;
+    return Info(
+      {{0, ObjectInfo(0, 0, true, idx)},
+       {1, ObjectInfo(1, 0, true, idx)},
+       {2, ObjectInfo(2, 1, false, idx)}},
+      {{0, Rank(0, {{0, phase_0_rank_0}, {1, PhaseWork(1, {o_0, o_1})}})},
+       {1, Rank(1, {{0, phase_0_rank_1}, {1, PhaseWork(1, {o_2})}})}});
+  }
+};
+
+TEST_F(AnalyticsTest, test_analytics_frame_statistics) {
+  Info const info = makeInfo();
+  Analytics const analytics(info);
+
+  auto const& frames = analytics.getFrames();
+  ASSERT_EQ(frames.size(), 3);
+  EXPECT_EQ(frames[0].phase, 0);
+  EXPECT_EQ(frames[0].lb_iter, no_lb_iter);
+  EXPECT_EQ(frames[1].phase, 0);
+  EXPECT_EQ(frames[1].lb_iter, 0);
+  EXPECT_EQ(frames[2].phase, 1);
+
+  // Ranks hold loads of 4 and 2 in phase 0, then 3 and 3 after LB
+  EXPECT_DOUBLE_EQ(frames[0].rank_load_min, 2.0);
+  EXPECT_DOUBLE_EQ(frames[0].rank_load_mean, 3.0);
+  EXPECT_DOUBLE_EQ(frames[0].rank_load_max, 4.0);
+  EXPECT_DOUBLE_EQ(frames[0].imbalance, info.getImbalance(0, no_lb_iter));
+  EXPECT_DOUBLE_EQ(frames[1].imbalance, 0.0);
+  EXPECT_EQ(frames[0].n_objects, 3);
+  EXPECT_EQ(frames[0].n_migratable_objects, 2);
+  EXPECT_DOUBLE_EQ(frames[0].sent_volume, 15.0);
+  EXPECT_EQ(frames[0].n_messages, 2);
+
+  Analytics const selected(info, 1);
+  ASSERT_EQ(selected.getFrames().size(), 1);
+  EXPECT_EQ(selected.getFrames()[0].phase, 1);
+  EXPECT_DOUBLE_EQ(selected.getFrames()[0].rank_load_max, 4.0);
+}
+
+TEST_F(AnalyticsTest, test_analytics_normalized_communications) {
+  // Object 1 records 3 messages from object 0, which does not record them
+  ObjectWork o_0(0, 1.0, {});
+  ObjectWork o_1(1, 1.0, {});
+  o_1.addReceivedCommunications(0, 8.0, 3);
+  std::vector<UniqueIndexBitType> idx;
+  Info info(
+    {{0, ObjectInfo(0, 0, true, idx)}, {1, ObjectInfo(1, 1, true, idx)}},
+    {{0, Rank(0, {{0, PhaseWork(0, {{0, o_0}})}})},
+     {1, Rank(1, {{0, PhaseWork(0, {{1, o_1}})}})}});
+  EXPECT_EQ(Analytics(info).getFrames()[0].n_messages, 0);
+
+  InfoLoader::selectPhase(info, std::numeric_limits<PhaseType>::max());
+  auto const frame = Analytics(info).getFrames()[0];
+  EXPECT_DOUBLE_EQ(frame.sent_volume, 8.0);
+  EXPECT_EQ(frame.n_messages, 3);
+}
+
+TEST_F(AnalyticsTest, test_analytics_reports) {
+  Analytics const analytics(makeInfo());
+
+  std::ostringstream csv;
+  analytics.writeCSV(csv);
+  std::istringstream lines(csv.str());
+  std::string line;
+  std::getline(lines, line);
+  EXPECT_EQ(
+    line,
+    "phase,lb_iter,imbalance,rank_load_min,rank_load_mean,rank_load_max,"
+    "n_objects,n_migratable_objects,sent_volume,n_messages");
+  std::getline(lines, line);
+  EXPECT_THAT(line, ::testing::StartsWith("0,,0.333"));
+  EXPECT_THAT(line, ::testing::EndsWith(",2,3,4,3,2,15,2"));
+  std::getline(lines, line);
+  EXPECT_EQ(line.substr(0, 4), "0,0,");
+
+  std::ostringstream json;
+  analytics.writeJSON(json);
+  auto const report = nlohmann::json::parse(json.str());
+  ASSERT_EQ(report.size(), 3);
+  EXPECT_TRUE(report[0]["lb_iter"].is_null());
+  EXPECT_EQ(report[1]["lb_iter"], 0);
+  EXPECT_EQ(report[2]["n_objects"], 3);
+
+  EXPECT_EQ(Analytics::getFormat("csv"), AnalyticsFormat::CSV);
+  EXPECT_EQ(Analytics::getExtension(AnalyticsFormat::JSON), ".json");
+  EXPECT_THROW(Analytics::getFormat("xml"), std::runtime_error);
+}
+
+} // end namespace vt::tv::tests::unit::utility
@@ -0,0 +1,192 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_animation_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/animation_writer.h>
+
+#include "../util.h"
+
+#include <string>
+#include <vector>
+
+namespace vt::tv::tests::unit::utility {
+
+using Util = vt::tv::tests::unit::Util;
+using AnimationFormat = vt::tv::utility::AnimationFormat;
+using AnimationWriter = vt::tv::utility::AnimationWriter;
+using PNGEncoder = vt::tv::utility::PNGEncoder;
+
+/**
+ * Provides unit tests for the vt::tv::utility::AnimationWriter class
+ */
+struct AnimationWriterTest : public ::testing::Test {
+  void SetUp() override {
+    output_dir_ = Util::resolveTestDir();
+    std::filesystem::remove_all(output_dir_);
+    std::filesystem::create_directories(output_dir_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(output_dir_);
+  }
+
+  static std::vector<uint8_t> readFile(std::string const& filename) {
+    std::ifstream is(filename, std::ios::binary);
+    return {std::istreambuf_iterator<char>(is), {}};
+  }
+
+  static uint32_t readU32(std::vector<uint8_t> const& buf, std::size_t pos) {
+    return (static_cast<uint32_t>(buf[pos]) << 24) |
+      (static_cast<uint32_t>(buf[pos + 1]) << 16) |
+      (static_cast<uint32_t>(buf[pos + 2]) << 8) |
+      static_cast<uint32_t>(buf[pos + 3]);
+  }
+
+  /// Build a frame filled with a single color
+  static std::vector<uint8_t>
+  makeFrame(uint32_t width, uint32_t height, std::array<uint8_t, 3> rgb) {
+    std::vector<uint8_t> pixels(width * height * 3);
+    for (std::size_t i = 0; i < pixels.size(); i++) {
+      pixels[i] = rgb[i % 3];
+    }
+    return pixels;
+  }
+
+  std::filesystem::path output_dir_;
+};
+
+TEST_F(AnimationWriterTest, test_apng_chunks) {
+  auto const filename = (output_dir_ / "anim.apng").string();
+  uint32_t const width = 5, height = 3;
+  {
+    AnimationWriter writer(filename, AnimationFormat::APNG, 25);
+    for (uint8_t v : {0, 128, 255}) {
+      auto const frame = makeFrame(width, height, {v, v, 0});
+      writer.addFrame(frame.data(), width, height, 3);
+    }
+    EXPECT_EQ(writer.getNumFrames(), 3u);
+    writer.close();
+  }
+
+  auto const png = readFile(filename);
+  ASSERT_GT(png.size(), 8u);
+  EXPECT_TRUE(std::equal(
+    png.begin(), png.begin() + 8, PNGEncoder::signature().begin()));
+
+  std::vector<std::string> types;
+  std::vector<uint32_t> sequence;
+  std::size_t pos = 8;
+  while (pos + 12 <= png.size()) {
+    auto const length = readU32(png, pos);
+    std::string type(png.begin() + pos + 4, png.begin() + pos + 8);
+    EXPECT_EQ(
+      readU32(png, pos + 8 + length),
+      PNGEncoder::crc32(png.data() + pos + 4, length + 4))
+      << "Invalid CRC for chunk " << type;
+    if (type == "acTL") {
+      EXPECT_EQ(readU32(png, pos + 8), 3u);
+    } else if (type == "fcTL" || type == "fdAT") {
+      sequence.push_back(readU32(png, pos + 8));
+    }
+    if (type == "fcTL") {
+      EXPECT_EQ(readU32(png, pos + 12), width);
+      EXPECT_EQ(readU32(png, pos + 16), height);
+      // 1/25 s per frame
+      EXPECT_EQ(png[pos + 30] * 256 + png[pos + 31], 25);
+    }
+    types.push_back(type);
+    pos += 12 + length;
+  }
+  EXPECT_EQ(pos, png.size());
+  EXPECT_EQ(
+    types,
+    (std::vector<std::string>{
+      "IHDR", "acTL", "fcTL", "IDAT", "fcTL", "fdAT", "fcTL", "fdAT",
+      "IEND"}));
+  EXPECT_EQ(sequence, (std::vector<uint32_t>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(AnimationWriterTest, test_y4m_frames) {
+  auto const filename = (output_dir_ / "anim.y4m").string();
+  uint32_t const width = 5, height = 3;
+  {
+    AnimationWriter writer(filename, AnimationFormat::Y4M, 10);
+    auto const white = makeFrame(width, height, {255, 255, 255});
+    auto const red = makeFrame(width, height, {255, 0, 0});
+    writer.addFrame(white.data(), width, height, 3);
+    writer.addFrame(red.data(), width, height, 3);
+  }
+
+  auto const y4m = readFile(filename);
+  std::string const header =
+    "YUV4MPEG2 W5 H3 F10:1 Ip A1:1 C420jpeg XCOLORRANGE=FULL\n";
+  ASSERT_GT(y4m.size(), header.size());
+  EXPECT_EQ(std::string(y4m.begin(), y4m.begin() + header.size()), header);
+
+  // Chroma planes are subsampled with odd sizes rounded up
+  std::size_t const frame_size = 6 + 5 * 3 + 2 * (3 * 2);
+  ASSERT_EQ(y4m.size(), header.size() + 2 * frame_size);
+
+  auto const white = header.size();
+  EXPECT_EQ(
+    std::string(y4m.begin() + white, y4m.begin() + white + 6), "FRAME\n");
+  EXPECT_EQ(y4m[white + 6], 255);
+  EXPECT_EQ(y4m[white + 6 + 15], 128);
+  EXPECT_EQ(y4m[white + 6 + 15 + 6], 128);
+
+  auto const red = white + frame_size;
+  EXPECT_EQ(y4m[red + 6], 76);
+  EXPECT_EQ(y4m[red + 6 + 15], 85);
+  EXPECT_EQ(y4m[red + 6 + 15 + 6], 255);
+}
+
+TEST_F(AnimationWriterTest, test_frame_size_mismatch) {
+  auto const filename = (output_dir_ / "anim.apng").string();
+  AnimationWriter writer(filename, AnimationFormat::APNG);
+  auto const frame = makeFrame(4, 4, {1, 2, 3});
+  writer.addFrame(frame.data(), 4, 4, 3);
+  EXPECT_THROW(writer.addFrame(frame.data(), 2, 8, 3), std::runtime_error);
+  EXPECT_THROW(
+    AnimationWriter(filename, AnimationFormat::None), std::runtime_error);
+}
+
+} // namespace vt::tv::tests::unit::utility
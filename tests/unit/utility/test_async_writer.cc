@@ -0,0 +1,143 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_async_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/async_writer.h>
+
+#include "../util.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace vt::tv::tests::unit::utility {
+
+using AsyncWriter = vt::tv::utility::AsyncWriter;
+
+/**
+ * Provides unit tests for the vt::tv::utility::AsyncWriter class
+ */
+struct AsyncWriterTest : public ::testing::Test {};
+
+TEST_F(AsyncWriterTest, test_flush_waits_for_all_tasks) {
+  AsyncWriter writer(2, 3);
+  EXPECT_EQ(writer.getNumThreads(), 2u);
+
+  std::atomic<int> n_done = 0;
+  for (int i = 0; i < 20; i++) {
+    writer.submit([&n_done] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      n_done++;
+    });
+  }
+  writer.flush();
+  EXPECT_EQ(n_done, 20);
+
+  // The writer can be reused after a flush
+  writer.submit([&n_done] { n_done++; });
+  writer.flush();
+  EXPECT_EQ(n_done, 21);
+}
+
+TEST_F(AsyncWriterTest, test_queue_is_bounded) {
+  uint64_t const capacity = 2;
+  AsyncWriter writer(1, capacity);
+
+  std::atomic<bool> release = false;
+  std::atomic<int> n_submitted = 0;
+  std::thread producer([&] {
+    for (int i = 0; i < 10; i++) {
+      writer.submit([&release] {
+        while (!release) {
+          std::this_thread::yield();
+        }
+      });
+      n_submitted++;
+    }
+  });
+
+  // One task is running and at most `capacity` are waiting in the queue
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_LE(n_submitted, static_cast<int>(capacity + 1));
+
+  release = true;
+  producer.join();
+  writer.flush();
+  EXPECT_EQ(n_submitted, 10);
+}
+
+TEST_F(AsyncWriterTest, test_errors_are_rethrown_by_flush) {
+  AsyncWriter writer(2, 4);
+  std::atomic<int> n_done = 0;
+  writer.submit([] { throw std::runtime_error("disk full"); });
+  writer.submit([&n_done] { n_done++; });
+  EXPECT_THROW(writer.flush(), std::runtime_error);
+  EXPECT_EQ(n_done, 1);
+
+  // The error is only reported once
+  EXPECT_NO_THROW(writer.flush());
+}
+
+TEST_F(AsyncWriterTest, test_synchronous_mode) {
+  AsyncWriter writer(0, 1);
+  EXPECT_EQ(writer.getNumThreads(), 0u);
+
+  auto const caller = std::this_thread::get_id();
+  std::thread::id executor;
+  writer.submit([&executor] { executor = std::this_thread::get_id(); });
+  EXPECT_EQ(executor, caller);
+  EXPECT_NO_THROW(writer.flush());
+}
+
+TEST_F(AsyncWriterTest, test_destructor_drains_queue) {
+  std::atomic<int> n_done = 0;
+  {
+    AsyncWriter writer(1, 8);
+    for (int i = 0; i < 8; i++) {
+      writer.submit([&n_done] { n_done++; });
+    }
+  }
+  EXPECT_EQ(n_done, 8);
+}
+
+} // namespace vt::tv::tests::unit::utility
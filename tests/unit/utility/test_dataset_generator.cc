@@ -0,0 +1,236 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_dataset_generator.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/dataset_generator.h>
+#include <vt-tv/utility/json_reader.h>
+
+#include <set>
+
+#include "../util.h"
+
+namespace vt::tv::tests::unit::utility {
+
+using DatasetGenerator = vt::tv::utility::DatasetGenerator;
+using DatasetSpec = vt::tv::utility::DatasetSpec;
+using CommTopology = vt::tv::utility::CommTopology;
+using JSONReader = vt::tv::utility::JSONReader;
+
+/**
+ * Provides unit tests for the vt::tv::utility::DatasetGenerator class
+ */
+struct DatasetGeneratorTest : public ::testing::Test {
+  static DatasetSpec makeSpec() {
+    DatasetSpec spec;
+    spec.num_ranks = 5;
+    spec.num_objects_per_rank = 12;
+    spec.objects_spread = 0.5;
+    spec.num_phases = 3;
+    spec.num_lb_iterations = 2;
+    spec.num_subphases = 2;
+    spec.migration_fraction = 0.3;
+    spec.comm_degree = 3;
+    spec.seed = 7;
+    spec.user_defined = {
+      DatasetGenerator::getUserDefinedField("flops"),
+      DatasetGenerator::getUserDefinedField("block:int"),
+      DatasetGenerator::getUserDefinedField("label:string")};
+    return spec;
+  }
+};
+
+TEST_F(DatasetGeneratorTest, test_dataset_generator_objects) {
+  DatasetGenerator generator(makeSpec());
+
+  uint64_t total = 0;
+  for (NodeType rank = 0; rank < 5; rank++) {
+    auto const n = generator.getNumObjects(rank);
+    EXPECT_GE(n, 6u);
+    EXPECT_LE(n, 18u);
+    // Ids are contiguous from rank to rank
+    EXPECT_EQ(generator.getHome(total), rank);
+    EXPECT_EQ(generator.getHome(total + n - 1), rank);
+    total += n;
+  }
+  EXPECT_EQ(generator.getTotalObjects(), total);
+}
+
+TEST_F(DatasetGeneratorTest, test_dataset_generator_phases) {
+  DatasetGenerator generator(makeSpec());
+
+  for (PhaseType phase = 0; phase < 3; phase++) {
+    std::multiset<ElementIDType> objects;
+    for (NodeType rank = 0; rank < 5; rank++) {
+      auto const j =
+        nlohmann::json::parse(generator.generatePhase(rank, phase));
+      EXPECT_EQ(j["id"], phase);
+      ASSERT_EQ(j["lb_iterations"].size(), 2u);
+
+      for (auto const& task : j["tasks"]) {
+        ElementIDType const id = task["entity"]["id"];
+        objects.insert(id);
+        EXPECT_EQ(task["node"], rank);
+        EXPECT_EQ(generator.getLocation(id, phase, no_lb_iter), rank);
+        EXPECT_TRUE(task["time"].is_number_float());
+        EXPECT_EQ(task["subphases"].size(), 2u);
+        EXPECT_TRUE(task["user_defined"]["flops"].is_number_float());
+        EXPECT_TRUE(task["user_defined"]["block"].is_number_integer());
+        EXPECT_EQ(task["user_defined"]["label"], fmt::format("label_{}", id));
+      }
+
+      for (auto const& comm : j["communications"]) {
+        EXPECT_EQ(comm["type"], "SendRecv");
+        EXPECT_NE(comm["from"]["id"], comm["to"]["id"]);
+        EXPECT_EQ(
+          generator.getLocation(comm["from"]["id"], phase, no_lb_iter), rank);
+      }
+    }
+
+    // Every object is found on exactly one rank
+    EXPECT_EQ(objects.size(), generator.getTotalObjects());
+    EXPECT_EQ(
+      std::set<ElementIDType>(objects.begin(), objects.end()).size(),
+      generator.getTotalObjects());
+  }
+}
+
+TEST_F(DatasetGeneratorTest, test_dataset_generator_topologies) {
+  auto spec = makeSpec();
+  spec.migration_fraction = 0.0;
+  spec.num_lb_iterations = 0;
+
+  for (auto topology : {CommTopology::Ring, CommTopology::Stencil}) {
+    spec.comm_topology = topology;
+    DatasetGenerator generator(spec);
+
+    uint64_t n_messages = 0;
+    for (NodeType rank = 0; rank < 5; rank++) {
+      auto const j = nlohmann::json::parse(generator.generatePhase(rank, 0));
+      for (auto const& comm : j["communications"]) {
+        ElementIDType const from = comm["from"]["id"];
+        ElementIDType const to = comm["to"]["id"];
+        if (topology == CommTopology::Ring) {
+          EXPECT_EQ(generator.getHome(to), (generator.getHome(from) + 1) % 5);
+        } else {
+          auto const distance = from > to ? from - to : to - from;
+          auto const total = generator.getTotalObjects();
+          EXPECT_TRUE(distance <= 2 or distance >= total - 2);
+        }
+        n_messages++;
+      }
+    }
+    auto const degree = topology == CommTopology::Ring ? 1 : 3;
+    EXPECT_EQ(n_messages, degree * generator.getTotalObjects());
+  }
+
+  spec.comm_topology = CommTopology::None;
+  auto const j =
+    nlohmann::json::parse(DatasetGenerator(spec).generatePhase(0, 0));
+  EXPECT_EQ(j.find("communications"), j.end());
+}
+
+TEST_F(DatasetGeneratorTest, test_dataset_generator_write_and_read) {
+  auto const output_dir =
+    fmt::format("{}/output/tests/dataset_generator", SRC_DIR);
+
+  for (bool compress : {false, true}) {
+    auto spec = makeSpec();
+    spec.compress = compress;
+    DatasetGenerator generator(spec);
+    generator.write(output_dir, "synthetic");
+
+    for (NodeType rank = 0; rank < 5; rank++) {
+      auto const filename =
+        generator.getFilename(output_dir, "synthetic", rank);
+      EXPECT_EQ(filename.substr(filename.size() - 3) == ".br", compress);
+
+      JSONReader reader{rank};
+      reader.readFile(filename);
+      auto info = reader.parse();
+      auto const& phases = info->getRank(rank).getPhaseWork();
+      ASSERT_EQ(phases.size(), 3u);
+
+      for (auto const& [phase, phase_work] : phases) {
+        auto const expected = nlohmann::json::parse(
+          generator.generatePhase(rank, phase));
+        EXPECT_EQ(
+          phase_work.getObjectWork().size(), expected["tasks"].size());
+        EXPECT_EQ(phase_work.getLBIterations().size(), 2u);
+        for (auto const& [id, work] : phase_work.getObjectWork()) {
+          EXPECT_EQ(work.getSubphaseLoads().size(), 2u);
+          EXPECT_EQ(work.getUserDefined().size(), 3u);
+          EXPECT_EQ(work.getSent().size(), 3u);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(DatasetGeneratorTest, test_dataset_generator_reproducible) {
+  auto const text = DatasetGenerator(makeSpec()).generatePhase(2, 1);
+  EXPECT_EQ(DatasetGenerator(makeSpec()).generatePhase(2, 1), text);
+
+  auto spec = makeSpec();
+  spec.seed++;
+  EXPECT_NE(DatasetGenerator(spec).generatePhase(2, 1), text);
+}
+
+TEST_F(DatasetGeneratorTest, test_dataset_generator_invalid_parameters) {
+  auto spec = makeSpec();
+  spec.num_ranks = 0;
+  EXPECT_THROW(DatasetGenerator{spec}, std::runtime_error);
+
+  spec = makeSpec();
+  spec.migration_fraction = 1.5;
+  EXPECT_THROW(DatasetGenerator{spec}, std::runtime_error);
+
+  EXPECT_THROW(
+    DatasetGenerator::getLoadDistribution("poisson"), std::runtime_error);
+  EXPECT_THROW(DatasetGenerator::getCommTopology("tree"), std::runtime_error);
+  EXPECT_THROW(
+    DatasetGenerator::getUserDefinedField("name:float"), std::runtime_error);
+  EXPECT_THROW(
+    DatasetGenerator::getUserDefinedField(":int"), std::runtime_error);
+}
+
+} // namespace vt::tv::tests::unit::utility
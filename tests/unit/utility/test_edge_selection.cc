@@ -0,0 +1,113 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_edge_selection.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/edge_selection.h>
+
+#include "../util.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace vt::tv::tests::unit::utility {
+
+using EdgeSelection = vt::tv::utility::EdgeSelection;
+
+/**
+ * Provides unit tests for the vt::tv::utility::EdgeSelection struct
+ */
+struct EdgeSelectionTest : public ::testing::Test { };
+
+TEST_F(EdgeSelectionTest, test_default_selection_keeps_all_edges) {
+  EdgeSelection selection;
+  EXPECT_FALSE(selection.isActive());
+  EXPECT_EQ(
+    selection.select({3.0, 0.0, 1.0}), (std::vector<uint64_t>{0, 1, 2}));
+  EXPECT_TRUE(selection.select({}).empty());
+}
+
+TEST_F(EdgeSelectionTest, test_threshold) {
+  EdgeSelection selection;
+  selection.min_volume = 2.0;
+  EXPECT_TRUE(selection.isActive());
+  EXPECT_EQ(
+    selection.select({3.0, 0.5, 2.0, 1.0}), (std::vector<uint64_t>{0, 2}));
+}
+
+TEST_F(EdgeSelectionTest, test_top_k_keeps_earliest_ties_in_order) {
+  EdgeSelection selection;
+  selection.top_k = 3;
+  EXPECT_EQ(
+    selection.select({1.0, 5.0, 2.0, 5.0, 2.0, 0.5}),
+    (std::vector<uint64_t>{1, 2, 3}));
+
+  selection.min_volume = 3.0;
+  EXPECT_EQ(
+    selection.select({1.0, 5.0, 2.0, 5.0, 2.0, 0.5}),
+    (std::vector<uint64_t>{1, 3}));
+}
+
+TEST_F(EdgeSelectionTest, test_top_k_matches_full_sort) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dist(0, 100);
+  std::vector<double> volumes(10000);
+  for (auto& v : volumes) {
+    v = dist(gen);
+  }
+
+  EdgeSelection selection;
+  selection.top_k = 250;
+  auto const selected = selection.select(volumes);
+
+  std::vector<uint64_t> expected(volumes.size());
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&](auto a, auto b) {
+    return volumes[a] > volumes[b];
+  });
+  expected.resize(selection.top_k);
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(selected, expected);
+}
+
+} /* end namespace vt::tv::tests::unit::utility */
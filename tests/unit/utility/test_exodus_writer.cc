@@ -0,0 +1,199 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_exodus_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/exodus_writer.h>
+
+#include "../util.h"
+
+#include <vtk_exodusII.h>
+
+#include <string>
+#include <vector>
+
+namespace vt::tv::tests::unit::utility {
+
+using Util = vt::tv::tests::unit::Util;
+using ExodusWriter = vt::tv::utility::ExodusWriter;
+
+/**
+ * Provides unit tests for the vt::tv::utility::ExodusWriter class
+ */
+struct ExodusWriterTest : public ::testing::Test {
+  void SetUp() override {
+    output_dir_ = Util::resolveTestDir();
+    std::filesystem::remove_all(output_dir_);
+    std::filesystem::create_directories(output_dir_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(output_dir_);
+  }
+
+  static int open(std::string const& filename) {
+    int comp_ws = sizeof(double);
+    int io_ws = 0;
+    float version = 0;
+    return ex_open(filename.c_str(), EX_READ, &comp_ws, &io_ws, &version);
+  }
+
+  static std::vector<std::string>
+  getVariableNames(int exoid, ex_entity_type type) {
+    int n_vars = 0;
+    ex_get_variable_param(exoid, type, &n_vars);
+    std::vector<std::vector<char>> buffers(
+      n_vars, std::vector<char>(MAX_LINE_LENGTH + 1, '\0'));
+    std::vector<char*> c_names;
+    for (auto& buffer : buffers) {
+      c_names.push_back(buffer.data());
+    }
+    ex_get_variable_names(exoid, type, n_vars, c_names.data());
+    return std::vector<std::string>(c_names.begin(), c_names.end());
+  }
+
+  static std::vector<double> getValues(
+    int exoid, int step, ex_entity_type type, int var, int id, int64_t n) {
+    std::vector<double> values(n);
+    EXPECT_GE(ex_get_var(exoid, step, type, var, id, n, values.data()), 0);
+    return values;
+  }
+
+protected:
+  std::filesystem::path output_dir_;
+};
+
+TEST_F(ExodusWriterTest, test_blocks_and_steps_round_trip) {
+  auto const filename = (output_dir_ / "series.exo").string();
+  {
+    ExodusWriter writer(
+      filename, "test", {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}, {2, 1, 0}},
+      {{"ranks", 2, {"load", "id"}}, {"objects", 3, {"load", "present"}}},
+      {"phase"});
+
+    for (int s = 0; s < 2; s++) {
+      std::vector<std::array<double, 3>> displacements(5, {0, 0, 0});
+      displacements[4] = {0, 0.5 * s, 0};
+      writer.addStep(
+        s, displacements, {10.0 + s},
+        {{{1.0 + s, 2.0 + s}, {0, 1}},
+         {{0.5, 0.25, 0.125 * s}, {1, 1, static_cast<double>(s)}}});
+    }
+    EXPECT_EQ(writer.getNumSteps(), 2u);
+    writer.close();
+  }
+
+  int const exoid = open(filename);
+  ASSERT_GE(exoid, 0);
+
+  char title[MAX_LINE_LENGTH + 1] = {};
+  int n_dim = 0, n_nodes = 0, n_elements = 0, n_blocks = 0, n_ns = 0, n_ss = 0;
+  ex_get_init(
+    exoid, title, &n_dim, &n_nodes, &n_elements, &n_blocks, &n_ns, &n_ss);
+  EXPECT_EQ(std::string(title), "test");
+  EXPECT_EQ(n_nodes, 5);
+  EXPECT_EQ(n_elements, 5);
+  EXPECT_EQ(n_blocks, 2);
+  EXPECT_EQ(ex_inquire_int(exoid, EX_INQ_TIME), 2);
+
+  char name[MAX_LINE_LENGTH + 1] = {};
+  ex_get_name(exoid, EX_ELEM_BLOCK, 2, name);
+  EXPECT_EQ(std::string(name), "objects");
+
+  // Variables of the same name are shared by the blocks
+  EXPECT_EQ(
+    getVariableNames(exoid, EX_ELEM_BLOCK),
+    (std::vector<std::string>{"load", "id", "present"}));
+  std::vector<int> truth_table(6);
+  ex_get_truth_table(exoid, EX_ELEM_BLOCK, 2, 3, truth_table.data());
+  EXPECT_EQ(truth_table, (std::vector<int>{1, 1, 0, 1, 0, 1}));
+  EXPECT_EQ(
+    getVariableNames(exoid, EX_NODAL),
+    (std::vector<std::string>{"DISPL_X", "DISPL_Y", "DISPL_Z"}));
+  EXPECT_EQ(
+    getVariableNames(exoid, EX_GLOBAL), (std::vector<std::string>{"phase"}));
+
+  double time = 0;
+  ex_get_time(exoid, 2, &time);
+  EXPECT_EQ(time, 1.0);
+  EXPECT_EQ(
+    getValues(exoid, 2, EX_ELEM_BLOCK, 1, 1, 2),
+    (std::vector<double>{2.0, 3.0}));
+  EXPECT_EQ(
+    getValues(exoid, 2, EX_ELEM_BLOCK, 3, 2, 3),
+    (std::vector<double>{1, 1, 1}));
+  EXPECT_EQ(
+    getValues(exoid, 2, EX_NODAL, 2, 1, 5),
+    (std::vector<double>{0, 0, 0, 0, 0.5}));
+  EXPECT_EQ(
+    getValues(exoid, 1, EX_GLOBAL, 1, 1, 1), (std::vector<double>{10.0}));
+  ex_close(exoid);
+}
+
+TEST_F(ExodusWriterTest, test_mismatched_steps_throw) {
+  auto const filename = (output_dir_ / "mismatch.exo").string();
+  ExodusWriter writer(
+    filename, "test", {{0, 0, 0}, {1, 0, 0}}, {{"objects", 2, {"load"}}}, {});
+
+  EXPECT_THROW(
+    writer.addStep(0, {{0, 0, 0}}, {}, {{{1, 2}}}), std::runtime_error);
+  EXPECT_THROW(
+    writer.addStep(0, {{0, 0, 0}, {0, 0, 0}}, {}, {{{1}}}),
+    std::runtime_error);
+  EXPECT_EQ(writer.getNumSteps(), 0u);
+
+  writer.addStep(0, {{0, 0, 0}, {0, 0, 0}}, {}, {{{1, 2}}});
+  writer.close();
+  EXPECT_THROW(
+    writer.addStep(1, {{0, 0, 0}, {0, 0, 0}}, {}, {{{1, 2}}}),
+    std::runtime_error);
+  EXPECT_EQ(writer.getNumSteps(), 1u);
+}
+
+TEST_F(ExodusWriterTest, test_blocks_must_cover_the_nodes) {
+  EXPECT_THROW(
+    ExodusWriter(
+      (output_dir_ / "x.exo").string(), "test", {{0, 0, 0}, {1, 0, 0}},
+      {{"objects", 1, {}}}, {}),
+    std::runtime_error);
+}
+
+} /* end namespace vt::tv::tests::unit::utility */
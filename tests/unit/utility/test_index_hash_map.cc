@@ -0,0 +1,102 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_index_hash_map.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/index_hash_map.h>
+
+#include "../util.h"
+
+#include <random>
+#include <unordered_map>
+
+namespace vt::tv::tests::unit::utility {
+
+using IndexHashMap = vt::tv::utility::IndexHashMap;
+
+/**
+ * Provides unit tests for the vt::tv::utility::IndexHashMap class
+ */
+struct IndexHashMapTest : public ::testing::Test {};
+
+TEST_F(IndexHashMapTest, test_emplace_and_find) {
+  IndexHashMap map;
+  EXPECT_EQ(map.size(), 0u);
+  EXPECT_EQ(map.find(42), IndexHashMap::invalid);
+
+  auto [v1, inserted1] = map.emplace(42, 0);
+  EXPECT_TRUE(inserted1);
+  EXPECT_EQ(v1, 0u);
+
+  // The first value is kept for a repeated key
+  auto [v2, inserted2] = map.emplace(42, 7);
+  EXPECT_FALSE(inserted2);
+  EXPECT_EQ(v2, 0u);
+  EXPECT_EQ(map.find(42), 0u);
+  EXPECT_EQ(map.size(), 1u);
+}
+
+TEST_F(IndexHashMapTest, test_growth_matches_unordered_map) {
+  std::mt19937_64 gen(12);
+  std::unordered_map<uint64_t, uint64_t> reference;
+  IndexHashMap map;
+  for (uint64_t i = 0; i < 20000; i++) {
+    // Mix sequential and random keys, with repetitions
+    uint64_t const key = (i % 3 == 0) ? i / 3 : gen() % 50000;
+    auto const [value, inserted] = map.emplace(key, reference.size());
+    auto const [it, ref_inserted] = reference.emplace(key, reference.size());
+    EXPECT_EQ(inserted, ref_inserted);
+    EXPECT_EQ(value, it->second);
+  }
+  EXPECT_EQ(map.size(), reference.size());
+  for (auto const& [key, value] : reference) {
+    EXPECT_EQ(map.find(key), value);
+  }
+  EXPECT_EQ(map.find(1ULL << 40), IndexHashMap::invalid);
+}
+
+TEST_F(IndexHashMapTest, test_pack_pair) {
+  EXPECT_EQ(IndexHashMap::packPair(0, 1), 1u);
+  EXPECT_EQ(IndexHashMap::packPair(1, 0), 1ULL << 32);
+  EXPECT_NE(IndexHashMap::packPair(2, 3), IndexHashMap::packPair(3, 2));
+}
+
+} // namespace vt::tv::tests::unit::utility
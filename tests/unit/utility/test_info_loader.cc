@@ -0,0 +1,114 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_info_loader.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/info_loader.h>
+
+#include "../generator.h"
+#include "../util.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace vt::tv::tests::unit::utility {
+
+using InfoLoader = vt::tv::utility::InfoLoader;
+
+/**
+ * Provides unit tests for the vt::tv::utility::InfoLoader class
+ */
+struct InfoLoaderTest : public ::testing::Test {
+  YAML::Node loadConfig() const {
+    return YAML::LoadFile(
+      fmt::format("{}/tests/config/ccm-example.yaml", SRC_DIR));
+  }
+};
+
+TEST_F(InfoLoaderTest, test_info_loader_resolve_directory) {
+  EXPECT_EQ(
+    InfoLoader::resolveDirectory("output/tests"),
+    fmt::format("{}/output/tests/", SRC_DIR));
+  EXPECT_EQ(InfoLoader::resolveDirectory("/tmp/vt-tv/"), "/tmp/vt-tv/");
+}
+
+TEST_F(InfoLoaderTest, test_info_loader_load_from_config) {
+  auto config = loadConfig();
+  auto info = InfoLoader::loadFromConfig(config);
+
+  ASSERT_NE(info, nullptr);
+  EXPECT_EQ(info->getNumRanks(), config["input"]["n_ranks"].as<uint64_t>());
+  EXPECT_GT(info->getNumPhases(), 0u);
+  EXPECT_FALSE(info->getObjectInfo().empty());
+}
+
+TEST_F(InfoLoaderTest, test_info_loader_select_phase) {
+  auto info = Generator::makeCommunicatingInfo(4, 8, 2, 2);
+  auto n_received = [&](PhaseType phase) {
+    std::size_t n = 0;
+    for (auto const& [id, work] : info.getPhaseObjects(phase, no_lb_iter)) {
+      n += work.getReceived().size();
+    }
+    return n;
+  };
+  ASSERT_EQ(n_received(0), 0u);
+
+  // Only the edges of the selected phase are normalized
+  InfoLoader::selectPhase(info, 1);
+  EXPECT_EQ(n_received(0), 0u);
+  EXPECT_GT(n_received(1), 0u);
+  EXPECT_EQ(info.getMaxLoad(), info.getMaxLoad(1));
+
+  InfoLoader::selectPhase(info, std::numeric_limits<PhaseType>::max());
+  EXPECT_GT(n_received(0), 0u);
+  EXPECT_EQ(
+    info.getMaxVolume(), std::max(info.getMaxVolume(0), info.getMaxVolume(1)));
+}
+
+TEST_F(InfoLoaderTest, test_info_loader_rank_mismatch) {
+  auto config = loadConfig();
+  config["input"]["n_ranks"] = config["input"]["n_ranks"].as<uint64_t>() + 1;
+
+  EXPECT_THROW(InfoLoader::loadFromConfig(config), std::runtime_error);
+}
+
+} // namespace vt::tv::tests::unit::utility
@@ -220,4 +220,31 @@ TEST_F(JSONReaderTest, test_json_reader_object_work_user_defined) {
   EXPECT_EQ(1, std::get<int>(user_defined.at("isSample")));
 }
 
+TEST_F(JSONReaderTest, test_json_reader_communication_messages) {
+  JSONReader reader{0};
+  reader.readString(R"({"phases": [{
+    "id": 0,
+    "tasks": [
+      {"entity": {"home": 0, "id": 0, "migratable": true, "type": "object"},
+       "node": 0, "resource": "cpu", "time": 1.0},
+      {"entity": {"home": 0, "id": 1, "migratable": true, "type": "object"},
+       "node": 0, "resource": "cpu", "time": 2.0}],
+    "communications": [
+      {"type": "SendRecv", "bytes": 100.0, "messages": 4,
+       "from": {"id": 0}, "to": {"id": 1}},
+      {"type": "SendRecv", "bytes": 10.0, "from": {"id": 1}, "to": {"id": 2}},
+      {"type": "SendRecv", "bytes": 5.0, "messages": 3,
+       "from": {"id": 3}, "to": {"id": 0}}]}]})");
+  auto info = reader.parse();
+  auto const& objects = info->getRankObjects(0, 0, no_lb_iter);
+
+  // Records carry their number of messages, one when it is not given
+  EXPECT_EQ(
+    objects.at(0).getSentMessages(),
+    (std::map<ElementIDType, uint64_t>{{1, 4}}));
+  EXPECT_EQ(objects.at(0).getNumReceivedMessages(), 3u);
+  EXPECT_EQ(objects.at(1).getNumSentMessages(), 1u);
+  EXPECT_EQ(objects.at(1).getNumReceivedMessages(), 0u);
+}
+
 } // namespace vt::tv::tests::unit::utility
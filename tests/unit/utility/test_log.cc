@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 test_log.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/log.h>
+
+#include <cstdio>
+
+#include "../util.h"
+
+namespace vt::tv::tests::unit::utility {
+
+using Log = vt::tv::utility::Log;
+using LogLevel = vt::tv::utility::LogLevel;
+using LogModule = vt::tv::utility::LogModule;
+
+/**
+ * Provides unit tests for the vt::tv::utility::Log class
+ */
+struct LogTest : public ::testing::Test {
+  void TearDown() override {
+    // Later tests log with the default levels, from a new run
+    ::testing::internal::CaptureStdout();
+    Log::configure("info");
+    Log::finish();
+    ::testing::internal::GetCapturedStdout();
+  }
+
+  static std::string getCapturedStdout() {
+    std::fflush(stdout);
+    return ::testing::internal::GetCapturedStdout();
+  }
+};
+
+TEST_F(LogTest, test_log_levels) {
+  Log::configure("info");
+  EXPECT_TRUE(Log::isEnabled(LogModule::Render, LogLevel::Error));
+  EXPECT_TRUE(Log::isEnabled(LogModule::Render, LogLevel::Info));
+  EXPECT_FALSE(Log::isEnabled(LogModule::Render, LogLevel::Debug));
+  EXPECT_FALSE(Log::isEnabled(LogModule::Render, LogLevel::Off));
+
+  Log::configure("warning,render=debug,model=off");
+  EXPECT_EQ(Log::getLevel(LogModule::General), LogLevel::Warning);
+  EXPECT_EQ(Log::getLevel(LogModule::Loader), LogLevel::Warning);
+  EXPECT_EQ(Log::getLevel(LogModule::Model), LogLevel::Off);
+  EXPECT_EQ(Log::getLevel(LogModule::Render), LogLevel::Debug);
+  EXPECT_FALSE(Log::isEnabled(LogModule::Model, LogLevel::Error));
+
+  // Modules alone start from the default level
+  Log::configure("loader=error");
+  EXPECT_EQ(Log::getLevel(LogModule::General), LogLevel::Info);
+  EXPECT_EQ(Log::getLevel(LogModule::Loader), LogLevel::Error);
+
+  // An invalid specification leaves the levels as they are
+  EXPECT_THROW(Log::configure("info,render=verbose"), std::runtime_error);
+  EXPECT_THROW(Log::configure("writer=info"), std::runtime_error);
+  EXPECT_EQ(Log::getLevel(LogModule::Loader), LogLevel::Error);
+}
+
+TEST_F(LogTest, test_log_disabled_arguments) {
+  Log::configure("info");
+  int evaluated = 0;
+  auto count = [&] { return ++evaluated; };
+
+  ::testing::internal::CaptureStdout();
+  VT_TV_LOG(Render, Debug, "skipped {}", count());
+  VT_TV_LOG(Render, Info, "printed {}", count());
+  auto const output = getCapturedStdout();
+
+  EXPECT_EQ(evaluated, 1);
+  EXPECT_EQ(output, "printed 1\n");
+}
+
+TEST_F(LogTest, test_log_limited) {
+  Log::configure("info");
+  auto logMany = [] {
+    for (int i = 0; i < 25; i++) {
+      VT_TV_LOG_LIMITED(Model, Warning, 3, "Warning: message {}", i);
+    }
+  };
+
+  ::testing::internal::CaptureStdout();
+  logMany();
+  auto output = getCapturedStdout();
+  EXPECT_EQ(output, "Warning: message 0\nWarning: message 1\n"
+                    "Warning: message 2\n");
+  EXPECT_EQ(Log::getNumSuppressed(), 22u);
+
+  // The end of a run reports the dropped messages and resets the limits
+  ::testing::internal::CaptureStdout();
+  Log::finish();
+  output = getCapturedStdout();
+  EXPECT_NE(output.find("22 repeated messages"), std::string::npos);
+  EXPECT_EQ(Log::getNumSuppressed(), 0u);
+
+  ::testing::internal::CaptureStdout();
+  logMany();
+  output = getCapturedStdout();
+  EXPECT_NE(output.find("Warning: message 2\n"), std::string::npos);
+}
+
+} // namespace vt::tv::tests::unit::utility
@@ -0,0 +1,219 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_memory_report.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/memory_report.h>
+
+#include <sstream>
+
+#include "../util.h"
+
+namespace vt::tv::tests::unit::utility {
+
+using MemoryReport = vt::tv::utility::MemoryReport;
+using MemoryStage = vt::tv::utility::MemoryStage;
+
+/**
+ * Provides unit tests for the vt::tv::utility::MemoryReport class
+ */
+struct MemoryReportTest : public ::testing::Test {
+  void TearDown() override {
+    std::ostringstream os;
+    auto* buf = std::cout.rdbuf(os.rdbuf());
+    MemoryReport::get().finish();
+    std::cout.rdbuf(buf);
+  }
+
+  /**
+   * Make two ranks of two phases: object 0 sends a message to object 1 and
+   * another to \c peer, and an LB iteration of phase 0 moves object 1 to
+   * rank 1
+   */
+  static Info
+  makeInfo(std::string const& label = "", ElementIDType peer = 1) {
+    auto object = [&](ElementIDType id, TimeType load) {
+      std::unordered_map<std::string, QOIVariantTypes> user_defined;
+      if (not label.empty()) {
+        user_defined["label"] = label;
+      }
+      return std::make_pair(id, ObjectWork(id, load, {}, user_defined));
+    };
+    auto o_0 = object(0, 3.0);
+    o_0.second.addSentCommunications(1, 10.0);
+    o_0.second.addSentCommunications(peer, 5.0);
+    auto const o_1 = object(1, 1.0);
+    auto const o_2 = object(2, 2.0);
+
+    PhaseWork phase_0_rank_0(0, {o_0, o_1});
+    phase_0_rank_0.addLBIteration(0, LBIteration(0, 0, {o_0}));
+    PhaseWork phase_0_rank_1(0, {o_2});
+    phase_0_rank_1.addLBIteration(0, LBIteration(0, 0, {o_1, o_2}));
+
+    std::vector<UniqueIndexBitType> idx = {1, 2, 3};
+    return Info(
+      {{0, ObjectInfo(0, 0, true, idx)},
+       {1, ObjectInfo(1, 0, true, idx)},
+       {2, ObjectInfo(2, 1, false, idx)}},
+      {{0, Rank(0, {{0, phase_0_rank_0}, {1, PhaseWork(1, {o_0, o_1})}})},
+       {1, Rank(1, {{0, phase_0_rank_1}, {1, PhaseWork(1, {o_2})}})}});
+  }
+};
+
+TEST_F(MemoryReportTest, test_memory_report_estimate) {
+  auto const categories = MemoryReport::estimate(makeInfo());
+  ASSERT_EQ(categories.size(), 6u);
+
+  std::map<std::string, std::pair<uint64_t, uint64_t>> by_name;
+  for (auto const& c : categories) {
+    by_name[c.name] = {c.count, c.bytes};
+  }
+  EXPECT_EQ(by_name["object_info"].first, 3u);
+  EXPECT_EQ(by_name["ranks"].first, 2u);
+  // Phases and LB iterations of both ranks
+  EXPECT_EQ(by_name["phase_work"].first, 6u);
+  // Objects are counted in every phase and LB iteration they are found in
+  EXPECT_EQ(by_name["object_work"].first, 9u);
+  EXPECT_EQ(by_name["object_qoi"].first, 0u);
+  EXPECT_EQ(by_name["object_qoi"].second, 0u);
+  // Object 0 sends its 2 messages in 3 frames
+  EXPECT_EQ(by_name["communications"].first, 6u);
+  for (auto const& name :
+       {"object_info", "ranks", "phase_work", "object_work",
+        "communications"}) {
+    EXPECT_GT(by_name[name].second, 0u) << name;
+  }
+
+  // Long strings are counted with the map holding them
+  std::string const label(100, 'x');
+  auto const labeled = MemoryReport::estimate(makeInfo(label));
+  EXPECT_EQ(labeled[4].name, "object_qoi");
+  EXPECT_EQ(labeled[4].count, 9u);
+  EXPECT_GE(labeled[4].bytes, 9 * label.size());
+  EXPECT_EQ(labeled[3].bytes, by_name["object_work"].second);
+
+  // Message counts take a node per peer, records a node per message: with
+  // another peer, each frame holds 4 nodes instead of 3
+  auto const distinct = MemoryReport::estimate(makeInfo("", 2));
+  EXPECT_EQ(distinct[5].name, "communications");
+  EXPECT_EQ(distinct[5].count, by_name["communications"].first);
+  EXPECT_EQ(3 * distinct[5].bytes, 4 * by_name["communications"].second);
+}
+
+TEST_F(MemoryReportTest, test_memory_report_disabled) {
+  MemoryReport::get().enable();
+  MemoryReport::get().finish();
+  EXPECT_FALSE(MemoryReport::get().isEnabled());
+
+  {
+    MemoryStage stage("ignored");
+    MemoryReport::get().addModel(makeInfo());
+    MemoryReport::get().addBuffer("ignored", 1);
+  }
+  EXPECT_TRUE(MemoryReport::get().getModel().empty());
+  EXPECT_TRUE(MemoryReport::get().getBuffers().empty());
+  EXPECT_TRUE(MemoryReport::get().getStages().empty());
+}
+
+TEST_F(MemoryReportTest, test_memory_report_records) {
+  MemoryReport::get().enable();
+  MemoryReport::get().addModel(makeInfo());
+  MemoryReport::get().addBuffer("pixels", 10);
+  MemoryReport::get().addBuffer("mesh", 5);
+  MemoryReport::get().addBuffer("pixels", 30);
+  MemoryReport::get().addBuffer("pixels", 20);
+  {
+    MemoryStage stage("load");
+  }
+  {
+    MemoryStage stage("render");
+  }
+
+  EXPECT_EQ(MemoryReport::get().getModel().size(), 6u);
+  auto const buffers = MemoryReport::get().getBuffers();
+  ASSERT_EQ(buffers.size(), 2u);
+  EXPECT_EQ(buffers[0].name, "pixels");
+  EXPECT_EQ(buffers[0].count, 3u);
+  EXPECT_EQ(buffers[0].bytes, 30u);
+  EXPECT_EQ(buffers[1].name, "mesh");
+
+  auto const stages = MemoryReport::get().getStages();
+  ASSERT_EQ(stages.size(), 2u);
+  EXPECT_EQ(stages[0].name, "load");
+  EXPECT_EQ(stages[1].name, "render");
+
+  // The report is printed when finished and can still be queried
+  std::ostringstream os;
+  auto* buf = std::cout.rdbuf(os.rdbuf());
+  MemoryReport::get().finish();
+  std::cout.rdbuf(buf);
+  for (auto const& name : {"object_work", "total", "pixels", "render"}) {
+    EXPECT_NE(os.str().find(name), std::string::npos) << name;
+  }
+  EXPECT_EQ(MemoryReport::get().getStages().size(), 2u);
+}
+
+#if defined(__linux__)
+TEST_F(MemoryReportTest, test_memory_report_stage_peak) {
+  std::size_t const size = 64 * 1024 * 1024;
+  MemoryReport::get().enable();
+  {
+    MemoryStage stage("allocate");
+    std::vector<char> buffer(size, 1);
+    EXPECT_GE(MemoryReport::getCurrentRSS(), size);
+  }
+  {
+    MemoryStage stage("idle");
+  }
+
+  auto const stages = MemoryReport::get().getStages();
+  ASSERT_EQ(stages.size(), 2u);
+  EXPECT_GE(stages[0].peak_bytes, size);
+  EXPECT_GE(stages[0].peak_bytes, stages[0].rss_bytes);
+  if (stages[1].stage_peak) {
+    // The buffer was freed before the second stage began
+    EXPECT_LT(stages[1].peak_bytes, stages[0].peak_bytes);
+  }
+}
+#endif
+
+} // namespace vt::tv::tests::unit::utility
@@ -0,0 +1,136 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_output_adaptor.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/decompression_input_container.h>
+#include <vt-tv/utility/input_iterator.h>
+#include <vt-tv/utility/json_generator.h>
+#include <vt-tv/utility/json_reader.h>
+#include <vt-tv/utility/output_adaptor.h>
+
+#include <sstream>
+
+#include "../generator.h"
+#include "../util.h"
+
+namespace vt::tv::tests::unit::utility {
+
+using DecompressionInputContainer =
+  vt::tv::utility::DecompressionInputContainer;
+using JSONGenerator = vt::tv::utility::JSONGenerator;
+using JSONReader = vt::tv::utility::JSONReader;
+
+/**
+ * Provides unit tests for the vt::tv::utility::OutputAdaptor class
+ */
+struct OutputAdaptorTest : public ::testing::Test {
+  template <typename StreamLike>
+  static void dump(
+    nlohmann::json const& j, StreamLike& os, bool compress, int quality = 8) {
+    using Adaptor = vt::tv::utility::OutputAdaptor<StreamLike>;
+    nlohmann::detail::serializer<nlohmann::json> s(
+      std::make_shared<Adaptor>(os, compress, quality, 20), ' ');
+    s.dump(j, false, false, 0);
+  }
+
+  static nlohmann::json makeJSON() {
+    nlohmann::json j;
+    for (int i = 0; i < 1000; i++) {
+      j["values"][i] = {{"id", i}, {"name", fmt::format("value_{}", i)}};
+    }
+    return j;
+  }
+};
+
+TEST_F(OutputAdaptorTest, test_output_adaptor_plain) {
+  auto const j = makeJSON();
+  std::ostringstream os;
+  dump(j, os, false);
+  EXPECT_EQ(os.str(), j.dump());
+}
+
+TEST_F(OutputAdaptorTest, test_output_adaptor_compressed_round_trip) {
+  auto const j = makeJSON();
+  for (int quality : {1, 8, 11}) {
+    std::ostringstream os;
+    dump(j, os, true, quality);
+    EXPECT_LT(os.str().size(), j.dump().size());
+
+    // Small chunks exercise reads across chunk boundaries, and a chunk of all
+    // but one character leaves a last chunk of a single character
+    auto const size = j.dump().size();
+    for (std::size_t chunk_size : {std::size_t{7}, size - 1, size}) {
+      DecompressionInputContainer c(
+        DecompressionInputContainer::AnyStreamTag{},
+        std::istringstream(os.str()), chunk_size);
+      EXPECT_EQ(nlohmann::json::parse(c), j)
+        << fmt::format("quality={}, chunk_size={}", quality, chunk_size);
+    }
+  }
+}
+
+TEST_F(OutputAdaptorTest, test_output_adaptor_generated_data_file) {
+  auto const info = Generator::makeCommunicatingInfo(1, 10, 2, 0);
+  nlohmann::json j;
+  for (PhaseType phase = 0; phase < 2; phase++) {
+    j["phases"][phase] = *JSONGenerator(info, 0, phase).generateJSON();
+  }
+
+  auto const output_dir = fmt::format("{}/output/tests", SRC_DIR);
+  std::filesystem::create_directories(output_dir);
+  auto const filename = output_dir + "/output_adaptor.0.json.br";
+  {
+    std::ofstream os(filename, std::ios::binary);
+    dump(j, os, true);
+  }
+
+  JSONReader reader{0};
+  ASSERT_TRUE(reader.isCompressed(filename));
+  reader.readFile(filename);
+  auto const parsed = reader.parse();
+  EXPECT_EQ(parsed->getNumPhases(), 2u);
+  EXPECT_EQ(parsed->getObjectInfo().size(), 10u);
+  EXPECT_EQ(parsed->getPhaseObjects(1, no_lb_iter).size(), 10u);
+}
+
+} // namespace vt::tv::tests::unit::utility
@@ -0,0 +1,157 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_png_encoder.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/png_encoder.h>
+
+#include "../util.h"
+
+#include <string>
+#include <vector>
+
+namespace vt::tv::tests::unit::utility {
+
+using PNGEncoder = vt::tv::utility::PNGEncoder;
+
+/**
+ * Provides unit tests for the vt::tv::utility::PNGEncoder class
+ */
+struct PNGEncoderTest : public ::testing::Test {
+  static uint32_t readU32(std::vector<uint8_t> const& buf, std::size_t pos) {
+    return (static_cast<uint32_t>(buf[pos]) << 24) |
+      (static_cast<uint32_t>(buf[pos + 1]) << 16) |
+      (static_cast<uint32_t>(buf[pos + 2]) << 8) |
+      static_cast<uint32_t>(buf[pos + 3]);
+  }
+
+  /// Walk the chunks of a PNG file, checking each CRC, and return their types
+  static std::vector<std::string> checkChunks(std::vector<uint8_t> const& png) {
+    std::vector<std::string> types;
+    std::size_t pos = 8;
+    while (pos + 12 <= png.size()) {
+      auto const length = readU32(png, pos);
+      std::string type(png.begin() + pos + 4, png.begin() + pos + 8);
+      auto const crc = readU32(png, pos + 8 + length);
+      EXPECT_EQ(crc, PNGEncoder::crc32(png.data() + pos + 4, length + 4))
+        << "Invalid CRC for chunk " << type;
+      types.push_back(type);
+      pos += 12 + length;
+    }
+    EXPECT_EQ(pos, png.size());
+    return types;
+  }
+};
+
+TEST_F(PNGEncoderTest, test_checksums) {
+  std::string const iend = "IEND";
+  EXPECT_EQ(
+    PNGEncoder::crc32(reinterpret_cast<uint8_t const*>(iend.data()), 4),
+    0xAE426082u);
+
+  std::string const wiki = "Wikipedia";
+  EXPECT_EQ(
+    PNGEncoder::adler32(
+      reinterpret_cast<uint8_t const*>(wiki.data()), wiki.size()),
+    0x11E60398u);
+}
+
+TEST_F(PNGEncoderTest, test_encode_structure) {
+  uint32_t const width = 7, height = 5;
+  std::vector<uint8_t> pixels(width * height * 3, 255);
+
+  for (int level : {0, 2, 9}) {
+    auto const png = PNGEncoder(level).encode(pixels.data(), width, height, 3);
+    ASSERT_GT(png.size(), 8u);
+    EXPECT_TRUE(std::equal(
+      png.begin(), png.begin() + 8, PNGEncoder::signature().begin()));
+    EXPECT_EQ(
+      checkChunks(png), (std::vector<std::string>{"IHDR", "IDAT", "IEND"}));
+
+    // IHDR: dimensions, 8-bit depth and RGB color type
+    EXPECT_EQ(readU32(png, 16), width);
+    EXPECT_EQ(readU32(png, 20), height);
+    EXPECT_EQ(png[24], 8u);
+    EXPECT_EQ(png[25], 2u);
+  }
+}
+
+TEST_F(PNGEncoderTest, test_stored_stream_round_trip) {
+  std::vector<uint8_t> data(70000);
+  for (std::size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<uint8_t>(i * 31 + i / 7);
+  }
+  auto const stream = PNGEncoder(0).compress(data.data(), data.size());
+
+  // Stored blocks: zlib header, then blocks of at most 65535 raw bytes
+  ASSERT_EQ(stream[0], 0x78);
+  EXPECT_EQ((stream[0] * 256 + stream[1]) % 31, 0);
+  std::vector<uint8_t> inflated;
+  std::size_t pos = 2;
+  bool final_block = false;
+  while (!final_block) {
+    final_block = stream[pos] & 1;
+    EXPECT_EQ(stream[pos] >> 1, 0);
+    std::size_t const len = stream[pos + 1] | (stream[pos + 2] << 8);
+    std::size_t const nlen = stream[pos + 3] | (stream[pos + 4] << 8);
+    EXPECT_EQ(len ^ 0xFFFF, nlen);
+    inflated.insert(
+      inflated.end(), stream.begin() + pos + 5, stream.begin() + pos + 5 + len);
+    pos += 5 + len;
+  }
+  EXPECT_EQ(inflated, data);
+  EXPECT_EQ(readU32(stream, pos), PNGEncoder::adler32(data.data(), data.size()));
+}
+
+TEST_F(PNGEncoderTest, test_compression_of_flat_images) {
+  uint32_t const width = 256, height = 256;
+  std::vector<uint8_t> pixels(width * height * 4, 200);
+  auto const stored = PNGEncoder(0).encode(pixels.data(), width, height, 4);
+  auto const compressed = PNGEncoder(2).encode(pixels.data(), width, height, 4);
+  EXPECT_LT(compressed.size() * 50, stored.size());
+}
+
+TEST_F(PNGEncoderTest, test_invalid_channels) {
+  std::vector<uint8_t> pixels(4, 0);
+  EXPECT_THROW(PNGEncoder().encode(pixels.data(), 2, 2, 1), std::runtime_error);
+}
+
+} // namespace vt::tv::tests::unit::utility
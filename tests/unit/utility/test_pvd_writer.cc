@@ -0,0 +1,158 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              test_pvd_writer.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/pvd_writer.h>
+
+#include "../util.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vt::tv::tests::unit::utility {
+
+using Util = vt::tv::tests::unit::Util;
+using PVDWriter = vt::tv::utility::PVDWriter;
+
+/**
+ * Provides unit tests for the vt::tv::utility::PVDWriter class
+ */
+struct PVDWriterTest : public ::testing::Test {
+  void SetUp() override {
+    output_dir_ = Util::resolveTestDir();
+    std::filesystem::remove_all(output_dir_);
+    std::filesystem::create_directories(output_dir_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(output_dir_);
+  }
+
+  static std::size_t count(std::string const& content, std::string const& s) {
+    std::size_t n = 0;
+    for (auto pos = content.find(s); pos != std::string::npos;
+         pos = content.find(s, pos + 1)) {
+      n++;
+    }
+    return n;
+  }
+
+protected:
+  std::filesystem::path output_dir_;
+};
+
+TEST_F(PVDWriterTest, test_empty_collection_is_well_formed) {
+  auto const filename = (output_dir_ / "empty.pvd").string();
+  PVDWriter writer(filename);
+
+  EXPECT_EQ(writer.getNumDataSets(), 0u);
+  EXPECT_EQ(
+    Util::getFileContent(filename),
+    "<?xml version=\"1.0\"?>\n"
+    "<VTKFile type=\"Collection\" version=\"0.1\" "
+    "byte_order=\"LittleEndian\">\n"
+    "  <Collection>\n"
+    "  </Collection>\n"
+    "</VTKFile>\n");
+}
+
+TEST_F(PVDWriterTest, test_data_sets_are_appended_in_order) {
+  auto const filename = (output_dir_ / "series.pvd").string();
+  PVDWriter writer(filename);
+  writer.addDataSet(0, 0, "object_mesh", "series_object_mesh_0.vtp");
+  writer.addDataSet(0, 1, "rank_mesh", "series_rank_mesh_0.vtp");
+
+  // The file is complete after each addition
+  auto content = Util::getFileContent(filename);
+  auto const first = content.find(
+    "    <DataSet timestep=\"0\" group=\"\" part=\"0\" name=\"object_mesh\" "
+    "file=\"series_object_mesh_0.vtp\"/>\n");
+  auto const second = content.find(
+    "    <DataSet timestep=\"0\" group=\"\" part=\"1\" name=\"rank_mesh\" "
+    "file=\"series_rank_mesh_0.vtp\"/>\n");
+  ASSERT_NE(first, std::string::npos);
+  ASSERT_NE(second, std::string::npos);
+  EXPECT_LT(first, second);
+  EXPECT_EQ(
+    content.substr(content.size() - 27), "  </Collection>\n</VTKFile>\n");
+
+  writer.addDataSet(1.5, 0, "a\"b", "x&y.vtp");
+  content = Util::getFileContent(filename);
+  EXPECT_NE(
+    content.find("timestep=\"1.5\" group=\"\" part=\"0\" name=\"a&quot;b\" "
+                 "file=\"x&amp;y.vtp\"/>"),
+    std::string::npos);
+  EXPECT_EQ(count(content, "</VTKFile>"), 1u);
+  EXPECT_EQ(writer.getNumDataSets(), 3u);
+}
+
+TEST_F(PVDWriterTest, test_concurrent_additions) {
+  auto const filename = (output_dir_ / "concurrent.pvd").string();
+  PVDWriter writer(filename);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&writer, t] {
+      for (int i = 0; i < 25; i++) {
+        writer.addDataSet(
+          i, t, "part", fmt::format("file_{}_{}.vtp", t, i));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto const content = Util::getFileContent(filename);
+  EXPECT_EQ(writer.getNumDataSets(), 100u);
+  EXPECT_EQ(count(content, "<DataSet "), 100u);
+  EXPECT_EQ(count(content, "</VTKFile>"), 1u);
+}
+
+TEST_F(PVDWriterTest, test_unwritable_file_throws) {
+  EXPECT_THROW(
+    PVDWriter((output_dir_ / "missing" / "x.pvd").string()),
+    std::runtime_error);
+}
+
+} /* end namespace vt::tv::tests::unit::utility */
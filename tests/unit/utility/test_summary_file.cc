@@ -0,0 +1,211 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_summary_file.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/api/info.h>
+#include <vt-tv/utility/info_loader.h>
+#include <vt-tv/utility/summary_file.h>
+
+#include "../generator.h"
+#include "../util.h"
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace vt::tv::tests::unit::utility {
+
+using Util = vt::tv::tests::unit::Util;
+using DataFileStamp = vt::tv::utility::DataFileStamp;
+using InfoLoader = vt::tv::utility::InfoLoader;
+using SummaryFile = vt::tv::utility::SummaryFile;
+
+/**
+ * Provides unit tests for the vt::tv::utility::SummaryFile class
+ */
+struct SummaryFileTest : public ::testing::Test {
+  void SetUp() override {
+    output_dir_ = Util::resolveTestDir();
+    std::filesystem::remove_all(output_dir_);
+    std::filesystem::create_directories(output_dir_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(output_dir_);
+  }
+
+  static void expectEqual(PhaseSummary const& a, PhaseSummary const& b) {
+    EXPECT_EQ(a.n_ranks, b.n_ranks);
+    EXPECT_EQ(a.n_phases, b.n_phases);
+    ASSERT_EQ(a.frames.size(), b.frames.size());
+    for (std::size_t f = 0; f < a.frames.size(); f++) {
+      auto const& fa = a.frames[f];
+      auto const& fb = b.frames[f];
+      EXPECT_EQ(fa.phase, fb.phase);
+      EXPECT_EQ(fa.lb_iter, fb.lb_iter);
+      EXPECT_EQ(fa.max_object_load, fb.max_object_load);
+      EXPECT_EQ(fa.max_object_volume, fb.max_object_volume);
+      EXPECT_EQ(fa.rank_qois, fb.rank_qois);
+      ASSERT_EQ(fa.object_qois.size(), fb.object_qois.size());
+      for (auto const& [key, range] : fa.object_qois) {
+        auto const& other = fb.object_qois.at(key);
+        EXPECT_EQ(range.min, other.min) << key;
+        EXPECT_EQ(range.max, other.max) << key;
+        EXPECT_EQ(range.support, other.support) << key;
+        EXPECT_EQ(range.continuous, other.continuous) << key;
+      }
+    }
+  }
+
+protected:
+  std::filesystem::path output_dir_;
+};
+
+TEST_F(SummaryFileTest, test_summary_file_round_trip) {
+  auto const info = Generator::makeCommunicatingInfo(4, 30, 3, 2);
+  auto const summary = info.computePhaseSummary();
+  std::vector<DataFileStamp> const stamps = {
+    {"data.0.json", 100, 7}, {"data.1.json", 200, 8}};
+
+  auto const filename = SummaryFile::getPath(output_dir_.string(), "data");
+  EXPECT_EQ(filename, output_dir_.string() + "data.summary.bin");
+  EXPECT_EQ(SummaryFile::read(filename, stamps), nullptr);
+
+  SummaryFile::write(filename, summary, stamps);
+  EXPECT_FALSE(std::filesystem::exists(filename + ".tmp"));
+  auto const read = SummaryFile::read(filename, stamps);
+  ASSERT_NE(read, nullptr);
+  expectEqual(*read, summary);
+
+  // A modified, added or removed data file makes the summary stale
+  auto modified = stamps;
+  modified[1].mtime++;
+  EXPECT_EQ(SummaryFile::read(filename, modified), nullptr);
+  modified = stamps;
+  modified.push_back({"data.2.json", 300, 9});
+  EXPECT_EQ(SummaryFile::read(filename, modified), nullptr);
+  EXPECT_EQ(SummaryFile::read(filename, {stamps[0]}), nullptr);
+}
+
+TEST_F(SummaryFileTest, test_summary_file_truncated) {
+  auto const info = Generator::makeCommunicatingInfo(2, 10, 2, 1);
+  std::vector<DataFileStamp> const stamps = {{"data.0.json", 1, 1}};
+  auto const filename = (output_dir_ / "data.summary.bin").string();
+  SummaryFile::write(filename, info.computePhaseSummary(), stamps);
+
+  auto const size = std::filesystem::file_size(filename);
+  for (auto const new_size : {size - 1, size / 2, uint64_t{4}}) {
+    std::filesystem::resize_file(filename, new_size);
+    EXPECT_EQ(SummaryFile::read(filename, stamps), nullptr) << new_size;
+  }
+  std::ofstream(filename) << "not a summary";
+  EXPECT_EQ(SummaryFile::read(filename, stamps), nullptr);
+}
+
+TEST_F(SummaryFileTest, test_summary_file_corrupt_counts) {
+  auto const info = Generator::makeCommunicatingInfo(2, 10, 2, 1);
+  auto const summary = info.computePhaseSummary();
+  ASSERT_FALSE(summary.frames.empty());
+  ASSERT_FALSE(summary.frames[0].rank_qois.empty());
+  auto const filename = (output_dir_ / "data.summary.bin").string();
+
+  // Counts of stamps, frames and rank QOIs of the first frame, after the
+  // header, the ranks, the phases and the values of the frame; none of them
+  // can exceed the rest of the file
+  for (std::streamoff const offset : {16, 40, 80}) {
+    SummaryFile::write(filename, summary, {});
+    ASSERT_NE(SummaryFile::read(filename, {}), nullptr);
+    {
+      std::fstream fs(
+        filename, std::ios::in | std::ios::out | std::ios::binary);
+      uint64_t const huge = uint64_t{1} << 40;
+      fs.seekp(offset);
+      fs.write(reinterpret_cast<char const*>(&huge), sizeof(huge));
+    }
+    EXPECT_EQ(SummaryFile::read(filename, {}), nullptr) << offset;
+  }
+}
+
+TEST_F(SummaryFileTest, test_summary_file_stamps) {
+  for (auto const* name : {"data.1.json", "data.0.json"}) {
+    std::ofstream(output_dir_ / name) << name;
+  }
+  auto const stamps = SummaryFile::stamp(
+    {output_dir_ / "data.1.json", output_dir_ / "data.0.json"});
+  ASSERT_EQ(stamps.size(), 2u);
+  EXPECT_EQ(stamps[0].name, "data.0.json");
+  EXPECT_EQ(stamps[1].name, "data.1.json");
+  EXPECT_EQ(stamps[0].size, 11u);
+}
+
+TEST_F(SummaryFileTest, test_summary_file_from_info_loader) {
+  auto const data_dir = std::filesystem::path(SRC_DIR) / "data/ccm_example";
+  for (auto const& entry : std::filesystem::directory_iterator(data_dir)) {
+    std::filesystem::copy_file(
+      entry.path(), output_dir_ / entry.path().filename());
+  }
+  auto config = YAML::LoadFile(
+    fmt::format("{}/tests/config/ccm-example.yaml", SRC_DIR));
+  config["input"]["directory"] = output_dir_.string();
+
+  // No summary unless requested
+  EXPECT_EQ(InfoLoader::loadFromConfig(config)->getPhaseSummary(), nullptr);
+
+  // The summary is computed and written once, then read back
+  config["input"]["summary"] = true;
+  auto const filename = SummaryFile::getPath(output_dir_.string(), "data");
+  auto const info = InfoLoader::loadFromConfig(config);
+  ASSERT_NE(info->getPhaseSummary(), nullptr);
+  ASSERT_TRUE(std::filesystem::exists(filename));
+  expectEqual(*info->getPhaseSummary(), info->computePhaseSummary());
+
+  auto const reloaded = InfoLoader::loadFromConfig(config);
+  ASSERT_NE(reloaded->getPhaseSummary(), nullptr);
+  expectEqual(*reloaded->getPhaseSummary(), *info->getPhaseSummary());
+  auto const range = reloaded->getPhaseSummary()->getObjectQOIRange(
+    "shared_id", std::numeric_limits<PhaseType>::max());
+  EXPECT_TRUE(range.has_value());
+}
+
+} // namespace vt::tv::tests::unit::utility
@@ -0,0 +1,196 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                test_trace.cc
+//             DARMA/vt-tv => Virtual Transport -- Task Visualizer
+//
+// Copyright 2019-2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <vt-tv/utility/trace.h>
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include "../util.h"
+
+namespace vt::tv::tests::unit::utility {
+
+using Trace = vt::tv::utility::Trace;
+using TraceSpan = vt::tv::utility::TraceSpan;
+
+/**
+ * Provides unit tests for the vt::tv::utility::Trace class
+ */
+struct TraceTest : public ::testing::Test {
+  void TearDown() override {
+    // Later tests must not record into the trace of this one
+    std::ostringstream os;
+    auto* buf = std::cout.rdbuf(os.rdbuf());
+    Trace::get().finish();
+    std::cout.rdbuf(buf);
+  }
+};
+
+TEST_F(TraceTest, test_trace_disabled) {
+  Trace::get().enable("");
+  Trace::get().finish();
+  EXPECT_FALSE(Trace::get().isEnabled());
+
+  {
+    TraceSpan span("ignored");
+    Trace::get().count("ignored", 1);
+  }
+  EXPECT_TRUE(Trace::get().getEvents().empty());
+}
+
+TEST_F(TraceTest, test_trace_spans_and_counters) {
+  Trace::get().enable("");
+  {
+    TraceSpan outer("outer", {{"phase", 3}, {"lb_iter", -1}});
+    for (int i = 0; i < 3; i++) {
+      TraceSpan inner("inner");
+      Trace::get().count("items", 2);
+    }
+  }
+
+  auto const events = Trace::get().getEvents();
+  ASSERT_EQ(events.size(), 7u);
+
+  // Spans are recorded when they end, inner ones first
+  auto const& outer = events.back();
+  EXPECT_EQ(outer.name, "outer");
+  ASSERT_EQ(outer.args.size(), 2u);
+  EXPECT_STREQ(outer.args[0].key, "phase");
+  EXPECT_EQ(outer.args[0].value, 3);
+  for (auto const& event : events) {
+    if (event.name == "inner") {
+      EXPECT_GE(event.begin_us, outer.begin_us);
+      EXPECT_LE(
+        event.begin_us + event.duration_us,
+        outer.begin_us + outer.duration_us);
+    }
+  }
+
+  auto const summaries = Trace::get().summarize();
+  ASSERT_EQ(summaries.size(), 3u);
+  EXPECT_EQ(summaries[0].name, "outer");
+  EXPECT_EQ(summaries[0].count, 1u);
+  EXPECT_EQ(summaries[1].name, "inner");
+  EXPECT_EQ(summaries[1].count, 3u);
+  EXPECT_GE(summaries[0].total_ms, summaries[1].total_ms);
+  EXPECT_EQ(summaries[2].name, "items");
+  EXPECT_TRUE(summaries[2].is_counter);
+  EXPECT_EQ(summaries[2].total_ms, 6.0);
+}
+
+TEST_F(TraceTest, test_trace_threads) {
+  Trace::get().enable("");
+  auto const main_thread = Trace::getThreadID();
+  EXPECT_EQ(Trace::getThreadID(), main_thread);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([] { TraceSpan span("worker"); });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  std::set<uint64_t> ids;
+  for (auto const& event : Trace::get().getEvents()) {
+    ids.insert(event.thread);
+  }
+  EXPECT_EQ(ids.size(), 4u);
+  EXPECT_EQ(ids.count(main_thread), 0u);
+}
+
+TEST_F(TraceTest, test_trace_chrome_json) {
+  Trace::get().enable("");
+  {
+    TraceSpan span("stage", {{"rank", 2}});
+  }
+  Trace::get().count("bytes", 10);
+
+  std::ostringstream os;
+  Trace::get().writeChromeJSON(os);
+  auto const j = nlohmann::json::parse(os.str());
+  auto const& events = j["traceEvents"];
+  ASSERT_EQ(events.size(), 2u);
+
+  EXPECT_EQ(events[0]["name"], "stage");
+  EXPECT_EQ(events[0]["ph"], "X");
+  EXPECT_TRUE(events[0]["ts"].is_number());
+  EXPECT_TRUE(events[0]["dur"].is_number());
+  EXPECT_EQ(events[0]["tid"], Trace::getThreadID());
+  EXPECT_EQ(events[0]["args"]["rank"], 2);
+
+  EXPECT_EQ(events[1]["name"], "bytes");
+  EXPECT_EQ(events[1]["ph"], "C");
+  EXPECT_EQ(events[1]["args"]["value"], 10.0);
+}
+
+TEST_F(TraceTest, test_trace_finish_writes_file) {
+  auto const output_dir = fmt::format("{}/output/tests", SRC_DIR);
+  std::filesystem::create_directories(output_dir);
+  auto const filename = output_dir + "/test_trace.json";
+  std::filesystem::remove(filename);
+
+  Trace::get().enable(filename);
+  {
+    TraceSpan span("stage");
+  }
+
+  std::ostringstream summary;
+  auto* buf = std::cout.rdbuf(summary.rdbuf());
+  Trace::get().finish();
+  std::cout.rdbuf(buf);
+
+  EXPECT_FALSE(Trace::get().isEnabled());
+  EXPECT_NE(summary.str().find("stage"), std::string::npos);
+
+  std::ifstream is(filename);
+  ASSERT_TRUE(is.good());
+  auto const j = nlohmann::json::parse(is);
+  EXPECT_EQ(j["traceEvents"].size(), 1u);
+}
+
+} // namespace vt::tv::tests::unit::utility